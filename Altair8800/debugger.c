@@ -0,0 +1,363 @@
+#include "debugger.h"
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+
+#include "memory.h"
+#include <string.h>
+
+typedef struct
+{
+    uint8_t map[64 * 1024 / 8];
+    uint32_t pages[256 / 32]; // Any bit set in the 256-byte page
+    uint32_t count;
+} debugger_map_t;
+
+// Data memory one instruction is about to touch
+typedef struct
+{
+    uint16_t address;
+    uint8_t length;
+    bool reads;
+    bool writes;
+} debugger_access_t;
+
+static debugger_map_t maps[DEBUGGER_KINDS];
+static debugger_hit_t pending_hit;
+static bool hit_pending;
+
+// Set on a breakpoint hit so that resuming runs the instruction there
+static bool resume_pending;
+static uint16_t resume_pc;
+
+// Pages the threaded core hands over: those with a breakpoint, and those
+// with a watched byte of either kind
+static uint32_t watch_pages[256 / 32];
+static i8080_guard_t guard = {.code_pages = maps[DEBUGGER_BREAKPOINT].pages};
+
+static inline bool page_test(const debugger_map_t* m, uint16_t address)
+{
+    return m->pages[address >> 13] & (1u << ((address >> 8) & 31));
+}
+
+static inline bool map_test(const debugger_map_t* m, uint16_t address)
+{
+    return page_test(m, address) && (m->map[address >> 3] & (1u << (address & 7)));
+}
+
+static void map_update_page(debugger_map_t* m, uint16_t address)
+{
+    const uint8_t* page = &m->map[(address & 0xff00) >> 3];
+    uint32_t bit = 1u << ((address >> 8) & 31);
+
+    m->pages[address >> 13] &= ~bit;
+    for (size_t i = 0; i < 256 / 8; i++)
+    {
+        if (page[i])
+        {
+            m->pages[address >> 13] |= bit;
+            break;
+        }
+    }
+}
+
+void debugger_set(debugger_kind_t kind, uint16_t address, uint32_t length, bool enable)
+{
+    debugger_map_t* m = &maps[kind];
+
+    if (length > 64 * 1024)
+    {
+        length = 64 * 1024;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        uint16_t a = (uint16_t)(address + i);
+        uint8_t bit = (uint8_t)(1u << (a & 7));
+        bool set = m->map[a >> 3] & bit;
+
+        if (enable && !set)
+        {
+            m->map[a >> 3] |= bit;
+            m->count++;
+        }
+        else if (!enable && set)
+        {
+            m->map[a >> 3] &= (uint8_t)~bit;
+            m->count--;
+        }
+
+        // Refresh the page filter once the page's last byte in the range is done
+        if ((a & 0xff) == 0xff || i + 1 == length)
+        {
+            map_update_page(m, a);
+        }
+    }
+
+    if (kind == DEBUGGER_BREAKPOINT && !enable)
+    {
+        resume_pending = false;
+    }
+}
+
+void debugger_clear(debugger_kind_t kind)
+{
+    memset(&maps[kind], 0, sizeof(maps[kind]));
+
+    if (kind == DEBUGGER_BREAKPOINT)
+    {
+        resume_pending = false;
+    }
+}
+
+bool debugger_armed(void)
+{
+    return maps[DEBUGGER_BREAKPOINT].count || maps[DEBUGGER_WATCH_READ].count || maps[DEBUGGER_WATCH_WRITE].count;
+}
+
+static bool condition_met(uint8_t flags, uint8_t op_code)
+{
+    static const uint8_t condition_flag[4] = {FLAGS_ZERO, FLAGS_CARRY, FLAGS_PARITY, FLAGS_SIGN};
+    bool set = flags & condition_flag[(op_code >> 4) & 3];
+    return (op_code & 0x08) ? set : !set;
+}
+
+// Decode the data access of the instruction at PC from the current registers.
+// Returns false for instructions that touch no data memory.
+static bool instruction_access(const intel8080_t* cpu, debugger_access_t* access)
+{
+    const registers_t* r = &cpu->registers;
+    uint8_t op_code = read8(cpu->memory, r->pc);
+
+    access->length = 1;
+    access->reads = false;
+    access->writes = false;
+
+    switch (op_code)
+    {
+        case 0x02: // STAX B
+            access->address = r->bc;
+            access->writes = true;
+            return true;
+        case 0x12: // STAX D
+            access->address = r->de;
+            access->writes = true;
+            return true;
+        case 0x0a: // LDAX B
+            access->address = r->bc;
+            access->reads = true;
+            return true;
+        case 0x1a: // LDAX D
+            access->address = r->de;
+            access->reads = true;
+            return true;
+        case 0x22: // SHLD
+        case 0x32: // STA
+            access->address = read16(cpu->memory, (uint16_t)(r->pc + 1));
+            access->length = op_code == 0x22 ? 2 : 1;
+            access->writes = true;
+            return true;
+        case 0x2a: // LHLD
+        case 0x3a: // LDA
+            access->address = read16(cpu->memory, (uint16_t)(r->pc + 1));
+            access->length = op_code == 0x2a ? 2 : 1;
+            access->reads = true;
+            return true;
+        case 0x34: // INR M
+        case 0x35: // DCR M
+            access->address = r->hl;
+            access->reads = true;
+            access->writes = true;
+            return true;
+        case 0x36: // MVI M
+            access->address = r->hl;
+            access->writes = true;
+            return true;
+        case 0xe3: // XTHL
+            access->address = r->sp;
+            access->length = 2;
+            access->reads = true;
+            access->writes = true;
+            return true;
+        case 0xc9: // RET
+        case 0xd9: // RET (undocumented alias)
+            access->address = r->sp;
+            access->length = 2;
+            access->reads = true;
+            return true;
+        case 0xcd: // CALL
+        case 0xdd: // CALL (undocumented aliases)
+        case 0xed:
+        case 0xfd:
+            access->address = (uint16_t)(r->sp - 2);
+            access->length = 2;
+            access->writes = true;
+            return true;
+        case 0x76: // HLT
+            return false;
+        default:
+            break;
+    }
+
+    if ((op_code & 0xf8) == 0x70) // MOV M,r
+    {
+        access->address = r->hl;
+        access->writes = true;
+    }
+    else if ((op_code & 0xc7) == 0x46 || (op_code & 0xc7) == 0x86) // MOV r,M and ALU M
+    {
+        access->address = r->hl;
+        access->reads = true;
+    }
+    else if ((op_code & 0xcf) == 0xc5 || (op_code & 0xc7) == 0xc7 ||
+             ((op_code & 0xc7) == 0xc4 && condition_met(r->flags, op_code))) // PUSH, RST, taken Ccc
+    {
+        access->address = (uint16_t)(r->sp - 2);
+        access->length = 2;
+        access->writes = true;
+    }
+    else if ((op_code & 0xcf) == 0xc1 || ((op_code & 0xc7) == 0xc0 && condition_met(r->flags, op_code))) // POP, taken Rcc
+    {
+        access->address = r->sp;
+        access->length = 2;
+        access->reads = true;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+static bool watch_hit(const debugger_access_t* access, uint16_t pc)
+{
+    for (uint8_t i = 0; i < access->length; i++)
+    {
+        uint16_t address = (uint16_t)(access->address + i);
+        debugger_kind_t kind;
+
+        if (access->writes && map_test(&maps[DEBUGGER_WATCH_WRITE], address))
+        {
+            kind = DEBUGGER_WATCH_WRITE;
+        }
+        else if (access->reads && map_test(&maps[DEBUGGER_WATCH_READ], address))
+        {
+            kind = DEBUGGER_WATCH_READ;
+        }
+        else
+        {
+            continue;
+        }
+
+        pending_hit.kind = kind;
+        pending_hit.pc = pc;
+        pending_hit.address = address;
+        hit_pending = true;
+        return true;
+    }
+    return false;
+}
+
+uint32_t debugger_run(intel8080_t* cpu, uint32_t cycle_budget)
+{
+    bool watching = maps[DEBUGGER_WATCH_READ].count || maps[DEBUGGER_WATCH_WRITE].count;
+    uint32_t executed = 0;
+
+    for (size_t i = 0; i < 256 / 32; i++)
+    {
+        watch_pages[i] = maps[DEBUGGER_WATCH_READ].pages[i] | maps[DEBUGGER_WATCH_WRITE].pages[i];
+    }
+    guard.data_pages = watching ? watch_pages : NULL;
+
+    while (executed < cycle_budget && !cpu->console_idle && !hit_pending)
+    {
+        // The normal core runs up to the next instruction in a page with a
+        // breakpoint or that touches a page with a watched byte. Inside a
+        // breakpoint page every instruction takes the checked path below.
+        if (!page_test(&maps[DEBUGGER_BREAKPOINT], cpu->registers.pc))
+        {
+            executed += i8080_run_guarded(cpu, cycle_budget - executed, &guard);
+            if (executed >= cycle_budget || cpu->console_idle)
+            {
+                break;
+            }
+        }
+
+        uint16_t pc = cpu->registers.pc;
+
+        // Idling in HLT, or about to take an interrupt instead of running
+        // the instruction at PC
+        if (cpu->halted || (cpu->int_pending && (cpu->registers.flags & FLAGS_IF) && !cpu->ei_delay))
+        {
+            executed += i8080_cycle(cpu);
+            continue;
+        }
+
+        if (map_test(&maps[DEBUGGER_BREAKPOINT], pc) && !(resume_pending && pc == resume_pc))
+        {
+            pending_hit.kind = DEBUGGER_BREAKPOINT;
+            pending_hit.pc = pc;
+            pending_hit.address = pc;
+            hit_pending = true;
+            resume_pending = true;
+            resume_pc = pc;
+            break;
+        }
+        resume_pending = false;
+
+        debugger_access_t access;
+        bool check = watching && instruction_access(cpu, &access);
+
+        executed += i8080_cycle(cpu);
+
+        if (check)
+        {
+            watch_hit(&access, pc);
+        }
+    }
+    return executed;
+}
+
+bool debugger_take_hit(debugger_hit_t* hit)
+{
+    if (!hit_pending)
+    {
+        return false;
+    }
+    *hit = pending_hit;
+    hit_pending = false;
+    return true;
+}
+
+size_t debugger_list(debugger_kind_t kind, uint16_t* first, uint16_t* last, size_t max)
+{
+    const debugger_map_t* m = &maps[kind];
+    size_t count = 0;
+    bool in_run = false;
+
+    for (uint32_t address = 0; address < 64 * 1024; address++)
+    {
+        bool set = map_test(m, (uint16_t)address);
+        if (set && !in_run)
+        {
+            if (count == max)
+            {
+                break;
+            }
+            first[count] = (uint16_t)address;
+            in_run = true;
+        }
+        else if (!set && in_run)
+        {
+            last[count++] = (uint16_t)(address - 1);
+            in_run = false;
+        }
+    }
+
+    if (in_run)
+    {
+        last[count++] = 0xffff;
+    }
+    return count;
+}
+
+#endif
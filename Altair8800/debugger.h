@@ -0,0 +1,54 @@
+#ifndef _DEBUGGER_H_
+#define _DEBUGGER_H_
+
+#include "intel8080.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Breakpoints and memory watchpoints for the CPU monitor. Built with
+// -DBREAKPOINTS=ON. Each kind is a 64K-bit map with a one-bit-per-page
+// filter in front of it. While nothing is set the governor runs the normal
+// core; otherwise it runs debugger_run(), which keeps the threaded core going
+// and checks instructions one at a time only where a filter page is hit.
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+
+typedef enum
+{
+    DEBUGGER_BREAKPOINT = 0,
+    DEBUGGER_WATCH_READ = 1,
+    DEBUGGER_WATCH_WRITE = 2,
+    DEBUGGER_KINDS = 3
+} debugger_kind_t;
+
+typedef struct
+{
+    debugger_kind_t kind;
+    uint16_t pc;      // Instruction that hit
+    uint16_t address; // Breakpoint, or the watched byte it accessed
+} debugger_hit_t;
+
+// Set or clear length addresses from address (wrapping at 64K)
+void debugger_set(debugger_kind_t kind, uint16_t address, uint32_t length, bool enable);
+void debugger_clear(debugger_kind_t kind);
+
+// True while any breakpoint or watchpoint is set
+bool debugger_armed(void);
+
+// Same contract as i8080_run(), but stops before an instruction at a
+// breakpoint and after one that touches a watched byte. Resuming from a
+// breakpoint executes that instruction. Stack traffic of an interrupt
+// acknowledge is not watched. Code outside the pages with a breakpoint runs
+// on i8080_run_guarded(), which hands over only instructions whose data
+// access falls in a page with a watched byte.
+uint32_t debugger_run(intel8080_t* cpu, uint32_t cycle_budget);
+
+// Fetch and clear the hit that ended the last debugger_run()
+bool debugger_take_hit(debugger_hit_t* hit);
+
+// Runs of consecutive set addresses, lowest first. Returns the number of
+// runs stored, at most max.
+size_t debugger_list(debugger_kind_t kind, uint16_t* first, uint16_t* last, size_t max);
+
+#endif
+
+#endif
@@ -13,12 +13,22 @@
 #endif
 
 #include "memory.h"
+#include "io_ports.h"
+#include "trace.h"
 
 // Performance optimization macros
 #define LIKELY(x)   __builtin_expect(!!(x), 1)
 #define UNLIKELY(x) __builtin_expect(!!(x), 0)
-#define CHECK_CARRY(a, b) ((a + b) > 0xff)
-#define CHECK_HALF_CARRY(a, b) (((a & 0xf) + (b & 0xf)) > 0xf)
+
+// Immediate operands. With the decode cache they come from the cache entry
+// instead of being re-read from memory.
+#if I8080_DECODE_CACHE
+#define I8080_IMM8(cpu)		((uint8_t)(cpu)->operand)
+#define I8080_IMM16(cpu)	((cpu)->operand)
+#else
+#define I8080_IMM8(cpu)		read8((cpu)->memory, (cpu)->registers.pc + 1)
+#define I8080_IMM16(cpu)	read16((cpu)->memory, (cpu)->registers.pc + 1)
+#endif
 
 // define CPU stats LEDs
 #define STATUS_MEMORY_READ		0x80
@@ -30,29 +40,93 @@
 #define STATUS_WRITE_OUTPUT		0x02	// inverted!
 #define STATUS_INTERRUPT		0x01
 
-// Fast parity lookup table
-static const uint8_t parity_table[256] = {
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1
+// Flag lookup tables. Each ALU handler ORs one or two of these into the flags
+// register instead of testing the result bit by bit.
+
+// S, Z and P for a result byte
+static const uint8_t zsp_table[256] = {
+	0x44, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+	0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+	0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+	0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84
+};
+
+// Auxiliary carry out of bit 3, indexed by HALF_CARRY_INDEX(a, operand). Subtracts
+// index it with the two's complement operand (see i8080_gensub).
+#define HALF_CARRY_INDEX(a, b)	((((a) & 0xf) << 4) | ((b) & 0xf))
+static const uint8_t half_carry_table[256] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+};
+
+// S, Z, P and H for the result of INR and DCR
+static const uint8_t inr_flags_table[256] = {
+	0x54, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x10, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x10, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x14, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x10, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x14, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x14, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x10, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+	0x90, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x94, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+	0x94, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+	0x90, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x94, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+	0x90, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x90, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+	0x94, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84
+};
+
+static const uint8_t dcr_flags_table[256] = {
+	0x54, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x04,
+	0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x00,
+	0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x00,
+	0x14, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x04,
+	0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x00,
+	0x14, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x04,
+	0x14, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x04,
+	0x10, 0x14, 0x14, 0x10, 0x14, 0x10, 0x10, 0x14, 0x14, 0x10, 0x10, 0x14, 0x10, 0x14, 0x14, 0x00,
+	0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x80,
+	0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x84,
+	0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x84,
+	0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x80,
+	0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x84,
+	0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x80,
+	0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x80,
+	0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90, 0x84
 };
 
 static inline uint8_t get_parity_fast(uint8_t val)
 {
-	return parity_table[val];
+	return (zsp_table[val] & FLAGS_PARITY) != 0;
 }
 
 uint8_t get_parity(uint8_t val)
@@ -60,143 +134,11 @@ uint8_t get_parity(uint8_t val)
 	return get_parity_fast(val);
 }
 
-// Forward declarations for jump table
-static uint8_t i8080_nop(intel8080_t *cpu);
-static uint8_t i8080_lxi(intel8080_t *cpu);
-static uint8_t i8080_stax(intel8080_t *cpu);
-static uint8_t i8080_inx(intel8080_t *cpu);
-static uint8_t i8080_inr(intel8080_t *cpu);
-static uint8_t i8080_dcr(intel8080_t *cpu);
-static uint8_t i8080_mvi(intel8080_t *cpu);
-static uint8_t i8080_rlc(intel8080_t *cpu);
-static uint8_t i8080_dad(intel8080_t *cpu);
-static uint8_t i8080_ldax(intel8080_t *cpu);
-static uint8_t i8080_dcx(intel8080_t *cpu);
-static uint8_t i8080_rrc(intel8080_t *cpu);
-static uint8_t i8080_ral(intel8080_t *cpu);
-static uint8_t i8080_rar(intel8080_t *cpu);
-static uint8_t i8080_shld(intel8080_t *cpu);
-static uint8_t i8080_daa(intel8080_t *cpu);
-static uint8_t i8080_lhld(intel8080_t *cpu);
-static uint8_t i8080_cma(intel8080_t *cpu);
-static uint8_t i8080_lda(intel8080_t *cpu);
-static uint8_t i8080_sta(intel8080_t *cpu);
-static uint8_t i8080_stc(intel8080_t *cpu);
-static uint8_t i8080_cmc(intel8080_t *cpu);
-static uint8_t i8080_mov(intel8080_t *cpu);
-static uint8_t i8080_add(intel8080_t *cpu);
-static uint8_t i8080_adc(intel8080_t *cpu);
-static uint8_t i8080_sub(intel8080_t *cpu);
-static uint8_t i8080_sbb(intel8080_t *cpu);
-static uint8_t i8080_ana(intel8080_t *cpu);
-static uint8_t i8080_xra(intel8080_t *cpu);
-static uint8_t i8080_ora(intel8080_t *cpu);
-static uint8_t i8080_cmp(intel8080_t *cpu);
-static uint8_t i8080_rccc(intel8080_t *cpu);
-static uint8_t i8080_pop(intel8080_t *cpu);
-static uint8_t i8080_jccc(intel8080_t *cpu);
-static uint8_t i8080_jmp(intel8080_t *cpu);
-static uint8_t i8080_cccc(intel8080_t *cpu);
-static uint8_t i8080_push(intel8080_t *cpu);
-static uint8_t i8080_adi(intel8080_t *cpu);
-static uint8_t i8080_rst(intel8080_t *cpu);
-static uint8_t i8080_ret(intel8080_t *cpu);
-static uint8_t i8080_call(intel8080_t *cpu);
-static uint8_t i8080_aci(intel8080_t *cpu);
-static uint8_t i8080_out(intel8080_t *cpu);
-static uint8_t i8080_sui(intel8080_t *cpu);
-static uint8_t i8080_in(intel8080_t *cpu);
-static uint8_t i8080_sbi(intel8080_t *cpu);
-static uint8_t i8080_xthl(intel8080_t *cpu);
-static uint8_t i8080_ani(intel8080_t *cpu);
-static uint8_t i8080_pchl(intel8080_t *cpu);
-static uint8_t i8080_xchg(intel8080_t *cpu);
-static uint8_t i8080_xri(intel8080_t *cpu);
-static uint8_t i8080_di(intel8080_t *cpu);
-static uint8_t i8080_ori(intel8080_t *cpu);
-static uint8_t i8080_sphl(intel8080_t *cpu);
-static uint8_t i8080_ei(intel8080_t *cpu);
-static uint8_t i8080_cpi(intel8080_t *cpu);
-
-// Jump table for fast opcode dispatch
-static uint8_t (*const opcode_handlers[256])(intel8080_t *cpu) = {
-	[0x00] = i8080_nop,    [0x01] = i8080_lxi,    [0x02] = i8080_stax,   [0x03] = i8080_inx,
-	[0x04] = i8080_inr,    [0x05] = i8080_dcr,    [0x06] = i8080_mvi,    [0x07] = i8080_rlc,
-	[0x08] = NULL,         [0x09] = i8080_dad,    [0x0a] = i8080_ldax,   [0x0b] = i8080_dcx,
-	[0x0c] = i8080_inr,    [0x0d] = i8080_dcr,    [0x0e] = i8080_mvi,    [0x0f] = i8080_rrc,
-	[0x10] = NULL,         [0x11] = i8080_lxi,    [0x12] = i8080_stax,   [0x13] = i8080_inx,
-	[0x14] = i8080_inr,    [0x15] = i8080_dcr,    [0x16] = i8080_mvi,    [0x17] = i8080_ral,
-	[0x18] = NULL,         [0x19] = i8080_dad,    [0x1a] = i8080_ldax,   [0x1b] = i8080_dcx,
-	[0x1c] = i8080_inr,    [0x1d] = i8080_dcr,    [0x1e] = i8080_mvi,    [0x1f] = i8080_rar,
-	[0x20] = NULL,         [0x21] = i8080_lxi,    [0x22] = i8080_shld,   [0x23] = i8080_inx,
-	[0x24] = i8080_inr,    [0x25] = i8080_dcr,    [0x26] = i8080_mvi,    [0x27] = i8080_daa,
-	[0x28] = NULL,         [0x29] = i8080_dad,    [0x2a] = i8080_lhld,   [0x2b] = i8080_dcx,
-	[0x2c] = i8080_inr,    [0x2d] = i8080_dcr,    [0x2e] = i8080_mvi,    [0x2f] = i8080_cma,
-	[0x30] = NULL,         [0x31] = i8080_lxi,    [0x32] = i8080_sta,    [0x33] = i8080_inx,
-	[0x34] = i8080_inr,    [0x35] = i8080_dcr,    [0x36] = i8080_mvi,    [0x37] = i8080_stc,
-	[0x38] = NULL,         [0x39] = i8080_dad,    [0x3a] = i8080_lda,    [0x3b] = i8080_dcx,
-	[0x3c] = i8080_inr,    [0x3d] = i8080_dcr,    [0x3e] = i8080_mvi,    [0x3f] = i8080_cmc,
-	[0x40] = i8080_mov,    [0x41] = i8080_mov,    [0x42] = i8080_mov,    [0x43] = i8080_mov,
-	[0x44] = i8080_mov,    [0x45] = i8080_mov,    [0x46] = i8080_mov,    [0x47] = i8080_mov,
-	[0x48] = i8080_mov,    [0x49] = i8080_mov,    [0x4a] = i8080_mov,    [0x4b] = i8080_mov,
-	[0x4c] = i8080_mov,    [0x4d] = i8080_mov,    [0x4e] = i8080_mov,    [0x4f] = i8080_mov,
-	[0x50] = i8080_mov,    [0x51] = i8080_mov,    [0x52] = i8080_mov,    [0x53] = i8080_mov,
-	[0x54] = i8080_mov,    [0x55] = i8080_mov,    [0x56] = i8080_mov,    [0x57] = i8080_mov,
-	[0x58] = i8080_mov,    [0x59] = i8080_mov,    [0x5a] = i8080_mov,    [0x5b] = i8080_mov,
-	[0x5c] = i8080_mov,    [0x5d] = i8080_mov,    [0x5e] = i8080_mov,    [0x5f] = i8080_mov,
-	[0x60] = i8080_mov,    [0x61] = i8080_mov,    [0x62] = i8080_mov,    [0x63] = i8080_mov,
-	[0x64] = i8080_mov,    [0x65] = i8080_mov,    [0x66] = i8080_mov,    [0x67] = i8080_mov,
-	[0x68] = i8080_mov,    [0x69] = i8080_mov,    [0x6a] = i8080_mov,    [0x6b] = i8080_mov,
-	[0x6c] = i8080_mov,    [0x6d] = i8080_mov,    [0x6e] = i8080_mov,    [0x6f] = i8080_mov,
-	[0x70] = i8080_mov,    [0x71] = i8080_mov,    [0x72] = i8080_mov,    [0x73] = i8080_mov,
-	[0x74] = i8080_mov,    [0x75] = i8080_mov,    [0x76] = NULL,         [0x77] = i8080_mov,
-	[0x78] = i8080_mov,    [0x79] = i8080_mov,    [0x7a] = i8080_mov,    [0x7b] = i8080_mov,
-	[0x7c] = i8080_mov,    [0x7d] = i8080_mov,    [0x7e] = i8080_mov,    [0x7f] = i8080_mov,
-	[0x80] = i8080_add,    [0x81] = i8080_add,    [0x82] = i8080_add,    [0x83] = i8080_add,
-	[0x84] = i8080_add,    [0x85] = i8080_add,    [0x86] = i8080_add,    [0x87] = i8080_add,
-	[0x88] = i8080_adc,    [0x89] = i8080_adc,    [0x8a] = i8080_adc,    [0x8b] = i8080_adc,
-	[0x8c] = i8080_adc,    [0x8d] = i8080_adc,    [0x8e] = i8080_adc,    [0x8f] = i8080_adc,
-	[0x90] = i8080_sub,    [0x91] = i8080_sub,    [0x92] = i8080_sub,    [0x93] = i8080_sub,
-	[0x94] = i8080_sub,    [0x95] = i8080_sub,    [0x96] = i8080_sub,    [0x97] = i8080_sub,
-	[0x98] = i8080_sbb,    [0x99] = i8080_sbb,    [0x9a] = i8080_sbb,    [0x9b] = i8080_sbb,
-	[0x9c] = i8080_sbb,    [0x9d] = i8080_sbb,    [0x9e] = i8080_sbb,    [0x9f] = i8080_sbb,
-	[0xa0] = i8080_ana,    [0xa1] = i8080_ana,    [0xa2] = i8080_ana,    [0xa3] = i8080_ana,
-	[0xa4] = i8080_ana,    [0xa5] = i8080_ana,    [0xa6] = i8080_ana,    [0xa7] = i8080_ana,
-	[0xa8] = i8080_xra,    [0xa9] = i8080_xra,    [0xaa] = i8080_xra,    [0xab] = i8080_xra,
-	[0xac] = i8080_xra,    [0xad] = i8080_xra,    [0xae] = i8080_xra,    [0xaf] = i8080_xra,
-	[0xb0] = i8080_ora,    [0xb1] = i8080_ora,    [0xb2] = i8080_ora,    [0xb3] = i8080_ora,
-	[0xb4] = i8080_ora,    [0xb5] = i8080_ora,    [0xb6] = i8080_ora,    [0xb7] = i8080_ora,
-	[0xb8] = i8080_cmp,    [0xb9] = i8080_cmp,    [0xba] = i8080_cmp,    [0xbb] = i8080_cmp,
-	[0xbc] = i8080_cmp,    [0xbd] = i8080_cmp,    [0xbe] = i8080_cmp,    [0xbf] = i8080_cmp,
-	[0xc0] = i8080_rccc,   [0xc1] = i8080_pop,    [0xc2] = i8080_jccc,   [0xc3] = i8080_jmp,
-	[0xc4] = i8080_cccc,   [0xc5] = i8080_push,   [0xc6] = i8080_adi,    [0xc7] = i8080_rst,
-	[0xc8] = i8080_rccc,   [0xc9] = i8080_ret,    [0xca] = i8080_jccc,   [0xcb] = NULL,
-	[0xcc] = i8080_cccc,   [0xcd] = i8080_call,   [0xce] = i8080_aci,    [0xcf] = i8080_rst,
-	[0xd0] = i8080_rccc,   [0xd1] = i8080_pop,    [0xd2] = i8080_jccc,   [0xd3] = i8080_out,
-	[0xd4] = i8080_cccc,   [0xd5] = i8080_push,   [0xd6] = i8080_sui,    [0xd7] = i8080_rst,
-	[0xd8] = i8080_rccc,   [0xd9] = NULL,         [0xda] = i8080_jccc,   [0xdb] = i8080_in,
-	[0xdc] = i8080_cccc,   [0xdd] = NULL,         [0xde] = i8080_sbi,    [0xdf] = i8080_rst,
-	[0xe0] = i8080_rccc,   [0xe1] = i8080_pop,    [0xe2] = i8080_jccc,   [0xe3] = i8080_xthl,
-	[0xe4] = i8080_cccc,   [0xe5] = i8080_push,   [0xe6] = i8080_ani,    [0xe7] = i8080_rst,
-	[0xe8] = i8080_rccc,   [0xe9] = i8080_pchl,   [0xea] = i8080_jccc,   [0xeb] = i8080_xchg,
-	[0xec] = i8080_cccc,   [0xed] = NULL,         [0xee] = i8080_xri,    [0xef] = i8080_rst,
-	[0xf0] = i8080_rccc,   [0xf1] = i8080_pop,    [0xf2] = i8080_jccc,   [0xf3] = i8080_di,
-	[0xf4] = i8080_cccc,   [0xf5] = i8080_push,   [0xf6] = i8080_ori,    [0xf7] = i8080_rst,
-	[0xf8] = i8080_rccc,   [0xf9] = i8080_sphl,   [0xfa] = i8080_jccc,   [0xfb] = i8080_ei,
-	[0xfc] = i8080_cccc,   [0xfd] = NULL,         [0xfe] = i8080_cpi,    [0xff] = i8080_rst
-};
-
-void i8080_reset(intel8080_t *cpu, port_in in, port_out out, read_sense_switches sense,
-			 disk_controller_t *disk_controller, io_port_in_fn io_in, io_port_out_fn io_out)
+void i8080_reset(intel8080_t *cpu, uint8_t *memory)
 {
 	memset(cpu, 0, sizeof(intel8080_t));
-	cpu->term_in = in;
-	cpu->term_out = out;
-	cpu->io_port_in_handler = io_in;
-	cpu->io_port_out_handler = io_out;
-	cpu->disk_controller = *disk_controller;
+	cpu->memory = memory;
 	cpu->registers.flags = 0x2;
-	cpu->sense = sense;
 	cpu->cpuStatus = 0x00;
 }
 
@@ -222,148 +164,41 @@ static inline void i8080_clear_flag(intel8080_t *cpu, uint8_t flag)
 static inline void i8080_mwrite(intel8080_t *cpu)
 {
 	cpu->cpuStatus &= ~(STATUS_MEMORY_READ);
-	write8(cpu->address_bus, cpu->data_bus);
+	write8(cpu->memory, cpu->address_bus, cpu->data_bus);
 }
 
 static inline void i8080_mread(intel8080_t *cpu)
 {
 	cpu->cpuStatus |= STATUS_MEMORY_READ;
-	cpu->data_bus = read8(cpu->address_bus);
-}
-
-static inline void i8080_pairwrite(intel8080_t *cpu, uint8_t pair, uint16_t val)
-{
-	cpu->cpuStatus &= ~(STATUS_MEMORY_READ);
-	switch(pair)
-	{
-	case PAIR_BC:
-		cpu->registers.bc = val;
-		break;
-	case PAIR_DE:
-		cpu->registers.de = val;
-		break;
-	case PAIR_HL:
-		cpu->registers.hl = val;
-		break;
-	case PAIR_SP:
-		cpu->registers.sp = val;
-		break;
-	}
-}
-
-static inline uint16_t i8080_pairread(intel8080_t *cpu, uint8_t pair)
-{
-	cpu->cpuStatus |= STATUS_MEMORY_READ;
-	switch(pair)
-	{
-	case PAIR_BC:
-		return cpu->registers.bc;
-	case PAIR_DE:
-		return cpu->registers.de;
-	case PAIR_HL:
-		return cpu->registers.hl;
-	case PAIR_SP:
-		return cpu->registers.sp;
-	default:
-		return 0;
-	}
-}
-
-static inline void i8080_regwrite(intel8080_t *cpu, uint8_t reg, uint8_t val)
-{
-	switch(reg)
-	{
-	case REGISTER_A:
-		cpu->registers.a = val;
-		break;
-	case REGISTER_B:
-		cpu->registers.b = val;
-		break;
-	case REGISTER_C:
-		cpu->registers.c = val;
-		break;
-	case REGISTER_D:
-		cpu->registers.d = val;
-		break;
-	case REGISTER_E:
-		cpu->registers.e = val;
-		break;
-	case REGISTER_H:
-		cpu->registers.h = val;
-		break;
-	case REGISTER_L:
-		cpu->registers.l = val;
-		break;
-	case MEMORY_ACCESS:
-		cpu->address_bus = cpu->registers.hl;
-		cpu->data_bus = val;
-		i8080_mwrite(cpu);
-		break;
-	}
+	cpu->data_bus = read8(cpu->memory, cpu->address_bus);
 }
 
-static inline uint8_t i8080_regread(intel8080_t *cpu, uint8_t reg)
+// (HL) operand access, with the bus and status side effects of a memory cycle
+static inline uint8_t i8080_read_hl(intel8080_t *cpu)
 {
-	switch(reg)
-	{
-	case REGISTER_A:
-		return cpu->registers.a;
-	case REGISTER_B:
-		return cpu->registers.b;
-	case REGISTER_C:
-		return cpu->registers.c;
-	case REGISTER_D:
-		return cpu->registers.d;
-	case REGISTER_E:
-		return cpu->registers.e;
-	case REGISTER_H:
-		return cpu->registers.h;
-	case REGISTER_L:
-		return cpu->registers.l;
-	case MEMORY_ACCESS:
-		cpu->address_bus = cpu->registers.hl;
-		i8080_mread(cpu);
-		return cpu->data_bus;
-	default:
-		return 0;
-	}
+	cpu->address_bus = cpu->registers.hl;
+	i8080_mread(cpu);
+	return cpu->data_bus;
 }
 
-uint8_t i8080_check_condition(intel8080_t *cpu, uint8_t condition)
+static inline void i8080_write_hl(intel8080_t *cpu, uint8_t val)
 {
-	switch(condition)
-	{
-	case CONDITION_NZ:
-		return !(cpu->registers.flags & FLAGS_ZERO);
-	case CONDITION_Z:
-		return (cpu->registers.flags & FLAGS_ZERO);
-	case CONDITION_NC:
-		return !(cpu->registers.flags & FLAGS_CARRY);
-	case CONDITION_C:
-		return (cpu->registers.flags & FLAGS_CARRY);
-	case CONDITION_PO:
-		return !(cpu->registers.flags & FLAGS_PARITY);
-	case CONDITION_PE:
-		return (cpu->registers.flags & FLAGS_PARITY);
-	case CONDITION_P:
-		return !(cpu->registers.flags & FLAGS_SIGN);
-	case CONDITION_M:
-		return (cpu->registers.flags & FLAGS_SIGN);
-	}
-	return 0;
+	cpu->address_bus = cpu->registers.hl;
+	cpu->data_bus = val;
+	i8080_mwrite(cpu);
 }
 
 void i8080_examine(intel8080_t *cpu, uint16_t address)
 {
 	// Jump to the supplied address
 	cpu->registers.pc = cpu->address_bus = address;
-	cpu->data_bus = read8(cpu->address_bus);
+	cpu->data_bus = read8(cpu->memory, cpu->address_bus);
 }
 
 void i8080_examine_next(intel8080_t *cpu)
 {
 	cpu->address_bus++;
-	cpu->data_bus = read8(cpu->address_bus);
+	cpu->data_bus = read8(cpu->memory, cpu->address_bus);
 }
 
 void i8080_deposit(intel8080_t *cpu, uint8_t data)
@@ -379,93 +214,190 @@ void i8080_deposit_next(intel8080_t *cpu, uint8_t data)
 	i8080_mwrite(cpu);
 }
 
-void i8080_update_flags(intel8080_t *cpu, uint8_t reg, uint8_t mask)
+#define ZSP_FLAGS	(FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY)
+#define ALU_FLAGS	(ZSP_FLAGS | FLAGS_CARRY | FLAGS_H)
+
+// H and CY for a + val. val is 9 bits wide when a carry-in has been folded in.
+static inline uint8_t i8080_add_carry_flags(uint8_t a, uint16_t val)
 {
-	uint8_t val = i8080_regread(cpu, reg);
-	
-	if (mask & FLAGS_PARITY) {
-		i8080_update_flag_bit(cpu, FLAGS_PARITY, get_parity_fast(val));
-	}
-	if (mask & FLAGS_ZERO) {
-		i8080_update_flag_bit(cpu, FLAGS_ZERO, val == 0);
-	}
-	if (mask & FLAGS_SIGN) {
-		i8080_update_flag_bit(cpu, FLAGS_SIGN, val & 0x80);
-	}
+	return half_carry_table[HALF_CARRY_INDEX(a, val)] | (((a + val) >> 8) & FLAGS_CARRY);
 }
 
-void i8080_gensub(intel8080_t *cpu, uint16_t val)
+static inline void i8080_set_zsp(intel8080_t *cpu, uint8_t val)
 {
-	uint16_t a, b;
-	// Subtract by adding with two-complement of val. Carry-flag meaning becomes inverted since we add.
-	a = cpu->registers.a;
-	b = 0x100 - val;
+	cpu->registers.flags = (cpu->registers.flags & ~ZSP_FLAGS) | zsp_table[val];
+}
 
-	i8080_update_flag_bit(cpu, FLAGS_H, CHECK_HALF_CARRY(a, b));
-	i8080_update_flag_bit(cpu, FLAGS_CARRY, !CHECK_CARRY(a, b));
+#if I8080_LAZY_FLAGS
+// Lazy flags: ALU handlers record their operands and result in cpu->lazy_flags
+// and leave registers.flags stale. A pending ADD/SUB owns H, CY, Z, S and P; a
+// pending ZSP owns only Z, S and P, with H and CY already live in the flags
+// register. Bits outside the five arithmetic flags (IF, bit 1) are always live.
+#define LAZY_FLAGS_NONE		0
+#define LAZY_FLAGS_ZSP		1
+#define LAZY_FLAGS_ADD		2
+#define LAZY_FLAGS_SUB		3
+
+// Fold a pending ADD/SUB into H and CY. Handlers that read or partly update H
+// or CY call this first.
+static inline void i8080_resolve_carry(intel8080_t *cpu)
+{
+	i8080_lazy_flags_t *lazy = &cpu->lazy_flags;
 
-	a += b;
-	cpu->registers.a = a & 0xff;
+	if (lazy->op >= LAZY_FLAGS_ADD) {
+		uint8_t carry_flags = i8080_add_carry_flags(lazy->a, lazy->val);
 
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
+		if (lazy->op == LAZY_FLAGS_SUB)
+			carry_flags ^= FLAGS_CARRY;
+		cpu->registers.flags = (cpu->registers.flags & ~(FLAGS_H | FLAGS_CARRY)) | carry_flags;
+		lazy->op = LAZY_FLAGS_ZSP;
+	}
 }
 
-void i8080_compare(intel8080_t *cpu, uint8_t val)
+// Bring registers.flags fully up to date
+static inline void i8080_sync_flags(intel8080_t *cpu)
 {
-	uint8_t tmp_a = cpu->registers.a;
-	i8080_gensub(cpu, val);
-	cpu->registers.a = tmp_a;
+	if (cpu->lazy_flags.op != LAZY_FLAGS_NONE) {
+		i8080_resolve_carry(cpu);
+		i8080_set_zsp(cpu, cpu->lazy_flags.result);
+		cpu->lazy_flags.op = LAZY_FLAGS_NONE;
+	}
 }
 
-static uint8_t i8080_mov(intel8080_t *cpu)
+// Drop pending state once a handler has written all five flags itself
+static inline void i8080_discard_flags(intel8080_t *cpu)
 {
-	uint8_t dest = DESTINATION(cpu->current_op_code);
-	uint8_t source = SOURCE(cpu->current_op_code);
-	uint8_t val;
-	uint8_t cycles;
-
-	if(dest == MEMORY_ACCESS || source == MEMORY_ACCESS)
-		cycles = CYCLES_MOV_MEM;
-	else
-		cycles = CYCLES_MOV_REG;
-
-	val = i8080_regread(cpu, source);
-	i8080_regwrite(cpu, dest, val);
-	cpu->registers.pc++;
-
-	return cycles;
+	cpu->lazy_flags.op = LAZY_FLAGS_NONE;
 }
 
-static uint8_t i8080_mvi(intel8080_t *cpu)
+// Callers must have written H and CY (or resolved them) first
+static inline void i8080_update_zsp(intel8080_t *cpu, uint8_t val)
 {
-	uint8_t dest = DESTINATION(cpu->current_op_code);
-	uint8_t cycles;
+	cpu->lazy_flags.op = LAZY_FLAGS_ZSP;
+	cpu->lazy_flags.result = val;
+}
 
-	if(dest == MEMORY_ACCESS)
-		cycles = CYCLES_MVI_MEM;
-	else
-		cycles = CYCLES_MVI_REG;
+static inline void i8080_defer_arith(intel8080_t *cpu, uint8_t op, uint16_t val)
+{
+	i8080_lazy_flags_t *lazy = &cpu->lazy_flags;
 
-	i8080_regwrite(cpu, dest, read8(cpu->registers.pc+1));
+	lazy->op = op;
+	lazy->a = cpu->registers.a;
+	lazy->val = val;
+	lazy->result = (uint8_t)(cpu->registers.a + val);
+}
+#else
+#define i8080_resolve_carry(cpu)		((void)0)
+#define i8080_sync_flags(cpu)			((void)0)
+#define i8080_discard_flags(cpu)		((void)0)
+#define i8080_update_zsp(cpu, val)		i8080_set_zsp(cpu, val)
+#endif
 
-	cpu->registers.pc+=2;
+void i8080_gensub(intel8080_t *cpu, uint16_t val)
+{
+	uint16_t a, b;
+	// Subtract by adding with two-complement of val. Carry-flag meaning becomes inverted since we add.
+	a = cpu->registers.a;
+	b = 0x100 - val;
 
-	return cycles;
+#if I8080_LAZY_FLAGS
+	i8080_defer_arith(cpu, LAZY_FLAGS_SUB, b);
+	cpu->registers.a = cpu->lazy_flags.result;
+	(void)a;
+#else
+	cpu->registers.flags = (cpu->registers.flags & ~ALU_FLAGS)
+		| (i8080_add_carry_flags(a, b) ^ FLAGS_CARRY) | zsp_table[(a + b) & 0xff];
+	cpu->registers.a = (a + b) & 0xff;
+#endif
 }
 
-static uint8_t i8080_lxi(intel8080_t *cpu)
+void i8080_compare(intel8080_t *cpu, uint8_t val)
 {
-	uint8_t pair = RP(cpu->current_op_code);
+	uint8_t tmp_a = cpu->registers.a;
+	i8080_gensub(cpu, val);
+	cpu->registers.a = tmp_a;
+}
 
-	i8080_pairwrite(cpu, pair, read16(cpu->registers.pc+1));
-	cpu->registers.pc+=3;
+// Operand lists for the register-field encodings. M is (HL) and is the only
+// operand that goes through memory.
+#define I8080_FOR_EACH_OPERAND(X, reg_cycles, mem_cycles) \
+	X(b, cpu->registers.b, reg_cycles) \
+	X(c, cpu->registers.c, reg_cycles) \
+	X(d, cpu->registers.d, reg_cycles) \
+	X(e, cpu->registers.e, reg_cycles) \
+	X(h, cpu->registers.h, reg_cycles) \
+	X(l, cpu->registers.l, reg_cycles) \
+	X(m, i8080_read_hl(cpu), mem_cycles) \
+	X(a, cpu->registers.a, reg_cycles)
+
+#define I8080_FOR_EACH_REGISTER(X) X(b) X(c) X(d) X(e) X(h) X(l) X(a)
+
+// MOV, one handler per encoding. MOV r,r is a plain byte copy.
+#define I8080_MOV(dst, src) \
+static uint8_t i8080_mov_##dst##_##src(intel8080_t *cpu) \
+{ \
+	cpu->registers.dst = cpu->registers.src; \
+	cpu->registers.pc++; \
+	return CYCLES_MOV_REG; \
+}
+
+#define I8080_MOV_FROM_M(dst) \
+static uint8_t i8080_mov_##dst##_m(intel8080_t *cpu) \
+{ \
+	cpu->registers.dst = i8080_read_hl(cpu); \
+	cpu->registers.pc++; \
+	return CYCLES_MOV_MEM; \
+}
+
+#define I8080_MOV_TO_M(src) \
+static uint8_t i8080_mov_m_##src(intel8080_t *cpu) \
+{ \
+	i8080_write_hl(cpu, cpu->registers.src); \
+	cpu->registers.pc++; \
+	return CYCLES_MOV_MEM; \
+}
+
+I8080_MOV(b, b) I8080_MOV(b, c) I8080_MOV(b, d) I8080_MOV(b, e) I8080_MOV(b, h) I8080_MOV(b, l) I8080_MOV(b, a)
+I8080_MOV(c, b) I8080_MOV(c, c) I8080_MOV(c, d) I8080_MOV(c, e) I8080_MOV(c, h) I8080_MOV(c, l) I8080_MOV(c, a)
+I8080_MOV(d, b) I8080_MOV(d, c) I8080_MOV(d, d) I8080_MOV(d, e) I8080_MOV(d, h) I8080_MOV(d, l) I8080_MOV(d, a)
+I8080_MOV(e, b) I8080_MOV(e, c) I8080_MOV(e, d) I8080_MOV(e, e) I8080_MOV(e, h) I8080_MOV(e, l) I8080_MOV(e, a)
+I8080_MOV(h, b) I8080_MOV(h, c) I8080_MOV(h, d) I8080_MOV(h, e) I8080_MOV(h, h) I8080_MOV(h, l) I8080_MOV(h, a)
+I8080_MOV(l, b) I8080_MOV(l, c) I8080_MOV(l, d) I8080_MOV(l, e) I8080_MOV(l, h) I8080_MOV(l, l) I8080_MOV(l, a)
+I8080_MOV(a, b) I8080_MOV(a, c) I8080_MOV(a, d) I8080_MOV(a, e) I8080_MOV(a, h) I8080_MOV(a, l) I8080_MOV(a, a)
+I8080_FOR_EACH_REGISTER(I8080_MOV_FROM_M)
+I8080_FOR_EACH_REGISTER(I8080_MOV_TO_M)
+
+#define I8080_MVI(dst) \
+static uint8_t i8080_mvi_##dst(intel8080_t *cpu) \
+{ \
+	cpu->registers.dst = I8080_IMM8(cpu); \
+	cpu->registers.pc+=2; \
+	return CYCLES_MVI_REG; \
+}
+
+I8080_FOR_EACH_REGISTER(I8080_MVI)
+
+static uint8_t i8080_mvi_m(intel8080_t *cpu)
+{
+	i8080_write_hl(cpu, I8080_IMM8(cpu));
+	cpu->registers.pc+=2;
+	return CYCLES_MVI_MEM;
+}
 
-	return CYCLES_LXI;
+#define I8080_LXI(rp) \
+static uint8_t i8080_lxi_##rp(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus &= ~(STATUS_MEMORY_READ); \
+	cpu->registers.rp = I8080_IMM16(cpu); \
+	cpu->registers.pc+=3; \
+	return CYCLES_LXI; \
 }
 
-uint8_t i8080_lda(intel8080_t *cpu)
+I8080_LXI(bc) I8080_LXI(de) I8080_LXI(hl) I8080_LXI(sp)
+
+static uint8_t i8080_lda(intel8080_t *cpu)
 {
-	cpu->address_bus = read16(cpu->registers.pc+1);
+	cpu->address_bus = I8080_IMM16(cpu);
 	i8080_mread(cpu);
 	cpu->registers.a = cpu->data_bus;
 
@@ -473,9 +405,9 @@ uint8_t i8080_lda(intel8080_t *cpu)
 	return CYCLES_LDA;
 }
 
-uint8_t i8080_sta(intel8080_t *cpu)
+static uint8_t i8080_sta(intel8080_t *cpu)
 {
-	cpu->address_bus = read16(cpu->registers.pc+1);
+	cpu->address_bus = I8080_IMM16(cpu);
 	cpu->data_bus = cpu->registers.a;
 	i8080_mwrite(cpu);
 
@@ -483,40 +415,43 @@ uint8_t i8080_sta(intel8080_t *cpu)
 	return CYCLES_STA;
 }
 
-uint8_t i8080_lhld(intel8080_t *cpu)
+static uint8_t i8080_lhld(intel8080_t *cpu)
 {
-	cpu->registers.hl = read16(read16(cpu->registers.pc+1));
+	cpu->registers.hl = read16(cpu->memory, I8080_IMM16(cpu));
 	cpu->registers.pc+=3;
 	return CYCLES_LHLD;
 }
 
-uint8_t i8080_shld(intel8080_t *cpu)
+static uint8_t i8080_shld(intel8080_t *cpu)
 {
-	write16(read16(cpu->registers.pc+1), cpu->registers.hl);
+	write16(cpu->memory, I8080_IMM16(cpu), cpu->registers.hl);
 	cpu->registers.pc+=3;
 	return CYCLES_SHLD;
 }
 
-// TODO: only BC and DE allowed for indirect
-uint8_t i8080_ldax(intel8080_t *cpu)
-{
-	uint8_t pair = RP(cpu->current_op_code);
-
-	cpu->registers.a = read8(i8080_pairread(cpu, pair));
-	cpu->registers.pc++;
-	return CYCLES_LDAX;
+// LDAX/STAX only encode BC and DE
+#define I8080_LDAX(rp) \
+static uint8_t i8080_ldax_##rp(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus |= STATUS_MEMORY_READ; \
+	cpu->registers.a = read8(cpu->memory, cpu->registers.rp); \
+	cpu->registers.pc++; \
+	return CYCLES_LDAX; \
 }
 
-// TODO: only BC and DE allowed for indirect
-uint8_t i8080_stax(intel8080_t *cpu)
-{
-	uint8_t pair = RP(cpu->current_op_code);
-	write8(i8080_pairread(cpu, pair), cpu->registers.a);
-	cpu->registers.pc++;
-	return CYCLES_STAX;
+#define I8080_STAX(rp) \
+static uint8_t i8080_stax_##rp(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus |= STATUS_MEMORY_READ; \
+	write8(cpu->memory, cpu->registers.rp, cpu->registers.a); \
+	cpu->registers.pc++; \
+	return CYCLES_STAX; \
 }
 
-uint8_t i8080_xchg(intel8080_t *cpu)
+I8080_LDAX(bc) I8080_LDAX(de)
+I8080_STAX(bc) I8080_STAX(de)
+
+static uint8_t i8080_xchg(intel8080_t *cpu)
 {
 	uint16_t tmp = cpu->registers.hl;
 	cpu->registers.hl = cpu->registers.de;
@@ -530,47 +465,54 @@ void i8080_genadd(intel8080_t *cpu, uint16_t val)
 {
 	uint8_t a = cpu->registers.a;
 
-	i8080_update_flag_bit(cpu, FLAGS_H, CHECK_HALF_CARRY(a, val));
-	i8080_update_flag_bit(cpu, FLAGS_CARRY, CHECK_CARRY(a, val));
-
+#if I8080_LAZY_FLAGS
+	i8080_defer_arith(cpu, LAZY_FLAGS_ADD, val);
+	cpu->registers.a = cpu->lazy_flags.result;
+	(void)a;
+#else
+	cpu->registers.flags = (cpu->registers.flags & ~ALU_FLAGS)
+		| i8080_add_carry_flags(a, val) | zsp_table[(a + val) & 0xff];
 	cpu->registers.a += val;
-
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
+#endif
 }
 
 
-uint8_t i8080_add(intel8080_t *cpu)
-{
-	uint8_t source = SOURCE(cpu->current_op_code);
-	uint8_t val = i8080_regread(cpu, source);
-	i8080_genadd(cpu, val);
-	cpu->registers.pc++;
-	return CYCLES_ADD;
+#define I8080_ADD(name, operand, cycles) \
+static uint8_t i8080_add_##name(intel8080_t *cpu) \
+{ \
+	i8080_genadd(cpu, operand); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_adi(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_ADD, CYCLES_ADD, CYCLES_ALU_MEM)
+
+static uint8_t i8080_adi(intel8080_t *cpu)
 {
-	i8080_genadd(cpu, read8(cpu->registers.pc+1));
+	i8080_genadd(cpu, I8080_IMM8(cpu));
 	cpu->registers.pc+=2;
 	return CYCLES_ADI;
 }
 
-uint8_t i8080_adc(intel8080_t *cpu)
-{
-	uint8_t source = SOURCE(cpu->current_op_code);
-	uint16_t val = i8080_regread(cpu, source);
-
-	if(cpu->registers.flags & FLAGS_CARRY)
-		val++;
-	i8080_genadd(cpu, val);
-	cpu->registers.pc++;
-	return CYCLES_ADC;
+#define I8080_ADC(name, operand, cycles) \
+static uint8_t i8080_adc_##name(intel8080_t *cpu) \
+{ \
+	uint16_t val = operand; \
+	i8080_resolve_carry(cpu); \
+	if(cpu->registers.flags & FLAGS_CARRY) \
+		val++; \
+	i8080_genadd(cpu, val); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_aci(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_ADC, CYCLES_ADC, CYCLES_ALU_MEM)
+
+static uint8_t i8080_aci(intel8080_t *cpu)
 {
 	uint16_t val;
-	val = read8(cpu->registers.pc+1);
+	val = I8080_IMM8(cpu);
+	i8080_resolve_carry(cpu);
 	if(cpu->registers.flags & FLAGS_CARRY)
 		val++;
 	i8080_genadd(cpu, val);
@@ -578,39 +520,42 @@ uint8_t i8080_aci(intel8080_t *cpu)
 	return CYCLES_ACI;
 }
 
-uint8_t i8080_sub(intel8080_t *cpu)
-{
-	uint8_t source = SOURCE(cpu->current_op_code);
-	uint8_t val = i8080_regread(cpu, source);
-	i8080_gensub(cpu, val);
-	cpu->registers.pc++;
-	return CYCLES_SUB;
+#define I8080_SUB(name, operand, cycles) \
+static uint8_t i8080_sub_##name(intel8080_t *cpu) \
+{ \
+	i8080_gensub(cpu, operand); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_sui(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_SUB, CYCLES_SUB, CYCLES_ALU_MEM)
+
+static uint8_t i8080_sui(intel8080_t *cpu)
 {
-	i8080_gensub(cpu, read8(cpu->registers.pc+1));
+	i8080_gensub(cpu, I8080_IMM8(cpu));
 	cpu->registers.pc+=2;
 	return CYCLES_SUI;
 }
 
-uint8_t i8080_sbb(intel8080_t *cpu)
-{
-	uint8_t source = SOURCE(cpu->current_op_code);
-	uint16_t val = i8080_regread(cpu, source);
-
-	if(cpu->registers.flags & FLAGS_CARRY)
-		val++;
-
-	i8080_gensub(cpu, val);
-	cpu->registers.pc++;
-	return CYCLES_SBB;
+#define I8080_SBB(name, operand, cycles) \
+static uint8_t i8080_sbb_##name(intel8080_t *cpu) \
+{ \
+	uint16_t val = operand; \
+	i8080_resolve_carry(cpu); \
+	if(cpu->registers.flags & FLAGS_CARRY) \
+		val++; \
+	i8080_gensub(cpu, val); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_sbi(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_SBB, CYCLES_SBB, CYCLES_ALU_MEM)
+
+static uint8_t i8080_sbi(intel8080_t *cpu)
 {
 	uint16_t val;
-	val = read8(cpu->registers.pc+1);
+	val = I8080_IMM8(cpu);
+	i8080_resolve_carry(cpu);
 	if(cpu->registers.flags & FLAGS_CARRY)
 		val++;
 	i8080_gensub(cpu, val);
@@ -618,312 +563,329 @@ uint8_t i8080_sbi(intel8080_t *cpu)
 	return CYCLES_SBI;
 }
 
-uint8_t i8080_inr(intel8080_t *cpu)
+// INR/DCR set S, Z, P and H from a single table entry and leave CY alone
+static inline void i8080_set_zsph(intel8080_t *cpu, uint8_t flags)
 {
-	uint8_t dest = DESTINATION(cpu->current_op_code);
-	uint8_t val = i8080_regread(cpu, dest);
-
-	i8080_update_flag_bit(cpu, FLAGS_H, CHECK_HALF_CARRY(val, 1));
-
-	i8080_regwrite(cpu, dest, val + 1);
+	cpu->registers.flags = (cpu->registers.flags & ~(ZSP_FLAGS | FLAGS_H)) | flags;
+	i8080_discard_flags(cpu);
+}
 
-	i8080_update_flags(cpu, dest, FLAGS_ZERO | FLAGS_PARITY | FLAGS_SIGN | FLAGS_H);
-	cpu->registers.pc++;
-	return CYCLES_INR;
+#define I8080_INR(dst) \
+static uint8_t i8080_inr_##dst(intel8080_t *cpu) \
+{ \
+	uint8_t val = cpu->registers.dst + 1; \
+	i8080_resolve_carry(cpu); \
+	i8080_set_zsph(cpu, inr_flags_table[val]); \
+	cpu->registers.dst = val; \
+	cpu->registers.pc++; \
+	return CYCLES_INR; \
 }
 
-uint8_t i8080_dcr(intel8080_t *cpu)
-{
-	uint8_t dest = DESTINATION(cpu->current_op_code);
-	uint8_t val = i8080_regread(cpu, dest);
+I8080_FOR_EACH_REGISTER(I8080_INR)
 
-	i8080_update_flag_bit(cpu, FLAGS_H, CHECK_HALF_CARRY(val, 0xff));
+static uint8_t i8080_inr_m(intel8080_t *cpu)
+{
+	uint8_t val = i8080_read_hl(cpu);
 
-	i8080_regwrite(cpu, dest, val + 0xff);
-	i8080_update_flags(cpu, dest, FLAGS_ZERO | FLAGS_PARITY | FLAGS_SIGN | FLAGS_H);
+	i8080_resolve_carry(cpu);
+	i8080_write_hl(cpu, val + 1);
+	i8080_set_zsph(cpu, inr_flags_table[i8080_read_hl(cpu)]);
 	cpu->registers.pc++;
-	return CYCLES_DCR;
+	return CYCLES_INR_MEM;
 }
 
-uint8_t i8080_inx(intel8080_t *cpu)
-{
-	uint8_t rp = RP(cpu->current_op_code);
-	i8080_pairwrite(cpu, rp, i8080_pairread(cpu, rp) + 1);
-	cpu->registers.pc++;
-	return CYCLES_INX;
+#define I8080_DCR(dst) \
+static uint8_t i8080_dcr_##dst(intel8080_t *cpu) \
+{ \
+	uint8_t val = cpu->registers.dst - 1; \
+	i8080_resolve_carry(cpu); \
+	i8080_set_zsph(cpu, dcr_flags_table[val]); \
+	cpu->registers.dst = val; \
+	cpu->registers.pc++; \
+	return CYCLES_DCR; \
 }
 
-uint8_t i8080_dcx(intel8080_t *cpu)
+I8080_FOR_EACH_REGISTER(I8080_DCR)
+
+static uint8_t i8080_dcr_m(intel8080_t *cpu)
 {
-	uint8_t rp = RP(cpu->current_op_code);
+	uint8_t val = i8080_read_hl(cpu);
+
+	i8080_resolve_carry(cpu);
+	i8080_write_hl(cpu, val + 0xff);
+	i8080_set_zsph(cpu, dcr_flags_table[i8080_read_hl(cpu)]);
 	cpu->registers.pc++;
-	i8080_pairwrite(cpu, rp, i8080_pairread(cpu, rp) - 1);
-	return CYCLES_DCX;
+	return CYCLES_DCR_MEM;
 }
 
-uint8_t i8080_dad(intel8080_t *cpu)
-{
-	uint8_t rp = RP(cpu->current_op_code);
-	uint32_t val = i8080_pairread(cpu, rp);
-	val += i8080_pairread(cpu, PAIR_HL);
+#define I8080_INX(rp) \
+static uint8_t i8080_inx_##rp(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus &= ~(STATUS_MEMORY_READ); \
+	cpu->registers.rp++; \
+	cpu->registers.pc++; \
+	return CYCLES_INX; \
+}
 
-	if(val > 0xffff)
-		i8080_set_flag(cpu, FLAGS_CARRY);
-	else
-		i8080_clear_flag(cpu, FLAGS_CARRY);
+I8080_INX(bc) I8080_INX(de) I8080_INX(hl) I8080_INX(sp)
 
-	i8080_pairwrite(cpu, PAIR_HL, val & 0xffff);
+#define I8080_DCX(rp) \
+static uint8_t i8080_dcx_##rp(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus &= ~(STATUS_MEMORY_READ); \
+	cpu->registers.rp--; \
+	cpu->registers.pc++; \
+	return CYCLES_DCX; \
+}
 
-	cpu->registers.pc++;
+I8080_DCX(bc) I8080_DCX(de) I8080_DCX(hl) I8080_DCX(sp)
 
-	return CYCLES_DAD;
+#define I8080_DAD(rp) \
+static uint8_t i8080_dad_##rp(intel8080_t *cpu) \
+{ \
+	uint32_t val = (uint32_t)cpu->registers.rp + cpu->registers.hl; \
+	i8080_resolve_carry(cpu); \
+	i8080_update_flag_bit(cpu, FLAGS_CARRY, val > 0xffff); \
+	cpu->cpuStatus &= ~(STATUS_MEMORY_READ); \
+	cpu->registers.hl = val & 0xffff; \
+	cpu->registers.pc++; \
+	return CYCLES_DAD; \
 }
 
-uint8_t i8080_ana(intel8080_t *cpu)
-{
-	uint8_t source = SOURCE(cpu->current_op_code);
-
-	cpu->registers.a &= i8080_regread(cpu, source);
-	i8080_clear_flag(cpu, FLAGS_CARRY);
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
+I8080_DAD(bc) I8080_DAD(de) I8080_DAD(hl) I8080_DAD(sp)
 
-	cpu->registers.pc++;
-	return CYCLES_ANA;
+// ANA leaves the auxiliary carry alone; ORA and XRA clear it
+#define I8080_ANA(name, operand, cycles) \
+static uint8_t i8080_ana_##name(intel8080_t *cpu) \
+{ \
+	cpu->registers.a &= operand; \
+	i8080_resolve_carry(cpu); \
+	i8080_clear_flag(cpu, FLAGS_CARRY); \
+	i8080_update_zsp(cpu, cpu->registers.a); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_ani(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_ANA, CYCLES_ANA, CYCLES_ALU_MEM)
+
+static uint8_t i8080_ani(intel8080_t *cpu)
 {
-	cpu->registers.a &= read8(cpu->registers.pc+1);
+	cpu->registers.a &= I8080_IMM8(cpu);
 	i8080_clear_flag(cpu, FLAGS_CARRY);
 	i8080_clear_flag(cpu, FLAGS_H);
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
+	i8080_update_zsp(cpu, cpu->registers.a);
 
 	cpu->registers.pc+=2;
 	return CYCLES_ANI;
 }
 
-uint8_t i8080_ora(intel8080_t *cpu)
-{
-	uint8_t source = SOURCE(cpu->current_op_code);
-
-	cpu->registers.a |= i8080_regread(cpu, source);
-	i8080_clear_flag(cpu, FLAGS_CARRY);
-	i8080_clear_flag(cpu, FLAGS_H);
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
-
-	cpu->registers.pc++;
-	return CYCLES_ORA;
+#define I8080_ORA(name, operand, cycles) \
+static uint8_t i8080_ora_##name(intel8080_t *cpu) \
+{ \
+	cpu->registers.a |= operand; \
+	i8080_clear_flag(cpu, FLAGS_CARRY); \
+	i8080_clear_flag(cpu, FLAGS_H); \
+	i8080_update_zsp(cpu, cpu->registers.a); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_ori(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_ORA, CYCLES_ORA, CYCLES_ALU_MEM)
+
+static uint8_t i8080_ori(intel8080_t *cpu)
 {
-	cpu->registers.a |= read8(cpu->registers.pc+1);
+	cpu->registers.a |= I8080_IMM8(cpu);
 	i8080_clear_flag(cpu, FLAGS_CARRY);
 	i8080_clear_flag(cpu, FLAGS_H);
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
+	i8080_update_zsp(cpu, cpu->registers.a);
 
 	cpu->registers.pc+=2;
 	return CYCLES_ORI;
 }
 
-uint8_t i8080_xra(intel8080_t *cpu)
-{
-	uint8_t source = SOURCE(cpu->current_op_code);
-
-	cpu->registers.a ^= i8080_regread(cpu, source);
-	i8080_clear_flag(cpu, FLAGS_CARRY);
-	i8080_clear_flag(cpu, FLAGS_H);
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
-
-	cpu->registers.pc++;
-	return CYCLES_XRA;
+#define I8080_XRA(name, operand, cycles) \
+static uint8_t i8080_xra_##name(intel8080_t *cpu) \
+{ \
+	cpu->registers.a ^= operand; \
+	i8080_clear_flag(cpu, FLAGS_CARRY); \
+	i8080_clear_flag(cpu, FLAGS_H); \
+	i8080_update_zsp(cpu, cpu->registers.a); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_xri(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_XRA, CYCLES_XRA, CYCLES_ALU_MEM)
+
+static uint8_t i8080_xri(intel8080_t *cpu)
 {
-	cpu->registers.a ^= read8(cpu->registers.pc+1);
+	cpu->registers.a ^= I8080_IMM8(cpu);
 	i8080_clear_flag(cpu, FLAGS_CARRY);
 	i8080_clear_flag(cpu, FLAGS_H);
-	i8080_update_flags(cpu, REGISTER_A, FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY | FLAGS_H);
+	i8080_update_zsp(cpu, cpu->registers.a);
 
 	cpu->registers.pc+=2;
 	return CYCLES_XRI;
 }
 
-uint8_t i8080_ei(intel8080_t *cpu)
+static uint8_t i8080_ei(intel8080_t *cpu)
 {
 	cpu->registers.pc++;
 	i8080_set_flag(cpu, FLAGS_IF);
+	cpu->ei_delay = 1;
 	return CYCLES_EI;
 }
 
-uint8_t i8080_di(intel8080_t *cpu)
+static uint8_t i8080_di(intel8080_t *cpu)
 {
 	cpu->registers.pc++;
 	i8080_clear_flag(cpu, FLAGS_IF);
 	return CYCLES_DI;
 }
 
-uint8_t i8080_xthl(intel8080_t *cpu)
+static uint8_t i8080_xthl(intel8080_t *cpu)
 {
-	uint16_t temp = read16(cpu->registers.sp);
+	uint16_t temp = read16(cpu->memory, cpu->registers.sp);
 
-	write16(cpu->registers.sp, cpu->registers.hl);
+	write16(cpu->memory, cpu->registers.sp, cpu->registers.hl);
 	cpu->registers.hl = temp;
 	cpu->registers.pc++;
 	return CYCLES_XTHL;
 }
 
-uint8_t i8080_sphl(intel8080_t *cpu)
+static uint8_t i8080_sphl(intel8080_t *cpu)
 {
 	cpu->registers.sp = cpu->registers.hl;
 	cpu->registers.pc++;
 	return CYCLES_SPHL;
 }
 
-uint8_t i8080_in(intel8080_t *cpu)
+// Console idle detection. CP/M's CONST/CONIN loops read an empty console
+// port back to back. CONSOLE_IDLE_POLLS empty reads in a row, from within
+// CONSOLE_IDLE_PC_WINDOW bytes of the first one and each at most
+// CONSOLE_IDLE_GAP T-states after the last, mark the console idle. The gap
+// keeps programs that check for ^C between real work (MBASIC) running at
+// full speed; any other I/O starts the count again.
+#define CONSOLE_IDLE_POLLS		64
+#define CONSOLE_IDLE_PC_WINDOW	32
+#define CONSOLE_IDLE_GAP		400
+
+void i8080_console_poll(intel8080_t *cpu, bool empty)
 {
-	static uint8_t character = 0;
-	uint8_t port = read8(cpu->registers.pc + 1);
+	uint16_t pc = cpu->registers.pc;
 
-	switch(port)
-	{
-	case 0x00:
-		cpu->registers.a = 0x00;
-		break;
-	case 0x1:
-		cpu->cpuStatus |= STATUS_PORT_INPUT;
-		cpu->registers.a = cpu->term_in();
-		// cpu->term_out(cpu->registers.a);
-		break;
-	case 0x8:
-		cpu->registers.a = cpu->disk_controller.disk_status();
-		break;
-	case 0x9:
-		cpu->registers.a = cpu->disk_controller.sector();
-		break;
-	case 0xa:
-		cpu->registers.a = cpu->disk_controller.read();
-		break;
-	case 0x10: // 2SIO port 1, status
-		cpu->registers.a = 0x2; // bit 1 == transmit buffer empty
-		if(!character)
-		{
-			character = cpu->term_in();
-		}
-		if(character)
-		{
-			cpu->registers.a |= 0x1;
-		}
-		break;
-	case 0x11: // 2SIO port 1, read
-		if(character)
-		{
-			cpu->registers.a = character;
-			character = 0;
-		}
+	cpu->console_polled = true;
+	if (empty && cpu->idle_polls > 0 &&
+		(uint16_t)(pc - cpu->idle_poll_pc + CONSOLE_IDLE_PC_WINDOW) <= 2 * CONSOLE_IDLE_PC_WINDOW &&
+		cpu->cycles - cpu->idle_poll_cycles <= CONSOLE_IDLE_GAP) {
+		if (cpu->idle_polls < CONSOLE_IDLE_POLLS)
+			cpu->idle_polls++;
 		else
-		{
-			cpu->registers.a = cpu->term_in();
-		}
-		break;
-	case 0xff: // Front panel switches
-		cpu->registers.a = cpu->sense();
-		break;
-	default:
-		cpu->registers.a = 0xff;
-		cpu->registers.a = cpu->io_port_in_handler(port);
-		//printf("IN PORT %x\n", cpu->data_bus);
-		break;
+			cpu->console_idle = true;
+	} else {
+		cpu->idle_polls = empty ? 1 : 0;
+		cpu->idle_poll_pc = pc;
 	}
+	cpu->idle_poll_cycles = cpu->cycles;
+}
+
+void i8080_console_status(intel8080_t *cpu)
+{
+	cpu->console_polled = true;
+}
+
+// IN and OUT are one indexed call into the port table (io_ports.h)
+static uint8_t i8080_in(intel8080_t *cpu)
+{
+	uint8_t port = read8(cpu->memory, cpu->registers.pc + 1);
+
+	cpu->cpuStatus |= STATUS_PORT_INPUT;
+	cpu->console_polled = false;
+	cpu->registers.a = io_port_in(port);
+	if (!cpu->console_polled)
+		cpu->idle_polls = 0;
 
 	cpu->registers.pc+=2;
 	return CYCLES_IN;
 }
 
-uint8_t i8080_out(intel8080_t *cpu)
+static uint8_t i8080_out(intel8080_t *cpu)
 {
-	uint8_t port = read8(cpu->registers.pc + 1);
-	switch(port)
-	{
-	case 0x1:
-		cpu->cpuStatus |= STATUS_PORT_OUTPUT;
-		cpu->term_out(cpu->registers.a);
-		break;
-	case 0x8:
-		cpu->disk_controller.disk_select(cpu->registers.a);
-		break;
-	case 0x9:
-		cpu->disk_controller.disk_function(cpu->registers.a);
-		break;
-	case 0xa:
-		cpu->disk_controller.write(cpu->registers.a);
-		break;
-	case 0x10:  // 2SIO port 1 control
-		break;
-	case 0x11: // 2sio port 1 write
-		cpu->term_out(cpu->registers.a);
-		break;
-	default:
-		cpu->io_port_out_handler(port, cpu->registers.a);
-		// printf("OUT PORT %x, DATA: %x\n", read8(cpu->registers.pc + 1), cpu->registers.a);
-		break;
-	}
+	uint8_t port = read8(cpu->memory, cpu->registers.pc + 1);
+
+	cpu->cpuStatus |= STATUS_PORT_OUTPUT;
+	cpu->idle_polls = 0;
+	io_port_out(port, cpu->registers.a);
+
 	cpu->registers.pc+=2;
 	return CYCLES_OUT;
 }
 
-uint8_t i8080_push(intel8080_t *cpu)
-{
-	cpu->cpuStatus |= STATUS_STACK;
-	uint8_t pair = RP(cpu->current_op_code);
-	uint16_t val;
+#define I8080_PUSH(rp) \
+static uint8_t i8080_push_##rp(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus |= STATUS_STACK | STATUS_MEMORY_READ; \
+	cpu->registers.sp-=2; \
+	write16(cpu->memory, cpu->registers.sp, cpu->registers.rp); \
+	cpu->registers.pc++; \
+	return CYCLES_PUSH; \
+}
 
-	if(pair == PAIR_SP)
-		val = cpu->registers.af;
-	else
-		val = i8080_pairread(cpu, pair);
+I8080_PUSH(bc) I8080_PUSH(de) I8080_PUSH(hl)
 
+static uint8_t i8080_push_psw(intel8080_t *cpu)
+{
+	cpu->cpuStatus |= STATUS_STACK;
+	i8080_sync_flags(cpu);
 	cpu->registers.sp-=2;
-	write16(cpu->registers.sp, val);
-
+	write16(cpu->memory, cpu->registers.sp, cpu->registers.af);
 	cpu->registers.pc++;
 	return CYCLES_PUSH;
 }
 
-uint8_t i8080_pop(intel8080_t *cpu)
+#define I8080_POP(rp) \
+static uint8_t i8080_pop_##rp(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus |= STATUS_STACK; \
+	cpu->cpuStatus &= ~(STATUS_MEMORY_READ); \
+	cpu->registers.rp = read16(cpu->memory, cpu->registers.sp); \
+	cpu->registers.sp+=2; \
+	cpu->registers.pc++; \
+	return CYCLES_POP; \
+}
+
+I8080_POP(bc) I8080_POP(de) I8080_POP(hl)
+
+static uint8_t i8080_pop_psw(intel8080_t *cpu)
 {
 	cpu->cpuStatus |= STATUS_STACK;
-	uint8_t pair = RP(cpu->current_op_code);
-	uint16_t val = read16(cpu->registers.sp);
+	cpu->registers.af = read16(cpu->memory, cpu->registers.sp);
+	i8080_discard_flags(cpu);
 	cpu->registers.sp+=2;
-	if(pair == PAIR_SP)
-		cpu->registers.af = val;
-	else
-		i8080_pairwrite(cpu, pair, val);
-
 	cpu->registers.pc++;
 	return CYCLES_POP;
 }
 
-uint8_t i8080_stc(intel8080_t *cpu)
+static uint8_t i8080_stc(intel8080_t *cpu)
 {
+	i8080_resolve_carry(cpu);
 	i8080_set_flag(cpu, FLAGS_CARRY);
 	cpu->registers.pc++;
 	return CYCLES_STC;
 }
 
-uint8_t i8080_cmc(intel8080_t *cpu)
+static uint8_t i8080_cmc(intel8080_t *cpu)
 {
+	i8080_resolve_carry(cpu);
 	cpu->registers.flags ^= FLAGS_CARRY;
 	cpu->registers.pc++;
 	return CYCLES_CMC;
 }
 
-uint8_t i8080_rlc(intel8080_t *cpu)
+static uint8_t i8080_rlc(intel8080_t *cpu)
 {
 	uint8_t high_bit = cpu->registers.a & 0x80;
 
+	i8080_resolve_carry(cpu);
 	cpu->registers.a <<= 1;
 	if(high_bit)
 	{
@@ -937,13 +899,14 @@ uint8_t i8080_rlc(intel8080_t *cpu)
 	}
 
 	cpu->registers.pc++;
-	return CYCLES_RAL;
+	return CYCLES_RLC;
 }
 
-uint8_t i8080_rrc(intel8080_t *cpu)
+static uint8_t i8080_rrc(intel8080_t *cpu)
 {
 	uint8_t low_bit = cpu->registers.a & 1;
 
+	i8080_resolve_carry(cpu);
 	cpu->registers.a >>= 1;
 
 	if(low_bit)
@@ -958,12 +921,14 @@ uint8_t i8080_rrc(intel8080_t *cpu)
 	}
 
 	cpu->registers.pc++;
-	return CYCLES_RAR;
+	return CYCLES_RRC;
 }
 
-uint8_t i8080_ral(intel8080_t *cpu)
+static uint8_t i8080_ral(intel8080_t *cpu)
 {
 	uint8_t high_bit = cpu->registers.a & 0x80;
+
+	i8080_resolve_carry(cpu);
 	cpu->registers.a <<= 1;
 
 	if(cpu->registers.flags & FLAGS_CARRY)
@@ -977,13 +942,14 @@ uint8_t i8080_ral(intel8080_t *cpu)
 		i8080_clear_flag(cpu, FLAGS_CARRY);
 
 	cpu->registers.pc++;
-	return CYCLES_RLC;
+	return CYCLES_RAL;
 }
 
-uint8_t i8080_rar(intel8080_t *cpu)
+static uint8_t i8080_rar(intel8080_t *cpu)
 {
 	uint8_t low_bit = cpu->registers.a & 1;
 
+	i8080_resolve_carry(cpu);
 	cpu->registers.a >>= 1;
 
 	if(cpu->registers.flags & FLAGS_CARRY)
@@ -997,141 +963,161 @@ uint8_t i8080_rar(intel8080_t *cpu)
 		i8080_clear_flag(cpu, FLAGS_CARRY);
 
 	cpu->registers.pc++;
-	return CYCLES_RRC;
+	return CYCLES_RAR;
 }
 
-uint8_t i8080_jmp(intel8080_t *cpu)
+static uint8_t i8080_jmp(intel8080_t *cpu)
 {
-	cpu->registers.pc = read16(cpu->registers.pc+1);
+	cpu->registers.pc = I8080_IMM16(cpu);
 	return CYCLES_JMP;
 }
 
-uint8_t i8080_jccc(intel8080_t *cpu)
-{
-	uint8_t condition = CONDITION(cpu->current_op_code);
-
-	if(i8080_check_condition(cpu, condition))
-	{
-		i8080_jmp(cpu);
-	}
-	else
-	{
-		cpu->registers.pc+=3;
-	}
+#define I8080_FOR_EACH_CONDITION(X) \
+	X(nz, !(cpu->registers.flags & FLAGS_ZERO)) \
+	X(z, cpu->registers.flags & FLAGS_ZERO) \
+	X(nc, !(cpu->registers.flags & FLAGS_CARRY)) \
+	X(c, cpu->registers.flags & FLAGS_CARRY) \
+	X(po, !(cpu->registers.flags & FLAGS_PARITY)) \
+	X(pe, cpu->registers.flags & FLAGS_PARITY) \
+	X(p, !(cpu->registers.flags & FLAGS_SIGN)) \
+	X(m, cpu->registers.flags & FLAGS_SIGN)
 
-	return CYCLES_JMP;
+#define I8080_JCC(cc, condition) \
+static uint8_t i8080_j##cc(intel8080_t *cpu) \
+{ \
+	i8080_sync_flags(cpu); \
+	if(condition) \
+		cpu->registers.pc = I8080_IMM16(cpu); \
+	else \
+		cpu->registers.pc+=3; \
+	return CYCLES_JMP; \
 }
 
-uint8_t i8080_ret(intel8080_t *cpu)
+I8080_FOR_EACH_CONDITION(I8080_JCC)
+
+static uint8_t i8080_ret(intel8080_t *cpu)
 {
 	cpu->cpuStatus |= STATUS_STACK;
-	cpu->registers.pc = read16(cpu->registers.sp);
+	cpu->registers.pc = read16(cpu->memory, cpu->registers.sp);
 	cpu->registers.sp+=2;
 	return CYCLES_RET;
 }
 
-uint8_t i8080_rccc(intel8080_t *cpu)
-{
-	uint8_t condition = CONDITION(cpu->current_op_code);
-
-	if(i8080_check_condition(cpu, condition))
-	{
-		i8080_ret(cpu);
-	}
-	else
-	{
-		cpu->registers.pc++;
-	}
-	return CYCLES_RET;
+#define I8080_RCC(cc, condition) \
+static uint8_t i8080_r##cc(intel8080_t *cpu) \
+{ \
+	i8080_sync_flags(cpu); \
+	if(condition) \
+	{ \
+		i8080_ret(cpu); \
+		return CYCLES_RCC_TAKEN; \
+	} \
+	cpu->registers.pc++; \
+	return CYCLES_RCC; \
 }
 
-uint8_t i8080_rst(intel8080_t *cpu)
-{
-	cpu->cpuStatus |= STATUS_STACK;
-	uint8_t vec = DESTINATION(cpu->current_op_code);
-
-	cpu->registers.sp-=2;
-	write16(cpu->registers.sp, cpu->registers.pc + 1);
-
-	cpu->registers.pc = vec*8;
+I8080_FOR_EACH_CONDITION(I8080_RCC)
 
-	return CYCLES_RET;
+#define I8080_RST(n) \
+static uint8_t i8080_rst_##n(intel8080_t *cpu) \
+{ \
+	cpu->cpuStatus |= STATUS_STACK; \
+	cpu->registers.sp-=2; \
+	write16(cpu->memory, cpu->registers.sp, cpu->registers.pc + 1); \
+	cpu->registers.pc = n * 8; \
+	return CYCLES_RST; \
 }
 
-uint8_t i8080_call(intel8080_t *cpu)
+I8080_RST(0) I8080_RST(1) I8080_RST(2) I8080_RST(3)
+I8080_RST(4) I8080_RST(5) I8080_RST(6) I8080_RST(7)
+
+static uint8_t i8080_call(intel8080_t *cpu)
 {
+	// Fetch the target before pushing, as the 8080 does: a stack that overlaps
+	// the instruction must not change where it jumps
+	uint16_t target = I8080_IMM16(cpu);
+
 	cpu->cpuStatus |= STATUS_STACK;
 	cpu->registers.sp-=2;
-	write16(cpu->registers.sp, cpu->registers.pc + 3);
+	write16(cpu->memory, cpu->registers.sp, cpu->registers.pc + 3);
 
-	cpu->registers.pc = read16(cpu->registers.pc + 1);
-	return CYCLES_JMP;
+	cpu->registers.pc = target;
+	return CYCLES_CALL;
 }
 
-uint8_t i8080_cccc(intel8080_t *cpu)
-{
-	uint8_t condition = CONDITION(cpu->current_op_code);
-
-	if(i8080_check_condition(cpu, condition))
-	{
-		i8080_call(cpu);
-	}
-	else
-	{
-		cpu->registers.pc+=3;
-	}
-
-	return CYCLES_CALL;
+#define I8080_CCC(cc, condition) \
+static uint8_t i8080_c##cc(intel8080_t *cpu) \
+{ \
+	i8080_sync_flags(cpu); \
+	if(condition) \
+		return i8080_call(cpu); \
+	cpu->registers.pc+=3; \
+	return CYCLES_CCC; \
 }
 
-uint8_t i8080_pchl(intel8080_t *cpu)
+I8080_FOR_EACH_CONDITION(I8080_CCC)
+
+static uint8_t i8080_pchl(intel8080_t *cpu)
 {
 	cpu->registers.pc = cpu->registers.hl;
 	return CYCLES_PCHL;
 }
 
-uint8_t i8080_nop(intel8080_t *cpu)
+static uint8_t i8080_nop(intel8080_t *cpu)
 {
 	cpu->registers.pc++;
 
 	return CYCLES_NOP;
 }
 
-uint8_t i8080_cma(intel8080_t *cpu)
+static uint8_t i8080_hlt(intel8080_t *cpu)
 {
-	cpu->registers.a = ~cpu->registers.a;
 	cpu->registers.pc++;
+	cpu->halted = true;
+	cpu->cpuStatus |= STATUS_HALT;
 
-	return CYCLES_CMA;
+	return CYCLES_HLT;
 }
 
-uint8_t i8080_cmp(intel8080_t *cpu)
+static uint8_t i8080_cma(intel8080_t *cpu)
 {
-	uint8_t reg = SOURCE(cpu->current_op_code);
+	cpu->registers.a = ~cpu->registers.a;
+	cpu->registers.pc++;
 
-	i8080_compare(cpu, i8080_regread(cpu, reg));
+	return CYCLES_CMA;
+}
 
-	cpu->registers.pc++;
-	return CYCLES_CMP;
+#define I8080_CMP(name, operand, cycles) \
+static uint8_t i8080_cmp_##name(intel8080_t *cpu) \
+{ \
+	i8080_compare(cpu, operand); \
+	cpu->registers.pc++; \
+	return cycles; \
 }
 
-uint8_t i8080_cpi(intel8080_t *cpu)
+I8080_FOR_EACH_OPERAND(I8080_CMP, CYCLES_CMP, CYCLES_ALU_MEM)
+
+static uint8_t i8080_cpi(intel8080_t *cpu)
 {
-	i8080_compare(cpu, read8(cpu->registers.pc+1));
+	i8080_compare(cpu, I8080_IMM8(cpu));
 	cpu->registers.pc+=2;
 	return CYCLES_CPI;
 }
 
-void i8080_fetch_next_op(intel8080_t *cpu)
+#if !I8080_DECODE_CACHE
+static void i8080_fetch_next_op(intel8080_t *cpu)
 {
 	cpu->address_bus = cpu->registers.pc;
 	i8080_mread(cpu);
 }
+#endif
 
-uint8_t i8080_daa(intel8080_t *cpu)
+static uint8_t i8080_daa(intel8080_t *cpu)
 {
 	uint8_t val, add = 0;
-	val = i8080_regread(cpu, REGISTER_A);
+
+	i8080_resolve_carry(cpu);
+	val = cpu->registers.a;
 
 	if((val & 0xf) > 9 || cpu->registers.flags & FLAGS_H)
 		add += 0x06;
@@ -1147,18 +1133,1864 @@ uint8_t i8080_daa(intel8080_t *cpu)
 	return CYCLES_DAA;
 }
 
-void i8080_cycle(intel8080_t *cpu)
+// Jump table for fast opcode dispatch: one specialised handler per encoding.
+// The undocumented 0xcb, 0xd9 and 0xdd/0xed/0xfd decode as JMP, RET and CALL,
+// as on the 8080; the remaining gaps (NULL) run as NOPs.
+static uint8_t (*const opcode_handlers[256])(intel8080_t *cpu) = {
+	[0x00] = i8080_nop,       [0x01] = i8080_lxi_bc,    [0x02] = i8080_stax_bc,   [0x03] = i8080_inx_bc,
+	[0x04] = i8080_inr_b,     [0x05] = i8080_dcr_b,     [0x06] = i8080_mvi_b,     [0x07] = i8080_rlc,
+	[0x08] = NULL,            [0x09] = i8080_dad_bc,    [0x0a] = i8080_ldax_bc,   [0x0b] = i8080_dcx_bc,
+	[0x0c] = i8080_inr_c,     [0x0d] = i8080_dcr_c,     [0x0e] = i8080_mvi_c,     [0x0f] = i8080_rrc,
+	[0x10] = NULL,            [0x11] = i8080_lxi_de,    [0x12] = i8080_stax_de,   [0x13] = i8080_inx_de,
+	[0x14] = i8080_inr_d,     [0x15] = i8080_dcr_d,     [0x16] = i8080_mvi_d,     [0x17] = i8080_ral,
+	[0x18] = NULL,            [0x19] = i8080_dad_de,    [0x1a] = i8080_ldax_de,   [0x1b] = i8080_dcx_de,
+	[0x1c] = i8080_inr_e,     [0x1d] = i8080_dcr_e,     [0x1e] = i8080_mvi_e,     [0x1f] = i8080_rar,
+	[0x20] = NULL,            [0x21] = i8080_lxi_hl,    [0x22] = i8080_shld,      [0x23] = i8080_inx_hl,
+	[0x24] = i8080_inr_h,     [0x25] = i8080_dcr_h,     [0x26] = i8080_mvi_h,     [0x27] = i8080_daa,
+	[0x28] = NULL,            [0x29] = i8080_dad_hl,    [0x2a] = i8080_lhld,      [0x2b] = i8080_dcx_hl,
+	[0x2c] = i8080_inr_l,     [0x2d] = i8080_dcr_l,     [0x2e] = i8080_mvi_l,     [0x2f] = i8080_cma,
+	[0x30] = NULL,            [0x31] = i8080_lxi_sp,    [0x32] = i8080_sta,       [0x33] = i8080_inx_sp,
+	[0x34] = i8080_inr_m,     [0x35] = i8080_dcr_m,     [0x36] = i8080_mvi_m,     [0x37] = i8080_stc,
+	[0x38] = NULL,            [0x39] = i8080_dad_sp,    [0x3a] = i8080_lda,       [0x3b] = i8080_dcx_sp,
+	[0x3c] = i8080_inr_a,     [0x3d] = i8080_dcr_a,     [0x3e] = i8080_mvi_a,     [0x3f] = i8080_cmc,
+	[0x40] = i8080_mov_b_b,   [0x41] = i8080_mov_b_c,   [0x42] = i8080_mov_b_d,   [0x43] = i8080_mov_b_e,
+	[0x44] = i8080_mov_b_h,   [0x45] = i8080_mov_b_l,   [0x46] = i8080_mov_b_m,   [0x47] = i8080_mov_b_a,
+	[0x48] = i8080_mov_c_b,   [0x49] = i8080_mov_c_c,   [0x4a] = i8080_mov_c_d,   [0x4b] = i8080_mov_c_e,
+	[0x4c] = i8080_mov_c_h,   [0x4d] = i8080_mov_c_l,   [0x4e] = i8080_mov_c_m,   [0x4f] = i8080_mov_c_a,
+	[0x50] = i8080_mov_d_b,   [0x51] = i8080_mov_d_c,   [0x52] = i8080_mov_d_d,   [0x53] = i8080_mov_d_e,
+	[0x54] = i8080_mov_d_h,   [0x55] = i8080_mov_d_l,   [0x56] = i8080_mov_d_m,   [0x57] = i8080_mov_d_a,
+	[0x58] = i8080_mov_e_b,   [0x59] = i8080_mov_e_c,   [0x5a] = i8080_mov_e_d,   [0x5b] = i8080_mov_e_e,
+	[0x5c] = i8080_mov_e_h,   [0x5d] = i8080_mov_e_l,   [0x5e] = i8080_mov_e_m,   [0x5f] = i8080_mov_e_a,
+	[0x60] = i8080_mov_h_b,   [0x61] = i8080_mov_h_c,   [0x62] = i8080_mov_h_d,   [0x63] = i8080_mov_h_e,
+	[0x64] = i8080_mov_h_h,   [0x65] = i8080_mov_h_l,   [0x66] = i8080_mov_h_m,   [0x67] = i8080_mov_h_a,
+	[0x68] = i8080_mov_l_b,   [0x69] = i8080_mov_l_c,   [0x6a] = i8080_mov_l_d,   [0x6b] = i8080_mov_l_e,
+	[0x6c] = i8080_mov_l_h,   [0x6d] = i8080_mov_l_l,   [0x6e] = i8080_mov_l_m,   [0x6f] = i8080_mov_l_a,
+	[0x70] = i8080_mov_m_b,   [0x71] = i8080_mov_m_c,   [0x72] = i8080_mov_m_d,   [0x73] = i8080_mov_m_e,
+	[0x74] = i8080_mov_m_h,   [0x75] = i8080_mov_m_l,   [0x76] = i8080_hlt,      [0x77] = i8080_mov_m_a,
+	[0x78] = i8080_mov_a_b,   [0x79] = i8080_mov_a_c,   [0x7a] = i8080_mov_a_d,   [0x7b] = i8080_mov_a_e,
+	[0x7c] = i8080_mov_a_h,   [0x7d] = i8080_mov_a_l,   [0x7e] = i8080_mov_a_m,   [0x7f] = i8080_mov_a_a,
+	[0x80] = i8080_add_b,     [0x81] = i8080_add_c,     [0x82] = i8080_add_d,     [0x83] = i8080_add_e,
+	[0x84] = i8080_add_h,     [0x85] = i8080_add_l,     [0x86] = i8080_add_m,     [0x87] = i8080_add_a,
+	[0x88] = i8080_adc_b,     [0x89] = i8080_adc_c,     [0x8a] = i8080_adc_d,     [0x8b] = i8080_adc_e,
+	[0x8c] = i8080_adc_h,     [0x8d] = i8080_adc_l,     [0x8e] = i8080_adc_m,     [0x8f] = i8080_adc_a,
+	[0x90] = i8080_sub_b,     [0x91] = i8080_sub_c,     [0x92] = i8080_sub_d,     [0x93] = i8080_sub_e,
+	[0x94] = i8080_sub_h,     [0x95] = i8080_sub_l,     [0x96] = i8080_sub_m,     [0x97] = i8080_sub_a,
+	[0x98] = i8080_sbb_b,     [0x99] = i8080_sbb_c,     [0x9a] = i8080_sbb_d,     [0x9b] = i8080_sbb_e,
+	[0x9c] = i8080_sbb_h,     [0x9d] = i8080_sbb_l,     [0x9e] = i8080_sbb_m,     [0x9f] = i8080_sbb_a,
+	[0xa0] = i8080_ana_b,     [0xa1] = i8080_ana_c,     [0xa2] = i8080_ana_d,     [0xa3] = i8080_ana_e,
+	[0xa4] = i8080_ana_h,     [0xa5] = i8080_ana_l,     [0xa6] = i8080_ana_m,     [0xa7] = i8080_ana_a,
+	[0xa8] = i8080_xra_b,     [0xa9] = i8080_xra_c,     [0xaa] = i8080_xra_d,     [0xab] = i8080_xra_e,
+	[0xac] = i8080_xra_h,     [0xad] = i8080_xra_l,     [0xae] = i8080_xra_m,     [0xaf] = i8080_xra_a,
+	[0xb0] = i8080_ora_b,     [0xb1] = i8080_ora_c,     [0xb2] = i8080_ora_d,     [0xb3] = i8080_ora_e,
+	[0xb4] = i8080_ora_h,     [0xb5] = i8080_ora_l,     [0xb6] = i8080_ora_m,     [0xb7] = i8080_ora_a,
+	[0xb8] = i8080_cmp_b,     [0xb9] = i8080_cmp_c,     [0xba] = i8080_cmp_d,     [0xbb] = i8080_cmp_e,
+	[0xbc] = i8080_cmp_h,     [0xbd] = i8080_cmp_l,     [0xbe] = i8080_cmp_m,     [0xbf] = i8080_cmp_a,
+	[0xc0] = i8080_rnz,       [0xc1] = i8080_pop_bc,    [0xc2] = i8080_jnz,       [0xc3] = i8080_jmp,
+	[0xc4] = i8080_cnz,       [0xc5] = i8080_push_bc,   [0xc6] = i8080_adi,       [0xc7] = i8080_rst_0,
+	[0xc8] = i8080_rz,        [0xc9] = i8080_ret,       [0xca] = i8080_jz,        [0xcb] = i8080_jmp,
+	[0xcc] = i8080_cz,        [0xcd] = i8080_call,      [0xce] = i8080_aci,       [0xcf] = i8080_rst_1,
+	[0xd0] = i8080_rnc,       [0xd1] = i8080_pop_de,    [0xd2] = i8080_jnc,       [0xd3] = i8080_out,
+	[0xd4] = i8080_cnc,       [0xd5] = i8080_push_de,   [0xd6] = i8080_sui,       [0xd7] = i8080_rst_2,
+	[0xd8] = i8080_rc,        [0xd9] = i8080_ret,           [0xda] = i8080_jc,        [0xdb] = i8080_in,
+	[0xdc] = i8080_cc,        [0xdd] = i8080_call,           [0xde] = i8080_sbi,       [0xdf] = i8080_rst_3,
+	[0xe0] = i8080_rpo,       [0xe1] = i8080_pop_hl,    [0xe2] = i8080_jpo,       [0xe3] = i8080_xthl,
+	[0xe4] = i8080_cpo,       [0xe5] = i8080_push_hl,   [0xe6] = i8080_ani,       [0xe7] = i8080_rst_4,
+	[0xe8] = i8080_rpe,       [0xe9] = i8080_pchl,      [0xea] = i8080_jpe,       [0xeb] = i8080_xchg,
+	[0xec] = i8080_cpe,       [0xed] = i8080_call,           [0xee] = i8080_xri,       [0xef] = i8080_rst_5,
+	[0xf0] = i8080_rp,        [0xf1] = i8080_pop_psw,   [0xf2] = i8080_jp,        [0xf3] = i8080_di,
+	[0xf4] = i8080_cp,        [0xf5] = i8080_push_psw,  [0xf6] = i8080_ori,       [0xf7] = i8080_rst_6,
+	[0xf8] = i8080_rm,        [0xf9] = i8080_sphl,      [0xfa] = i8080_jm,        [0xfb] = i8080_ei,
+	[0xfc] = i8080_cm,        [0xfd] = i8080_call,           [0xfe] = i8080_cpi,       [0xff] = i8080_rst_7
+};
+
+void i8080_request_interrupt(intel8080_t *cpu, uint8_t rst)
 {
-	cpu->cpuStatus = 0;
-	i8080_fetch_next_op(cpu);
+	cpu->int_line[rst & 7] = 1;
+}
 
-	uint8_t op_code = cpu->current_op_code = cpu->data_bus;
-	uint8_t (*handler)(intel8080_t *) = opcode_handlers[op_code];
-	
-	if (LIKELY(handler != NULL)) {
-		handler(cpu);
-	} else {
+// Take the highest-priority raised line, as if the interrupting device had
+// jammed RST n onto the data bus during the acknowledge cycle
+static uint8_t i8080_acknowledge_interrupt(intel8080_t *cpu)
+{
+	uint8_t rst = 0;
+
+	while (!cpu->int_line[rst])
+		rst++;
+	cpu->int_line[rst] = 0;
+
+	i8080_clear_flag(cpu, FLAGS_IF);
+	cpu->ei_delay = 0;
+	cpu->halted = false;
+	cpu->cpuStatus = STATUS_INTERRUPT | STATUS_STACK;
+	cpu->data_bus = cpu->current_op_code = 0xc7 | (rst << 3);
+	cpu->registers.sp-=2;
+	write16(cpu->memory, cpu->registers.sp, cpu->registers.pc);
+	cpu->registers.pc = rst * 8;
+	return CYCLES_RST;
+}
+
+// Runs before an instruction while a line is raised, the CPU is halted or an
+// EI is waiting for its next instruction. Returns the T-states spent acknowledging an interrupt or idling in HLT, or
+// 0 when the instruction at PC should execute.
+static uint8_t i8080_check_interrupts(intel8080_t *cpu)
+{
+	// EI takes effect after the next instruction; HLT counts as that one
+	if (cpu->ei_delay && !cpu->halted) {
+		cpu->ei_delay = 0;
+	} else if (cpu->int_pending && (cpu->registers.flags & FLAGS_IF)) {
+		return i8080_acknowledge_interrupt(cpu);
+	}
+
+	if (cpu->halted) {
+		cpu->cpuStatus = STATUS_HALT | STATUS_MEMORY_READ;
+		return CYCLES_NOP;
+	}
+	return 0;
+}
+
+// Start of a batch: take a pending interrupt, or report that the CPU stays
+// halted, in which case the whole budget passes idle in HLT.
+static inline bool i8080_batch_halted(intel8080_t *cpu, uint32_t cycle_budget, uint32_t *executed)
+{
+	*executed = 0;
+	if (LIKELY(!cpu->int_pending && !cpu->halted && !cpu->ei_delay))
+		return false;
+
+	*executed = i8080_check_interrupts(cpu);
+	if (!cpu->halted)
+		return false;
+
+	cpu->cycles += cycle_budget;
+	return true;
+}
+
+// Execution trace (I8080_TRACE): the instruction about to run, with its
+// flags brought up to date
+#if defined(I8080_TRACE) && I8080_TRACE
+#define I8080_TRACE_STEP(cpu)	do { \
+		if (UNLIKELY(trace_enabled)) { \
+			i8080_sync_flags(cpu); \
+			trace_record(cpu); \
+		} \
+	} while (0)
+#else
+#define I8080_TRACE_STEP(cpu)	((void)0)
+#endif
+
+#if I8080_DECODE_CACHE
+// Decoded-instruction cache, direct mapped on PC. write8()/write16() flag the
+// 256-byte page they touch in memory_dirty_pages; a lookup in a dirty page
+// drops every entry decoded from that page before it is trusted again.
+#if I8080_DECODE_CACHE_SIZE < 256 || (I8080_DECODE_CACHE_SIZE & (I8080_DECODE_CACHE_SIZE - 1))
+#error "I8080_DECODE_CACHE_SIZE must be a power of two of at least 256"
+#endif
+
+typedef struct
+{
+	uint8_t (*handler)(intel8080_t *cpu);	// NULL when the slot is empty
+	uint16_t pc;
+	uint16_t operand;
+	uint8_t op_code;
+	uint8_t length;
+} i8080_decoded_t;
+
+static i8080_decoded_t decode_cache[I8080_DECODE_CACHE_SIZE];
+static i8080_decode_stats_t decode_stats;
+
+static uint8_t i8080_opcode_length(uint8_t op_code)
+{
+	if (opcode_handlers[op_code] == NULL)
+		return 1;
+
+	switch (op_code & 0xc7)
+	{
+	case 0x06:	// MVI
+	case 0xc6:	// ADI..CPI
+		return 2;
+	case 0x02:	// SHLD/LHLD/STA/LDA (STAX/LDAX are single byte)
+		return op_code >= 0x22 ? 3 : 1;
+	case 0xc2:	// Jcc
+	case 0xc4:	// Ccc
+		return 3;
+	}
+
+	switch (op_code)
+	{
+	case 0xd3:	// OUT
+	case 0xdb:	// IN
+		return 2;
+	case 0xc3:	// JMP
+	case 0xcb:
+	case 0xcd:	// CALL
+	case 0xdd:
+	case 0xed:
+	case 0xfd:
+		return 3;
+	}
+
+	return (op_code & 0xcf) == 0x01 ? 3 : 1;	// LXI
+}
+
+static void i8080_decode_invalidate_page(uint8_t page)
+{
+	memory_dirty_pages[page >> 5] &= ~(1u << (page & 31));
+
+	for (uint16_t offset = 0; offset < 256; offset++)
+	{
+		i8080_decoded_t *entry = &decode_cache[((page << 8) | offset) & (I8080_DECODE_CACHE_SIZE - 1)];
+
+		if (entry->handler != NULL && (entry->pc >> 8) == page)
+			entry->handler = NULL;
+	}
+	decode_stats.invalidations++;
+}
+
+static inline const i8080_decoded_t *i8080_decode(intel8080_t *cpu, uint16_t pc)
+{
+	i8080_decoded_t *entry = &decode_cache[pc & (I8080_DECODE_CACHE_SIZE - 1)];
+
+	if (UNLIKELY(memory_page_dirty(pc)))
+		i8080_decode_invalidate_page(pc >> 8);
+
+	if (LIKELY(entry->handler != NULL && entry->pc == pc)) {
+		decode_stats.hits++;
+		return entry;
+	}
+
+	decode_stats.misses++;
+	entry->pc = pc;
+	entry->op_code = read8(cpu->memory, pc);
+	entry->length = i8080_opcode_length(entry->op_code);
+	entry->operand = entry->length == 3 ? read16(cpu->memory, pc + 1) : entry->length == 2 ? read8(cpu->memory, pc + 1) : 0;
+	// Undefined opcodes execute as NOP
+	entry->handler = opcode_handlers[entry->op_code] ? opcode_handlers[entry->op_code] : i8080_nop;
+	return entry;
+}
+
+void i8080_decode_cache_get_stats(i8080_decode_stats_t *stats)
+{
+	*stats = decode_stats;
+}
+
+void i8080_decode_cache_clear_stats(void)
+{
+	memset(&decode_stats, 0, sizeof(decode_stats));
+}
+
+// Fetch and execute one instruction. Flags may be left deferred; the public
+// entry points below sync them before returning.
+static inline uint8_t i8080_step(intel8080_t *cpu)
+{
+	const i8080_decoded_t *entry;
+	uint8_t cycles;
+
+	if (UNLIKELY(cpu->int_pending || cpu->halted || cpu->ei_delay)) {
+		cycles = i8080_check_interrupts(cpu);
+		if (cycles) {
+			cpu->cycles += cycles;
+			return cycles;
+		}
+	}
+
+	I8080_TRACE_STEP(cpu);
+	entry = i8080_decode(cpu, cpu->registers.pc);
+
+	// Same bus state as i8080_fetch_next_op()
+	cpu->cpuStatus = STATUS_MEMORY_READ;
+	cpu->address_bus = cpu->registers.pc;
+	cpu->data_bus = cpu->current_op_code = entry->op_code;
+	cpu->operand = entry->operand;
+
+	cycles = entry->handler(cpu);
+	cpu->cycles += cycles;
+	return cycles;
+}
+#else
+// Fetch and execute one instruction. Flags may be left deferred; the public
+// entry points below sync them before returning.
+static inline uint8_t i8080_step(intel8080_t *cpu)
+{
+	uint8_t cycles;
+
+	if (UNLIKELY(cpu->int_pending || cpu->halted || cpu->ei_delay)) {
+		cycles = i8080_check_interrupts(cpu);
+		if (cycles) {
+			cpu->cycles += cycles;
+			return cycles;
+		}
+	}
+
+	I8080_TRACE_STEP(cpu);
+	cpu->cpuStatus = 0;
+	i8080_fetch_next_op(cpu);
+
+	uint8_t op_code = cpu->current_op_code = cpu->data_bus;
+	uint8_t (*handler)(intel8080_t *) = opcode_handlers[op_code];
+	
+	if (LIKELY(handler != NULL)) {
+		cycles = handler(cpu);
+	} else {
 		// Handle undefined opcodes (NOP behavior)
 		cpu->registers.pc++;
+		cycles = CYCLES_NOP;
+	}
+
+	cpu->cycles += cycles;
+	return cycles;
+}
+#endif
+
+uint8_t i8080_cycle(intel8080_t *cpu)
+{
+	uint8_t cycles = i8080_step(cpu);
+
+	i8080_sync_flags(cpu);
+	return cycles;
+}
+
+uint32_t i8080_run(intel8080_t *cpu, uint32_t cycle_budget)
+{
+	uint32_t executed = 0;
+
+	// i8080_step() checks for interrupts itself, so only a halted CPU needs
+	// the batch check; checking twice would end an EI's delay early
+	if (UNLIKELY(cpu->halted)) {
+		if (i8080_batch_halted(cpu, cycle_budget, &executed))
+			return cycle_budget;
+		cpu->cycles += executed;
+	}
+
+	// The last instruction may overrun the budget by up to 17 T-states;
+	// callers carry the overshoot into their next slice.
+	while (executed < cycle_budget && !cpu->console_idle)
+	{
+		executed += i8080_step(cpu);
+	}
+
+	i8080_sync_flags(cpu);
+	return executed;
+}
+
+// Threaded-dispatch batch core.
+//
+// i8080_run_fast() executes the same instruction set as opcode_handlers[] but
+// dispatches with computed goto (GCC labels-as-values) and keeps the register
+// file in locals for the whole batch. The bus and status fields are written
+// back once, when the batch ends, which is when the front panel and the CPU
+// monitor look at them. IN and OUT are rare, so they spill the locals and go
+// through the table handlers.
+#if defined(__GNUC__)
+
+static bool fusion_enabled = true;
+
+void i8080_set_fusion(bool enabled)
+{
+	fusion_enabled = enabled;
+}
+
+bool i8080_get_fusion(void)
+{
+	return fusion_enabled;
+}
+
+#define FAST_ZSP(v)		zsp_table[v]
+
+#define FAST_BC()		((uint16_t)((b << 8) | c))
+#define FAST_DE()		((uint16_t)((d << 8) | e))
+#define FAST_HL()		((uint16_t)((h << 8) | l))
+#define FAST_SET_BC(v)	do { uint16_t _p = (v); b = _p >> 8; c = _p & 0xff; } while (0)
+#define FAST_SET_DE(v)	do { uint16_t _p = (v); d = _p >> 8; e = _p & 0xff; } while (0)
+#define FAST_SET_HL(v)	do { uint16_t _p = (v); h = _p >> 8; l = _p & 0xff; } while (0)
+
+#define FAST_ADD(v)	do { \
+		uint16_t _v = (v); \
+		f = (f & ~ALU_FLAGS) | i8080_add_carry_flags(a, _v); \
+		a = (uint8_t)(a + _v); \
+		f |= FAST_ZSP(a); \
+	} while (0)
+#define FAST_ADC(v)	FAST_ADD((uint16_t)((v) + ((f & FLAGS_CARRY) ? 1 : 0)))
+// Subtract by adding the two's complement; the carry sense is inverted (see i8080_gensub)
+#define FAST_SUB(v)	do { \
+		uint16_t _b = (uint16_t)(0x100 - (v)); \
+		f = (f & ~ALU_FLAGS) | (i8080_add_carry_flags(a, _b) ^ FLAGS_CARRY); \
+		a = (uint8_t)(a + _b); \
+		f |= FAST_ZSP(a); \
+	} while (0)
+#define FAST_SBB(v)	FAST_SUB((uint16_t)((v) + ((f & FLAGS_CARRY) ? 1 : 0)))
+#define FAST_CMP(v)	do { uint8_t _a = a; FAST_SUB(v); a = _a; } while (0)
+#define FAST_ANA(v)	do { a &= (v); f = (f & ~(FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_CARRY)) | FAST_ZSP(a); } while (0)
+#define FAST_ANI(v)	do { a &= (v); f = (f & ~ALU_FLAGS) | FAST_ZSP(a); } while (0)
+#define FAST_XRA(v)	do { a ^= (v); f = (f & ~ALU_FLAGS) | FAST_ZSP(a); } while (0)
+#define FAST_ORA(v)	do { a |= (v); f = (f & ~ALU_FLAGS) | FAST_ZSP(a); } while (0)
+#define FAST_INR(x)	do { \
+		x = (uint8_t)(x + 1); \
+		f = (f & ~(FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_H)) | inr_flags_table[x]; \
+	} while (0)
+#define FAST_DCR(x)	do { \
+		x = (uint8_t)(x - 1); \
+		f = (f & ~(FLAGS_ZERO | FLAGS_SIGN | FLAGS_PARITY | FLAGS_H)) | dcr_flags_table[x]; \
+	} while (0)
+
+// Superinstructions: DCR r / JNZ, CPI / JZ|JNZ, MOV A,M / INX H and
+// LDAX D / STAX B run as one dispatch with the summed T-states. The first
+// instruction of each pair never writes memory, so peeking at the second
+// opcode early cannot miss self-modifying code. The budget is checked only
+// after the pair, which the overshoot carry already allows for.
+#define FAST_FUSE_JCC(first_len, first_cycles, condition)	do { \
+		fused++; \
+		pc = (condition) ? read16(mem, pc + (first_len) + 1) : (uint16_t)(pc + (first_len) + 3); \
+		FAST_DISPATCH((first_cycles) + CYCLES_JMP); \
+	} while (0)
+
+// The target is fetched before the return address is pushed, as on the 8080
+#define FAST_CALL()	do { \
+		uint16_t _target = read16(mem, pc + 1); \
+		sp -= 2; \
+		write16(mem, sp, pc + 3); \
+		pc = _target; \
+	} while (0)
+
+#define FAST_SPILL()	do { \
+		regs->pc = pc; regs->sp = sp; regs->a = a; regs->flags = f; \
+		regs->b = b; regs->c = c; regs->d = d; regs->e = e; regs->h = h; regs->l = l; \
+	} while (0)
+#define FAST_RELOAD()	do { \
+		pc = regs->pc; sp = regs->sp; a = regs->a; f = regs->flags; \
+		b = regs->b; c = regs->c; d = regs->d; e = regs->e; h = regs->h; l = regs->l; \
+	} while (0)
+
+// A guarded batch ends before an instruction in one of the guard's code
+// pages. With data pages, opcodes that touch memory dispatch through a
+// guard_* label that checks the page of their access first.
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+#define FAST_PAGE_SET(pages, address)	((pages)[(address) >> 13] & (1u << (((address) >> 8) & 31)))
+#define FAST_GUARD()	do { \
+		if (UNLIKELY(FAST_PAGE_SET(code_pages, pc))) \
+			goto done; \
+	} while (0)
+#define FAST_GUARD_DATA(address, length)	do { \
+		uint16_t _first = (address), _last = (uint16_t)(_first + (length) - 1); \
+		if (FAST_PAGE_SET(guard->data_pages, _first) || FAST_PAGE_SET(guard->data_pages, _last)) \
+			goto done; \
+		goto *dispatch[read8(mem, pc)]; \
+	} while (0)
+#define FAST_TABLE	table
+#else
+#define FAST_GUARD()	((void)0)
+#define FAST_TABLE	dispatch
+#endif
+
+#define FAST_DISPATCH(cycles)	do { \
+		executed += (cycles); \
+		if (UNLIKELY(executed >= cycle_budget)) \
+			goto done; \
+		FAST_GUARD(); \
+		goto *FAST_TABLE[read8(mem, pc)]; \
+	} while (0)
+#define FAST_NEXT(len, cycles)	do { pc += (len); FAST_DISPATCH(cycles); } while (0)
+#define FAST_SLOW_PATH(handler)	do { \
+		FAST_SPILL(); \
+		uint8_t _cycles = handler(cpu); \
+		FAST_RELOAD(); \
+		FAST_DISPATCH(_cycles); \
+	} while (0)
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+static uint32_t run_fast(intel8080_t *cpu, uint32_t cycle_budget, const i8080_guard_t *guard)
+#else
+uint32_t i8080_run_fast(intel8080_t *cpu, uint32_t cycle_budget)
+#endif
+{
+	uint32_t executed;
+
+	if (i8080_batch_halted(cpu, cycle_budget, &executed))
+		return cycle_budget;
+
+	registers_t *regs = &cpu->registers;
+	uint8_t *const mem = cpu->memory;
+	uint16_t pc = regs->pc, sp = regs->sp;
+	uint8_t a = regs->a, f = regs->flags;
+	uint8_t b = regs->b, c = regs->c, d = regs->d, e = regs->e, h = regs->h, l = regs->l;
+	uint32_t fused = 0;
+	uint32_t ei_executed = 0;	// executed just after the last EI
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+	// The second instruction of a fused pair would skip the guard
+	const bool fusion = fusion_enabled && !guard;
+#else
+	const bool fusion = fusion_enabled;
+#endif
+
+	static const void *const dispatch[256] = {
+		&&op_nop, &&op_01, &&op_02, &&op_03,
+		&&op_04, &&op_05, &&op_06, &&op_07,
+		&&op_nop, &&op_09, &&op_0a, &&op_0b,
+		&&op_0c, &&op_0d, &&op_0e, &&op_0f,
+		&&op_nop, &&op_11, &&op_12, &&op_13,
+		&&op_14, &&op_15, &&op_16, &&op_17,
+		&&op_nop, &&op_19, &&op_1a, &&op_1b,
+		&&op_1c, &&op_1d, &&op_1e, &&op_1f,
+		&&op_nop, &&op_21, &&op_22, &&op_23,
+		&&op_24, &&op_25, &&op_26, &&op_27,
+		&&op_nop, &&op_29, &&op_2a, &&op_2b,
+		&&op_2c, &&op_2d, &&op_2e, &&op_2f,
+		&&op_nop, &&op_31, &&op_32, &&op_33,
+		&&op_34, &&op_35, &&op_36, &&op_37,
+		&&op_nop, &&op_39, &&op_3a, &&op_3b,
+		&&op_3c, &&op_3d, &&op_3e, &&op_3f,
+		&&op_40, &&op_41, &&op_42, &&op_43,
+		&&op_44, &&op_45, &&op_46, &&op_47,
+		&&op_48, &&op_49, &&op_4a, &&op_4b,
+		&&op_4c, &&op_4d, &&op_4e, &&op_4f,
+		&&op_50, &&op_51, &&op_52, &&op_53,
+		&&op_54, &&op_55, &&op_56, &&op_57,
+		&&op_58, &&op_59, &&op_5a, &&op_5b,
+		&&op_5c, &&op_5d, &&op_5e, &&op_5f,
+		&&op_60, &&op_61, &&op_62, &&op_63,
+		&&op_64, &&op_65, &&op_66, &&op_67,
+		&&op_68, &&op_69, &&op_6a, &&op_6b,
+		&&op_6c, &&op_6d, &&op_6e, &&op_6f,
+		&&op_70, &&op_71, &&op_72, &&op_73,
+		&&op_74, &&op_75, &&op_76, &&op_77,
+		&&op_78, &&op_79, &&op_7a, &&op_7b,
+		&&op_7c, &&op_7d, &&op_7e, &&op_7f,
+		&&op_80, &&op_81, &&op_82, &&op_83,
+		&&op_84, &&op_85, &&op_86, &&op_87,
+		&&op_88, &&op_89, &&op_8a, &&op_8b,
+		&&op_8c, &&op_8d, &&op_8e, &&op_8f,
+		&&op_90, &&op_91, &&op_92, &&op_93,
+		&&op_94, &&op_95, &&op_96, &&op_97,
+		&&op_98, &&op_99, &&op_9a, &&op_9b,
+		&&op_9c, &&op_9d, &&op_9e, &&op_9f,
+		&&op_a0, &&op_a1, &&op_a2, &&op_a3,
+		&&op_a4, &&op_a5, &&op_a6, &&op_a7,
+		&&op_a8, &&op_a9, &&op_aa, &&op_ab,
+		&&op_ac, &&op_ad, &&op_ae, &&op_af,
+		&&op_b0, &&op_b1, &&op_b2, &&op_b3,
+		&&op_b4, &&op_b5, &&op_b6, &&op_b7,
+		&&op_b8, &&op_b9, &&op_ba, &&op_bb,
+		&&op_bc, &&op_bd, &&op_be, &&op_bf,
+		&&op_c0, &&op_c1, &&op_c2, &&op_c3,
+		&&op_c4, &&op_c5, &&op_c6, &&op_c7,
+		&&op_c8, &&op_c9, &&op_ca, &&op_c3,
+		&&op_cc, &&op_cd, &&op_ce, &&op_cf,
+		&&op_d0, &&op_d1, &&op_d2, &&op_d3,
+		&&op_d4, &&op_d5, &&op_d6, &&op_d7,
+		&&op_d8, &&op_c9, &&op_da, &&op_db,
+		&&op_dc, &&op_cd, &&op_de, &&op_df,
+		&&op_e0, &&op_e1, &&op_e2, &&op_e3,
+		&&op_e4, &&op_e5, &&op_e6, &&op_e7,
+		&&op_e8, &&op_e9, &&op_ea, &&op_eb,
+		&&op_ec, &&op_cd, &&op_ee, &&op_ef,
+		&&op_f0, &&op_f1, &&op_f2, &&op_f3,
+		&&op_f4, &&op_f5, &&op_f6, &&op_f7,
+		&&op_f8, &&op_f9, &&op_fa, &&op_fb,
+		&&op_fc, &&op_cd, &&op_fe, &&op_ff
+	};
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+	static const uint32_t no_pages[8];
+	static const void *guarded[256];
+	static bool guarded_ready;
+	const uint32_t *const code_pages = guard ? guard->code_pages : no_pages;
+	const void *const *table = dispatch;
+
+	if (guard && guard->data_pages) {
+		if (!guarded_ready) {
+			// Opcodes that touch data memory check its page first
+			for (int op = 0; op < 256; op++) {
+				const void *entry = dispatch[op];
+
+				if (op == 0x02 || op == 0x0a)
+					entry = &&guard_bc;
+				else if (op == 0x12 || op == 0x1a)
+					entry = &&guard_de;
+				else if (op == 0x22 || op == 0x2a || op == 0x32 || op == 0x3a)
+					entry = &&guard_direct;
+				else if (op != 0x76 && ((op >= 0x34 && op <= 0x36) || (op & 0xc7) == 0x46 ||
+					 (op & 0xf8) == 0x70 || (op & 0xc7) == 0x86))
+					entry = &&guard_hl;
+				else if ((op & 0xc7) == 0xc4 || (op & 0xcf) == 0xc5 || (op & 0xc7) == 0xc7 ||
+					 (op & 0xcf) == 0xcd)
+					entry = &&guard_push;
+				else if ((op & 0xc7) == 0xc0 || (op & 0xcf) == 0xc1 || (op & 0xef) == 0xc9 || op == 0xe3)
+					entry = &&guard_pop;
+				guarded[op] = entry;
+			}
+			guarded_ready = true;
+		}
+		table = guarded;
+	}
+#endif
+
+	FAST_DISPATCH(0);
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+guard_hl:
+	FAST_GUARD_DATA(FAST_HL(), 1);
+guard_bc:
+	FAST_GUARD_DATA(FAST_BC(), 1);
+guard_de:
+	FAST_GUARD_DATA(FAST_DE(), 1);
+guard_direct:	/* SHLD, LHLD, STA, LDA (all taken as two bytes) */
+	FAST_GUARD_DATA(read16(mem, pc + 1), 2);
+guard_push:	/* PUSH, CALL, Ccc, RST */
+	FAST_GUARD_DATA(sp - 2, 2);
+guard_pop:	/* POP, RET, Rcc, XTHL */
+	FAST_GUARD_DATA(sp, 2);
+#endif
+
+op_nop:	/* NOP */
+	FAST_NEXT(1, CYCLES_NOP);
+
+op_01:	/* LXI B,D16 */
+	FAST_SET_BC(read16(mem, pc + 1));
+	FAST_NEXT(3, CYCLES_LXI);
+
+op_02:	/* STAX B */
+	write8(mem, FAST_BC(), a);
+	FAST_NEXT(1, CYCLES_STAX);
+
+op_03:	/* INX B */
+	FAST_SET_BC(FAST_BC() + 1);
+	FAST_NEXT(1, CYCLES_INX);
+
+op_04:	/* INR B */
+	FAST_INR(b);
+	FAST_NEXT(1, CYCLES_INR);
+
+op_05:	/* DCR B */
+	FAST_DCR(b);
+	if (fusion && read8(mem, pc + 1) == 0xc2)	/* + JNZ */
+		FAST_FUSE_JCC(1, CYCLES_DCR, !(f & FLAGS_ZERO));
+	FAST_NEXT(1, CYCLES_DCR);
+
+op_06:	/* MVI B, D8 */
+	b = read8(mem, pc + 1);
+	FAST_NEXT(2, CYCLES_MVI_REG);
+
+op_07:	/* RLC */
+	f = (a & 0x80) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+	a = (uint8_t)((a << 1) | (a >> 7));
+	FAST_NEXT(1, CYCLES_RLC);
+
+op_09:	/* DAD B */
+	{
+		uint32_t sum = (uint32_t)FAST_HL() + FAST_BC();
+		f = (sum > 0xffff) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+		FAST_SET_HL(sum);
+	}
+	FAST_NEXT(1, CYCLES_DAD);
+
+op_0a:	/* LDAX B */
+	a = read8(mem, FAST_BC());
+	FAST_NEXT(1, CYCLES_LDAX);
+
+op_0b:	/* DCX B */
+	FAST_SET_BC(FAST_BC() - 1);
+	FAST_NEXT(1, CYCLES_DCX);
+
+op_0c:	/* INR C */
+	FAST_INR(c);
+	FAST_NEXT(1, CYCLES_INR);
+
+op_0d:	/* DCR C */
+	FAST_DCR(c);
+	if (fusion && read8(mem, pc + 1) == 0xc2)	/* + JNZ */
+		FAST_FUSE_JCC(1, CYCLES_DCR, !(f & FLAGS_ZERO));
+	FAST_NEXT(1, CYCLES_DCR);
+
+op_0e:	/* MVI C,D8 */
+	c = read8(mem, pc + 1);
+	FAST_NEXT(2, CYCLES_MVI_REG);
+
+op_0f:	/* RRC */
+	f = (a & 0x01) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+	a = (uint8_t)((a >> 1) | (a << 7));
+	FAST_NEXT(1, CYCLES_RRC);
+
+op_11:	/* LXI D,D16 */
+	FAST_SET_DE(read16(mem, pc + 1));
+	FAST_NEXT(3, CYCLES_LXI);
+
+op_12:	/* STAX D */
+	write8(mem, FAST_DE(), a);
+	FAST_NEXT(1, CYCLES_STAX);
+
+op_13:	/* INX D */
+	FAST_SET_DE(FAST_DE() + 1);
+	FAST_NEXT(1, CYCLES_INX);
+
+op_14:	/* INR D */
+	FAST_INR(d);
+	FAST_NEXT(1, CYCLES_INR);
+
+op_15:	/* DCR D */
+	FAST_DCR(d);
+	if (fusion && read8(mem, pc + 1) == 0xc2)	/* + JNZ */
+		FAST_FUSE_JCC(1, CYCLES_DCR, !(f & FLAGS_ZERO));
+	FAST_NEXT(1, CYCLES_DCR);
+
+op_16:	/* MVI D, D8 */
+	d = read8(mem, pc + 1);
+	FAST_NEXT(2, CYCLES_MVI_REG);
+
+op_17:	/* RAL */
+	{
+		uint8_t carry = f & FLAGS_CARRY;
+		f = (a & 0x80) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+		a = (uint8_t)((a << 1) | carry);
+	}
+	FAST_NEXT(1, CYCLES_RAL);
+
+op_19:	/* DAD D */
+	{
+		uint32_t sum = (uint32_t)FAST_HL() + FAST_DE();
+		f = (sum > 0xffff) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+		FAST_SET_HL(sum);
+	}
+	FAST_NEXT(1, CYCLES_DAD);
+
+op_1a:	/* LDAX D */
+	a = read8(mem, FAST_DE());
+	if (fusion && read8(mem, pc + 1) == 0x02)	/* + STAX B */
+	{
+		fused++;
+		write8(mem, FAST_BC(), a);
+		FAST_NEXT(2, CYCLES_LDAX + CYCLES_STAX);
+	}
+	FAST_NEXT(1, CYCLES_LDAX);
+
+op_1b:	/* DCX D */
+	FAST_SET_DE(FAST_DE() - 1);
+	FAST_NEXT(1, CYCLES_DCX);
+
+op_1c:	/* INR E */
+	FAST_INR(e);
+	FAST_NEXT(1, CYCLES_INR);
+
+op_1d:	/* DCR E */
+	FAST_DCR(e);
+	if (fusion && read8(mem, pc + 1) == 0xc2)	/* + JNZ */
+		FAST_FUSE_JCC(1, CYCLES_DCR, !(f & FLAGS_ZERO));
+	FAST_NEXT(1, CYCLES_DCR);
+
+op_1e:	/* MVI E,D8 */
+	e = read8(mem, pc + 1);
+	FAST_NEXT(2, CYCLES_MVI_REG);
+
+op_1f:	/* RAR */
+	{
+		uint8_t carry = f & FLAGS_CARRY;
+		f = (a & 0x01) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+		a = (uint8_t)((a >> 1) | (carry << 7));
+	}
+	FAST_NEXT(1, CYCLES_RAR);
+
+op_21:	/* LXI H,D16 */
+	FAST_SET_HL(read16(mem, pc + 1));
+	FAST_NEXT(3, CYCLES_LXI);
+
+op_22:	/* SHLD adr */
+	write16(mem, read16(mem, pc + 1), FAST_HL());
+	FAST_NEXT(3, CYCLES_SHLD);
+
+op_23:	/* INX H */
+	FAST_SET_HL(FAST_HL() + 1);
+	FAST_NEXT(1, CYCLES_INX);
+
+op_24:	/* INR H */
+	FAST_INR(h);
+	FAST_NEXT(1, CYCLES_INR);
+
+op_25:	/* DCR H */
+	FAST_DCR(h);
+	if (fusion && read8(mem, pc + 1) == 0xc2)	/* + JNZ */
+		FAST_FUSE_JCC(1, CYCLES_DCR, !(f & FLAGS_ZERO));
+	FAST_NEXT(1, CYCLES_DCR);
+
+op_26:	/* MVI H,D8 */
+	h = read8(mem, pc + 1);
+	FAST_NEXT(2, CYCLES_MVI_REG);
+
+op_27:	/* DAA */
+	{
+		uint8_t val = a, add = 0;
+		if ((val & 0xf) > 9 || (f & FLAGS_H))
+			add += 0x06;
+		val += add;
+		if (((val & 0xf0) >> 4) > 9 || (f & FLAGS_CARRY))
+			add += 0x60;
+		FAST_ADD(add);
+	}
+	FAST_NEXT(1, CYCLES_DAA);
+
+op_29:	/* DAD H */
+	{
+		uint32_t sum = (uint32_t)FAST_HL() + FAST_HL();
+		f = (sum > 0xffff) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+		FAST_SET_HL(sum);
+	}
+	FAST_NEXT(1, CYCLES_DAD);
+
+op_2a:	/* LHLD adr */
+	FAST_SET_HL(read16(mem, read16(mem, pc + 1)));
+	FAST_NEXT(3, CYCLES_LHLD);
+
+op_2b:	/* DCX H */
+	FAST_SET_HL(FAST_HL() - 1);
+	FAST_NEXT(1, CYCLES_DCX);
+
+op_2c:	/* INR L */
+	FAST_INR(l);
+	FAST_NEXT(1, CYCLES_INR);
+
+op_2d:	/* DCR L */
+	FAST_DCR(l);
+	if (fusion && read8(mem, pc + 1) == 0xc2)	/* + JNZ */
+		FAST_FUSE_JCC(1, CYCLES_DCR, !(f & FLAGS_ZERO));
+	FAST_NEXT(1, CYCLES_DCR);
+
+op_2e:	/* MVI L, D8 */
+	l = read8(mem, pc + 1);
+	FAST_NEXT(2, CYCLES_MVI_REG);
+
+op_2f:	/* CMA */
+	a = (uint8_t)~a;
+	FAST_NEXT(1, CYCLES_CMA);
+
+op_31:	/* LXI SP, D16 */
+	sp = read16(mem, pc + 1);
+	FAST_NEXT(3, CYCLES_LXI);
+
+op_32:	/* STA adr */
+	write8(mem, read16(mem, pc + 1), a);
+	FAST_NEXT(3, CYCLES_STA);
+
+op_33:	/* INX SP */
+	sp = (uint16_t)(sp + 1);
+	FAST_NEXT(1, CYCLES_INX);
+
+op_34:	/* INR M */
+	{
+		uint16_t addr = FAST_HL();
+		uint8_t val = read8(mem, addr);
+		FAST_INR(val);
+		write8(mem, addr, val);
+	}
+	FAST_NEXT(1, CYCLES_INR_MEM);
+
+op_35:	/* DCR M */
+	{
+		uint16_t addr = FAST_HL();
+		uint8_t val = read8(mem, addr);
+		FAST_DCR(val);
+		write8(mem, addr, val);
+	}
+	FAST_NEXT(1, CYCLES_DCR_MEM);
+
+op_36:	/* MVI M,D8 */
+	write8(mem, FAST_HL(), read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_MVI_MEM);
+
+op_37:	/* STC */
+	f |= FLAGS_CARRY;
+	FAST_NEXT(1, CYCLES_STC);
+
+op_39:	/* DAD SP */
+	{
+		uint32_t sum = (uint32_t)FAST_HL() + sp;
+		f = (sum > 0xffff) ? (f | FLAGS_CARRY) : (f & ~FLAGS_CARRY);
+		FAST_SET_HL(sum);
+	}
+	FAST_NEXT(1, CYCLES_DAD);
+
+op_3a:	/* LDA adr */
+	a = read8(mem, read16(mem, pc + 1));
+	FAST_NEXT(3, CYCLES_LDA);
+
+op_3b:	/* DCX SP */
+	sp = (uint16_t)(sp - 1);
+	FAST_NEXT(1, CYCLES_DCX);
+
+op_3c:	/* INR A */
+	FAST_INR(a);
+	FAST_NEXT(1, CYCLES_INR);
+
+op_3d:	/* DCR A */
+	FAST_DCR(a);
+	if (fusion && read8(mem, pc + 1) == 0xc2)	/* + JNZ */
+		FAST_FUSE_JCC(1, CYCLES_DCR, !(f & FLAGS_ZERO));
+	FAST_NEXT(1, CYCLES_DCR);
+
+op_3e:	/* MVI A,D8 */
+	a = read8(mem, pc + 1);
+	FAST_NEXT(2, CYCLES_MVI_REG);
+
+op_3f:	/* CMC */
+	f ^= FLAGS_CARRY;
+	FAST_NEXT(1, CYCLES_CMC);
+
+op_40:	/* MOV B,B */
+	b = b;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_41:	/* MOV B,C */
+	b = c;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_42:	/* MOV B,D */
+	b = d;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_43:	/* MOV B,E */
+	b = e;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_44:	/* MOV B,H */
+	b = h;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_45:	/* MOV B,L */
+	b = l;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_46:	/* MOV B,M */
+	b = read8(mem, FAST_HL());
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_47:	/* MOV B,A */
+	b = a;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_48:	/* MOV C,B */
+	c = b;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_49:	/* MOV C,C */
+	c = c;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_4a:	/* MOV C,D */
+	c = d;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_4b:	/* MOV C,E */
+	c = e;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_4c:	/* MOV C,H */
+	c = h;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_4d:	/* MOV C,L */
+	c = l;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_4e:	/* MOV C,M */
+	c = read8(mem, FAST_HL());
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_4f:	/* MOV C,A */
+	c = a;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_50:	/* MOV D,B */
+	d = b;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_51:	/* MOV D,C */
+	d = c;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_52:	/* MOV D,D */
+	d = d;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_53:	/* MOV D,E */
+	d = e;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_54:	/* MOV D,H */
+	d = h;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_55:	/* MOV D,L */
+	d = l;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_56:	/* MOV D,M */
+	d = read8(mem, FAST_HL());
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_57:	/* MOV D,A */
+	d = a;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_58:	/* MOV E,B */
+	e = b;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_59:	/* MOV E,C */
+	e = c;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_5a:	/* MOV E,D */
+	e = d;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_5b:	/* MOV E,E */
+	e = e;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_5c:	/* MOV E,H */
+	e = h;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_5d:	/* MOV E,L */
+	e = l;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_5e:	/* MOV E,M */
+	e = read8(mem, FAST_HL());
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_5f:	/* MOV E,A */
+	e = a;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_60:	/* MOV H,B */
+	h = b;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_61:	/* MOV H,C */
+	h = c;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_62:	/* MOV H,D */
+	h = d;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_63:	/* MOV H,E */
+	h = e;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_64:	/* MOV H,H */
+	h = h;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_65:	/* MOV H,L */
+	h = l;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_66:	/* MOV H,M */
+	h = read8(mem, FAST_HL());
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_67:	/* MOV H,A */
+	h = a;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_68:	/* MOV L,B */
+	l = b;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_69:	/* MOV L,C */
+	l = c;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_6a:	/* MOV L,D */
+	l = d;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_6b:	/* MOV L,E */
+	l = e;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_6c:	/* MOV L,H */
+	l = h;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_6d:	/* MOV L,L */
+	l = l;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_6e:	/* MOV L,M */
+	l = read8(mem, FAST_HL());
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_6f:	/* MOV L,A */
+	l = a;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_70:	/* MOV M,B */
+	write8(mem, FAST_HL(), b);
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_71:	/* MOV M,C */
+	write8(mem, FAST_HL(), c);
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_72:	/* MOV M,D */
+	write8(mem, FAST_HL(), d);
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_73:	/* MOV M,E */
+	write8(mem, FAST_HL(), e);
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_74:	/* MOV M,H */
+	write8(mem, FAST_HL(), h);
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_75:	/* MOV M,L */
+	write8(mem, FAST_HL(), l);
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_76:	/* HLT */
+	pc++;
+	cpu->halted = true;
+	executed += CYCLES_HLT;
+	if (cpu->int_pending && (f & FLAGS_IF))
+	{
+		// Already interrupted: acknowledge now rather than next batch
+		FAST_SPILL();
+		executed += i8080_check_interrupts(cpu);
+		FAST_RELOAD();
+		FAST_DISPATCH(0);
+	}
+	if (executed < cycle_budget)
+		executed = cycle_budget;	// the rest of the batch passes in HLT
+	goto done;
+
+op_77:	/* MOV M,A */
+	write8(mem, FAST_HL(), a);
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_78:	/* MOV A,B */
+	a = b;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_79:	/* MOV A,C */
+	a = c;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_7a:	/* MOV A,D */
+	a = d;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_7b:	/* MOV A,E */
+	a = e;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_7c:	/* MOV A,H */
+	a = h;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_7d:	/* MOV A,L */
+	a = l;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_7e:	/* MOV A,M */
+	a = read8(mem, FAST_HL());
+	if (fusion && read8(mem, pc + 1) == 0x23)	/* + INX H */
+	{
+		fused++;
+		FAST_SET_HL(FAST_HL() + 1);
+		FAST_NEXT(2, CYCLES_MOV_MEM + CYCLES_INX);
+	}
+	FAST_NEXT(1, CYCLES_MOV_MEM);
+
+op_7f:	/* MOV A,A */
+	a = a;
+	FAST_NEXT(1, CYCLES_MOV_REG);
+
+op_80:	/* ADD B */
+	FAST_ADD(b);
+	FAST_NEXT(1, CYCLES_ADD);
+
+op_81:	/* ADD C */
+	FAST_ADD(c);
+	FAST_NEXT(1, CYCLES_ADD);
+
+op_82:	/* ADD D */
+	FAST_ADD(d);
+	FAST_NEXT(1, CYCLES_ADD);
+
+op_83:	/* ADD E */
+	FAST_ADD(e);
+	FAST_NEXT(1, CYCLES_ADD);
+
+op_84:	/* ADD H */
+	FAST_ADD(h);
+	FAST_NEXT(1, CYCLES_ADD);
+
+op_85:	/* ADD L */
+	FAST_ADD(l);
+	FAST_NEXT(1, CYCLES_ADD);
+
+op_86:	/* ADD M */
+	FAST_ADD(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_87:	/* ADD A */
+	FAST_ADD(a);
+	FAST_NEXT(1, CYCLES_ADD);
+
+op_88:	/* ADC B */
+	FAST_ADC(b);
+	FAST_NEXT(1, CYCLES_ADC);
+
+op_89:	/* ADC C */
+	FAST_ADC(c);
+	FAST_NEXT(1, CYCLES_ADC);
+
+op_8a:	/* ADC D */
+	FAST_ADC(d);
+	FAST_NEXT(1, CYCLES_ADC);
+
+op_8b:	/* ADC E */
+	FAST_ADC(e);
+	FAST_NEXT(1, CYCLES_ADC);
+
+op_8c:	/* ADC H */
+	FAST_ADC(h);
+	FAST_NEXT(1, CYCLES_ADC);
+
+op_8d:	/* ADC L */
+	FAST_ADC(l);
+	FAST_NEXT(1, CYCLES_ADC);
+
+op_8e:	/* ADC M */
+	FAST_ADC(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_8f:	/* ADC A */
+	FAST_ADC(a);
+	FAST_NEXT(1, CYCLES_ADC);
+
+op_90:	/* SUB B */
+	FAST_SUB(b);
+	FAST_NEXT(1, CYCLES_SUB);
+
+op_91:	/* SUB C */
+	FAST_SUB(c);
+	FAST_NEXT(1, CYCLES_SUB);
+
+op_92:	/* SUB D */
+	FAST_SUB(d);
+	FAST_NEXT(1, CYCLES_SUB);
+
+op_93:	/* SUB E */
+	FAST_SUB(e);
+	FAST_NEXT(1, CYCLES_SUB);
+
+op_94:	/* SUB H */
+	FAST_SUB(h);
+	FAST_NEXT(1, CYCLES_SUB);
+
+op_95:	/* SUB L */
+	FAST_SUB(l);
+	FAST_NEXT(1, CYCLES_SUB);
+
+op_96:	/* SUB M */
+	FAST_SUB(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_97:	/* SUB A */
+	FAST_SUB(a);
+	FAST_NEXT(1, CYCLES_SUB);
+
+op_98:	/* SBB B */
+	FAST_SBB(b);
+	FAST_NEXT(1, CYCLES_SBB);
+
+op_99:	/* SBB C */
+	FAST_SBB(c);
+	FAST_NEXT(1, CYCLES_SBB);
+
+op_9a:	/* SBB D */
+	FAST_SBB(d);
+	FAST_NEXT(1, CYCLES_SBB);
+
+op_9b:	/* SBB E */
+	FAST_SBB(e);
+	FAST_NEXT(1, CYCLES_SBB);
+
+op_9c:	/* SBB H */
+	FAST_SBB(h);
+	FAST_NEXT(1, CYCLES_SBB);
+
+op_9d:	/* SBB L */
+	FAST_SBB(l);
+	FAST_NEXT(1, CYCLES_SBB);
+
+op_9e:	/* SBB M */
+	FAST_SBB(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_9f:	/* SBB A */
+	FAST_SBB(a);
+	FAST_NEXT(1, CYCLES_SBB);
+
+op_a0:	/* ANA B */
+	FAST_ANA(b);
+	FAST_NEXT(1, CYCLES_ANA);
+
+op_a1:	/* ANA C */
+	FAST_ANA(c);
+	FAST_NEXT(1, CYCLES_ANA);
+
+op_a2:	/* ANA D */
+	FAST_ANA(d);
+	FAST_NEXT(1, CYCLES_ANA);
+
+op_a3:	/* ANA E */
+	FAST_ANA(e);
+	FAST_NEXT(1, CYCLES_ANA);
+
+op_a4:	/* ANA H */
+	FAST_ANA(h);
+	FAST_NEXT(1, CYCLES_ANA);
+
+op_a5:	/* ANA L */
+	FAST_ANA(l);
+	FAST_NEXT(1, CYCLES_ANA);
+
+op_a6:	/* ANA M */
+	FAST_ANA(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_a7:	/* ANA A */
+	FAST_ANA(a);
+	FAST_NEXT(1, CYCLES_ANA);
+
+op_a8:	/* XRA B */
+	FAST_XRA(b);
+	FAST_NEXT(1, CYCLES_XRA);
+
+op_a9:	/* XRA C */
+	FAST_XRA(c);
+	FAST_NEXT(1, CYCLES_XRA);
+
+op_aa:	/* XRA D */
+	FAST_XRA(d);
+	FAST_NEXT(1, CYCLES_XRA);
+
+op_ab:	/* XRA E */
+	FAST_XRA(e);
+	FAST_NEXT(1, CYCLES_XRA);
+
+op_ac:	/* XRA H */
+	FAST_XRA(h);
+	FAST_NEXT(1, CYCLES_XRA);
+
+op_ad:	/* XRA L */
+	FAST_XRA(l);
+	FAST_NEXT(1, CYCLES_XRA);
+
+op_ae:	/* XRA M */
+	FAST_XRA(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_af:	/* XRA A */
+	FAST_XRA(a);
+	FAST_NEXT(1, CYCLES_XRA);
+
+op_b0:	/* ORA B */
+	FAST_ORA(b);
+	FAST_NEXT(1, CYCLES_ORA);
+
+op_b1:	/* ORA C */
+	FAST_ORA(c);
+	FAST_NEXT(1, CYCLES_ORA);
+
+op_b2:	/* ORA D */
+	FAST_ORA(d);
+	FAST_NEXT(1, CYCLES_ORA);
+
+op_b3:	/* ORA E */
+	FAST_ORA(e);
+	FAST_NEXT(1, CYCLES_ORA);
+
+op_b4:	/* ORA H */
+	FAST_ORA(h);
+	FAST_NEXT(1, CYCLES_ORA);
+
+op_b5:	/* ORA L */
+	FAST_ORA(l);
+	FAST_NEXT(1, CYCLES_ORA);
+
+op_b6:	/* ORA M */
+	FAST_ORA(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_b7:	/* ORA A */
+	FAST_ORA(a);
+	FAST_NEXT(1, CYCLES_ORA);
+
+op_b8:	/* CMP B */
+	FAST_CMP(b);
+	FAST_NEXT(1, CYCLES_CMP);
+
+op_b9:	/* CMP C */
+	FAST_CMP(c);
+	FAST_NEXT(1, CYCLES_CMP);
+
+op_ba:	/* CMP D */
+	FAST_CMP(d);
+	FAST_NEXT(1, CYCLES_CMP);
+
+op_bb:	/* CMP E */
+	FAST_CMP(e);
+	FAST_NEXT(1, CYCLES_CMP);
+
+op_bc:	/* CMP H */
+	FAST_CMP(h);
+	FAST_NEXT(1, CYCLES_CMP);
+
+op_bd:	/* CMP L */
+	FAST_CMP(l);
+	FAST_NEXT(1, CYCLES_CMP);
+
+op_be:	/* CMP M */
+	FAST_CMP(read8(mem, FAST_HL()));
+	FAST_NEXT(1, CYCLES_ALU_MEM);
+
+op_bf:	/* CMP A */
+	FAST_CMP(a);
+	FAST_NEXT(1, CYCLES_CMP);
+
+op_c0:	/* RNZ */
+	if (!(f & FLAGS_ZERO))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_c1:	/* POP B */
+	FAST_SET_BC(read16(mem, sp));
+	sp += 2;
+	FAST_NEXT(1, CYCLES_POP);
+
+op_c2:	/* JNZ adr */
+	pc = (!(f & FLAGS_ZERO)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_c3:	/* JMP adr */
+	pc = read16(mem, pc + 1);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_c4:	/* CNZ adr */
+	if (!(f & FLAGS_ZERO))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
 	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_c5:	/* PUSH B */
+	sp -= 2;
+	write16(mem, sp, FAST_BC());
+	FAST_NEXT(1, CYCLES_PUSH);
+
+op_c6:	/* ADI D8 */
+	FAST_ADD(read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_ADI);
+
+op_c7:	/* RST 0 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x00;
+	FAST_DISPATCH(CYCLES_RST);
+
+op_c8:	/* RZ */
+	if ((f & FLAGS_ZERO))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_c9:	/* RET */
+	pc = read16(mem, sp);
+	sp += 2;
+	FAST_DISPATCH(CYCLES_RET);
+
+op_ca:	/* JZ adr */
+	pc = ((f & FLAGS_ZERO)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_cc:	/* CZ adr */
+	if ((f & FLAGS_ZERO))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
+	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_cd:	/* CALL adr */
+	FAST_CALL();
+	FAST_DISPATCH(CYCLES_CALL);
+
+op_ce:	/* ACI D8 */
+	FAST_ADC(read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_ACI);
+
+op_cf:	/* RST 1 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x08;
+	FAST_DISPATCH(CYCLES_RST);
+
+op_d0:	/* RNC */
+	if (!(f & FLAGS_CARRY))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_d1:	/* POP D */
+	FAST_SET_DE(read16(mem, sp));
+	sp += 2;
+	FAST_NEXT(1, CYCLES_POP);
+
+op_d2:	/* JNC adr */
+	pc = (!(f & FLAGS_CARRY)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_d3:	/* OUT D8 */
+	{
+		FAST_SPILL();
+		// Devices time their output by cpu->cycles
+		cpu->cycles += executed;
+		uint8_t _cycles = i8080_out(cpu);
+		cpu->cycles -= executed;
+		FAST_RELOAD();
+		FAST_DISPATCH(_cycles);
+	}
+
+op_d4:	/* CNC adr */
+	if (!(f & FLAGS_CARRY))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
+	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_d5:	/* PUSH D */
+	sp -= 2;
+	write16(mem, sp, FAST_DE());
+	FAST_NEXT(1, CYCLES_PUSH);
+
+op_d6:	/* SUI D8 */
+	FAST_SUB(read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_SUI);
+
+op_d7:	/* RST 2 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x10;
+	FAST_DISPATCH(CYCLES_RST);
+
+op_d8:	/* RC */
+	if ((f & FLAGS_CARRY))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_da:	/* JC adr */
+	pc = ((f & FLAGS_CARRY)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_db:	/* IN D8 */
+	{
+		FAST_SPILL();
+		// The console idle detector and paced devices read cpu->cycles
+		cpu->cycles += executed;
+		uint8_t _cycles = i8080_in(cpu);
+		cpu->cycles -= executed;
+		FAST_RELOAD();
+		if (UNLIKELY(cpu->console_idle))
+		{
+			executed += _cycles;
+			goto done;
+		}
+		FAST_DISPATCH(_cycles);
+	}
+
+op_dc:	/* CC adr */
+	if ((f & FLAGS_CARRY))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
+	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_de:	/* SBI D8 */
+	FAST_SBB(read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_SBI);
+
+op_df:	/* RST 3 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x18;
+	FAST_DISPATCH(CYCLES_RST);
+
+op_e0:	/* RPO */
+	if (!(f & FLAGS_PARITY))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_e1:	/* POP H */
+	FAST_SET_HL(read16(mem, sp));
+	sp += 2;
+	FAST_NEXT(1, CYCLES_POP);
+
+op_e2:	/* JPO adr */
+	pc = (!(f & FLAGS_PARITY)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_e3:	/* XTHL */
+	{
+		uint16_t temp = read16(mem, sp);
+		write16(mem, sp, FAST_HL());
+		FAST_SET_HL(temp);
+	}
+	FAST_NEXT(1, CYCLES_XTHL);
+
+op_e4:	/* CPO adr */
+	if (!(f & FLAGS_PARITY))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
+	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_e5:	/* PUSH H */
+	sp -= 2;
+	write16(mem, sp, FAST_HL());
+	FAST_NEXT(1, CYCLES_PUSH);
+
+op_e6:	/* ANI D8 */
+	FAST_ANI(read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_ANI);
+
+op_e7:	/* RST 4 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x20;
+	FAST_DISPATCH(CYCLES_RST);
+
+op_e8:	/* RPE */
+	if ((f & FLAGS_PARITY))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_e9:	/* PCHL */
+	pc = FAST_HL();
+	FAST_DISPATCH(CYCLES_PCHL);
+
+op_ea:	/* JPE adr */
+	pc = ((f & FLAGS_PARITY)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_eb:	/* XCHG */
+	{
+		uint8_t tmp = d;
+		d = h;
+		h = tmp;
+		tmp = e;
+		e = l;
+		l = tmp;
+	}
+	FAST_NEXT(1, CYCLES_XCHG);
+
+op_ec:	/* CPE adr */
+	if ((f & FLAGS_PARITY))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
+	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_ee:	/* XRI D8 */
+	FAST_XRA(read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_XRI);
+
+op_ef:	/* RST 5 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x28;
+	FAST_DISPATCH(CYCLES_RST);
+
+op_f0:	/* RP */
+	if (!(f & FLAGS_SIGN))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_f1:	/* POP PSW */
+	{
+		uint16_t val = read16(mem, sp);
+		sp += 2;
+		a = val >> 8;
+		f = val & 0xff;
+	}
+	FAST_NEXT(1, CYCLES_POP);
+
+op_f2:	/* JP adr */
+	pc = (!(f & FLAGS_SIGN)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_f3:	/* DI */
+	f &= ~FLAGS_IF;
+	FAST_NEXT(1, CYCLES_DI);
+
+op_f4:	/* CP adr */
+	if (!(f & FLAGS_SIGN))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
+	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_f5:	/* PUSH PSW */
+	sp -= 2;
+	write16(mem, sp, (uint16_t)((a << 8) | f));
+	FAST_NEXT(1, CYCLES_PUSH);
+
+op_f6:	/* ORI D8 */
+	FAST_ORA(read8(mem, pc + 1));
+	FAST_NEXT(2, CYCLES_ORI);
+
+op_f7:	/* RST 6 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x30;
+	FAST_DISPATCH(CYCLES_RST);
+
+op_f8:	/* RM */
+	if ((f & FLAGS_SIGN))
+	{
+		pc = read16(mem, sp);
+		sp += 2;
+		FAST_DISPATCH(CYCLES_RCC_TAKEN);
+	}
+	FAST_NEXT(1, CYCLES_RCC);
+
+op_f9:	/* SPHL */
+	sp = FAST_HL();
+	FAST_NEXT(1, CYCLES_SPHL);
+
+op_fa:	/* JM adr */
+	pc = ((f & FLAGS_SIGN)) ? read16(mem, pc + 1) : (uint16_t)(pc + 3);
+	FAST_DISPATCH(CYCLES_JMP);
+
+op_fb:	/* EI */
+	f |= FLAGS_IF;
+	cpu->ei_delay = 1;
+	ei_executed = executed + CYCLES_EI;
+	FAST_NEXT(1, CYCLES_EI);
+
+op_fc:	/* CM adr */
+	if ((f & FLAGS_SIGN))
+	{
+		FAST_CALL();
+		FAST_DISPATCH(CYCLES_CALL);
+	}
+	FAST_NEXT(3, CYCLES_CCC);
+
+op_fe:	/* CPI D8 */
+	FAST_CMP(read8(mem, pc + 1));
+	if (fusion)
+	{
+		uint8_t next = read8(mem, pc + 2);
+		if (next == 0xca)	/* + JZ */
+			FAST_FUSE_JCC(2, CYCLES_CPI, f & FLAGS_ZERO);
+		if (next == 0xc2)	/* + JNZ */
+			FAST_FUSE_JCC(2, CYCLES_CPI, !(f & FLAGS_ZERO));
+	}
+	FAST_NEXT(2, CYCLES_CPI);
+
+op_ff:	/* RST 7 */
+	sp -= 2;
+	write16(mem, sp, pc + 1);
+	pc = 0x38;
+	FAST_DISPATCH(CYCLES_RST);
+
+done:
+	FAST_SPILL();
+
+	// The instruction after an EI ran in this batch, so the delay is over
+	if (cpu->ei_delay && executed != ei_executed)
+		cpu->ei_delay = 0;
+
+	// Leave the bus showing the next opcode fetch, as i8080_examine() would
+	cpu->address_bus = pc;
+	cpu->current_op_code = cpu->data_bus = read8(mem, pc);
+	cpu->cpuStatus = cpu->halted ? STATUS_HALT | STATUS_MEMORY_READ : STATUS_MEMORY_READ;
+	cpu->cycles += executed;
+	cpu->fused += fused;
+
+	return executed;
+}
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+uint32_t i8080_run_fast(intel8080_t *cpu, uint32_t cycle_budget)
+{
+	return run_fast(cpu, cycle_budget, NULL);
+}
+
+uint32_t i8080_run_guarded(intel8080_t *cpu, uint32_t cycle_budget, const i8080_guard_t *guard)
+{
+	return run_fast(cpu, cycle_budget, guard);
+}
+#endif
+
+#else
+
+void i8080_set_fusion(bool enabled)
+{
+	(void)enabled;
 }
+
+bool i8080_get_fusion(void)
+{
+	return false;
+}
+
+uint32_t i8080_run_fast(intel8080_t *cpu, uint32_t cycle_budget)
+{
+	return i8080_run(cpu, cycle_budget);
+}
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+// Without the threaded core every instruction goes to the caller's checks
+uint32_t i8080_run_guarded(intel8080_t *cpu, uint32_t cycle_budget, const i8080_guard_t *guard)
+{
+	(void)cpu;
+	(void)cycle_budget;
+	(void)guard;
+	return 0;
+}
+#endif
+
+#endif
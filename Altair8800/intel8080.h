@@ -2,6 +2,7 @@
 #define _INTEL8080_H_
 
 #include "types.h"
+#include <stdbool.h>
 
 #define FLAGS_CARRY		0x1
 #define FLAGS_PARITY		0x4
@@ -10,6 +11,25 @@
 #define FLAGS_ZERO		64
 #define FLAGS_SIGN		128
 
+// Defer flag computation in the table-driven core until an instruction reads
+// the flags. registers.flags is always up to date when i8080_cycle() or
+// i8080_run() returns. Off by default: with the flag lookup tables the eager
+// path is cheaper than the bookkeeping. Build with -DI8080_LAZY_FLAGS=1 to
+// enable.
+#ifndef I8080_LAZY_FLAGS
+#define I8080_LAZY_FLAGS 0
+#endif
+
+// Cache decoded instructions (handler, length, immediate operand) by PC in the
+// table-driven core. Costs about 12 bytes of RAM per entry. Pages written
+// through write8()/write16() are re-decoded before they execute again.
+#ifndef I8080_DECODE_CACHE
+#define I8080_DECODE_CACHE 0
+#endif
+#ifndef I8080_DECODE_CACHE_SIZE
+#define I8080_DECODE_CACHE_SIZE 1024
+#endif
+
 typedef struct
 {
 	union
@@ -57,51 +77,129 @@ typedef struct
 	uint16_t pc;
 } registers_t;
 
-typedef void (*io_port_out_fn)(uint8_t port, uint8_t data);
-typedef uint8_t (*io_port_in_fn)(uint8_t port);
+// Operands of the last flag-setting ALU instruction (I8080_LAZY_FLAGS)
+typedef struct
+{
+	uint8_t op;
+	uint8_t a;
+	uint8_t result;
+	uint16_t val;
+} i8080_lazy_flags_t;
 
+// Console callbacks (PortDrivers/console_io.h)
 typedef void (*port_out)(uint8_t b);
 typedef uint8_t (*port_in)(void);
-typedef uint8_t (*read_sense_switches)(void);
-
-typedef struct
-{
-	port_out disk_select;
-	port_in	disk_status;
-	port_out disk_function;
-	port_in sector;
-	port_out write;
-	port_in read;
-} disk_controller_t;
 
 typedef struct
 {
+	uint8_t *memory;	// 64 KB address space of this machine
 	uint8_t data_bus;
 	uint16_t address_bus;
 
 	uint8_t current_op_code;
+	uint16_t operand;	// immediate operand of current_op_code (I8080_DECODE_CACHE)
 
 	registers_t registers;
 
-	io_port_in_fn io_port_in_handler;
-	io_port_out_fn io_port_out_handler;
-
-	port_in term_in;
-	port_out term_out;
-	read_sense_switches sense;
 	uint8_t cpuStatus;
 
-	disk_controller_t disk_controller;
+	uint64_t cycles;	// T-states executed since reset
+	uint64_t fused;		// instruction pairs run as one superinstruction
+
+	// Interrupt request lines, one per RST vector. A line is raised with
+	// i8080_request_interrupt() and dropped when the CPU acknowledges it.
+	union
+	{
+		volatile uint8_t int_line[8];
+		volatile uint64_t int_pending;	// nonzero while any line is raised
+	};
+	uint8_t ei_delay;	// EI takes effect after the next instruction
+	bool halted;		// HLT executed, waiting for an interrupt or reset
+
+	// Console idle detection: set when the program is spinning on an empty
+	// console status port. The run loops end the batch early; the caller
+	// clears it once it has waited for input.
+	bool console_idle;
+	bool console_polled;		// the current IN reported itself (i8080_console_poll)
+	uint16_t idle_poll_pc;		// first poll of the current run
+	uint16_t idle_polls;		// consecutive empty polls
+	uint64_t idle_poll_cycles;	// cycles at the last poll
+
+	i8080_lazy_flags_t lazy_flags;
 } intel8080_t;
 
-void i8080_reset(intel8080_t *cpu, port_in in, port_out out, read_sense_switches sense,
-		 disk_controller_t *disk_controller, io_port_in_fn io_in, io_port_out_fn io_out);
+// Each intel8080_t runs over its own 64 KB of memory, so one process can host
+// several machines. IN and OUT go through the process-wide port table
+// (io_ports.h), as do the decode cache, profiler and trace ring; run one
+// machine per process when it does I/O or in builds with I8080_DECODE_CACHE,
+// I8080_PROFILER or I8080_TRACE.
+void i8080_reset(intel8080_t *cpu, uint8_t *memory);
 void i8080_deposit(intel8080_t *cpu, uint8_t data);
 void i8080_deposit_next(intel8080_t *cpu, uint8_t data);
 
 void i8080_examine(intel8080_t *cpu, uint16_t address);
 void i8080_examine_next(intel8080_t *cpu);
 
-void i8080_cycle(intel8080_t *cpu);
+// Raise the interrupt request line for RST rst (0-7). Safe to call from the
+// other core or an IRQ handler. The request is taken at the next instruction
+// boundary the core checks once interrupts are enabled; RST 0 has the highest
+// priority. An acknowledged interrupt also ends HLT.
+void i8080_request_interrupt(intel8080_t *cpu, uint8_t rst);
+
+// Console devices report each read of their ports from their IN handler, so
+// the run loops can tell a program spinning on an empty console: empty says
+// no input was waiting. A status read that can't see input (the 88-SIO status
+// port always reads ready) is reported with i8080_console_status(). Any other
+// IN, and every OUT, restarts the count.
+void i8080_console_poll(intel8080_t *cpu, bool empty);
+void i8080_console_status(intel8080_t *cpu);
+
+// Execute one instruction and return its cost in T-states
+uint8_t i8080_cycle(intel8080_t *cpu);
+
+// Execute instructions until at least cycle_budget T-states have elapsed.
+// Returns the T-states actually executed (the last instruction may overshoot).
+// A halted CPU with no interrupt to take idles away the whole budget at once.
+// The batch ends early when console_idle is set.
+uint32_t i8080_run(intel8080_t *cpu, uint32_t cycle_budget);
+
+#if I8080_DECODE_CACHE
+typedef struct
+{
+	uint64_t hits;
+	uint64_t misses;
+	uint32_t invalidations;	// dirty pages flushed
+} i8080_decode_stats_t;
+
+void i8080_decode_cache_get_stats(i8080_decode_stats_t *stats);
+void i8080_decode_cache_clear_stats(void);
+#endif
+
+// Same contract as i8080_run(), using the threaded-dispatch core. Registers are
+// held in locals for the batch; the bus/status fields are synced on return.
+// Interrupt requests are checked when a batch starts, so they are taken within
+// one batch of being raised. It does not feed the execution trace (trace.h).
+uint32_t i8080_run_fast(intel8080_t *cpu, uint32_t cycle_budget);
+
+// Superinstruction fusion in i8080_run_fast() (on by default). Fused pairs are
+// counted in cpu->fused.
+void i8080_set_fusion(bool enabled);
+bool i8080_get_fusion(void);
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+// Pages i8080_run_guarded() must not run into, one bit per 256-byte page (bit
+// n of word n / 32)
+typedef struct
+{
+	const uint32_t *code_pages;	// instructions that start in these pages
+	const uint32_t *data_pages;	// optional: data accesses to these pages
+} i8080_guard_t;
+
+// Same contract as i8080_run_fast(), but the batch also ends, without running
+// it, before an instruction the guard flags, so the caller can run that one
+// with its own checks. Data accesses are judged by page and, for Ccc and Rcc,
+// as if the condition held. Superinstruction fusion is off.
+uint32_t i8080_run_guarded(intel8080_t *cpu, uint32_t cycle_budget, const i8080_guard_t *guard);
+#endif
 
 #endif
@@ -4,6 +4,16 @@
 // Altair system memory - 64KB
 uint8_t memory[64 * 1024] = {0};
 
+#if defined(I8080_DECODE_CACHE) && I8080_DECODE_CACHE
+uint32_t memory_dirty_pages[8];
+
+// For bulk loads that bypass write8()/write16()
+void memory_mark_all_dirty(void)
+{
+    memset(memory_dirty_pages, 0xff, sizeof(memory_dirty_pages));
+}
+#endif
+
 // ROM data stored in flash (XIP)
 #include "88dskrom.h"
 #include "8krom.h"
@@ -13,6 +23,7 @@ void loadDiskLoader(uint16_t address)
 {
     // Copy ROM data from flash to RAM
     memcpy(&memory[address], disk_loader_rom, sizeof(disk_loader_rom));
+    memory_mark_all_dirty();
 }
 
 // Load 8K BASIC ROM into memory at specified address
@@ -20,4 +31,5 @@ void load8kRom(uint16_t address)
 {
     // Copy ROM data from flash to RAM
     memcpy(&memory[address], basic_8k_rom, sizeof(basic_8k_rom));
+    memory_mark_all_dirty();
 }
@@ -4,31 +4,77 @@
 #include "altair_panel.h"
 #include "types.h"
 
+// The firmware's memory. Each intel8080_t carries a pointer to its own
+// 64 KB address space (cpu->memory); this is the one i8080_reset() is given
+// on the Pico, and what the boot loaders and snapshots fill. Only the
+// address space is per CPU: disks, console and ports are process-wide, as is
+// the decode cache's dirty page map below.
 extern uint8_t memory[64 * 1024];
 
 void loadDiskLoader(uint16_t address);
 void load8kRom(uint16_t address);
 
-// Inline memory operations for better performance
-static inline uint8_t read8(uint16_t address)
+#if defined(I8080_DECODE_CACHE) && I8080_DECODE_CACHE
+// One bit per 256-byte page written since the decode cache last looked at it
+extern uint32_t memory_dirty_pages[8];
+
+void memory_mark_all_dirty(void);
+
+static inline void memory_mark_page_dirty(uint16_t address)
+{
+    memory_dirty_pages[address >> 13] |= 1u << ((address >> 8) & 31);
+}
+
+static inline void memory_mark_dirty(uint16_t address)
+{
+    memory_mark_page_dirty(address);
+    // An instruction starting in the last two bytes of the previous page can
+    // have its operand here
+    if ((address & 0xff) < 2)
+    {
+        memory_mark_page_dirty((uint16_t)(address - 2));
+    }
+}
+
+static inline uint32_t memory_page_dirty(uint16_t address)
+{
+    return memory_dirty_pages[address >> 13] & (1u << ((address >> 8) & 31));
+}
+#else
+static inline void memory_mark_all_dirty(void)
+{
+}
+
+static inline void memory_mark_dirty(uint16_t address)
+{
+    (void)address;
+}
+#endif
+
+// Inline memory operations for better performance. They take the address
+// space being run (cpu->memory), so several CPUs can share a process.
+static inline uint8_t read8(const uint8_t* mem, uint16_t address)
 {
-    return memory[address];
+    return mem[address];
 }
 
-static inline void write8(uint16_t address, uint8_t val)
+static inline void write8(uint8_t* mem, uint16_t address, uint8_t val)
 {
-    memory[address] = val;
+    mem[address] = val;
+    memory_mark_dirty(address);
 }
 
-static inline uint16_t read16(uint16_t address)
+static inline uint16_t read16(const uint8_t* mem, uint16_t address)
 {
-    return memory[address] | (memory[address + 1] << 8);
+    return mem[address] | (mem[(uint16_t)(address + 1)] << 8);
 }
 
-static inline void write16(uint16_t address, uint16_t val)
+static inline void write16(uint8_t* mem, uint16_t address, uint16_t val)
 {
-    memory[address] = val & 0xff;
-    memory[address + 1] = (val >> 8) & 0xff;
+    mem[address] = val & 0xff;
+    mem[(uint16_t)(address + 1)] = (val >> 8) & 0xff;
+    memory_mark_dirty(address);
+    memory_mark_dirty((uint16_t)(address + 1));
 }
 
 #endif
@@ -30,6 +30,8 @@
 #define CONDITION_P		6
 #define CONDITION_M		7
 
+// T-states per instruction (Intel 8080 datasheet). Where an instruction has a
+// memory operand or a taken/not-taken path, the variants are listed separately.
 #define CYCLES_JMP		10
 #define CYCLES_NOP		4
 #define CYCLES_MOV_REG	5
@@ -43,7 +45,7 @@
 #define CYCLES_SHLD		16
 #define CYCLES_LDAX		7
 #define CYCLES_STAX		7
-#define CYCLES_XCHG		5
+#define CYCLES_XCHG		4
 #define CYCLES_ADD		4
 #define CYCLES_ADI		7
 #define CYCLES_ADC		4
@@ -52,8 +54,11 @@
 #define CYCLES_SUI		7
 #define CYCLES_SBB		4
 #define CYCLES_SBI		7
+#define CYCLES_ALU_MEM	7
 #define CYCLES_INR		5
+#define CYCLES_INR_MEM	10
 #define CYCLES_DCR		5
+#define CYCLES_DCR_MEM	10
 #define CYCLES_INX		5
 #define CYCLES_DCX		5
 #define CYCLES_DAD		10
@@ -75,15 +80,19 @@
 #define CYCLES_RRC		4
 #define CYCLES_RAL		4
 #define CYCLES_RAR		4
-#define CYCLES_RET		5
+#define CYCLES_RET		10
+#define CYCLES_RCC		5
+#define CYCLES_RCC_TAKEN	11
 #define CYCLES_CALL		17
+#define CYCLES_CCC		11
 #define CYCLES_RST		11
 #define CYCLES_CMP		4
 #define CYCLES_CPI		7
-#define CYCLES_STC		1
-#define CYCLES_CMC		2
-#define CYCLES_CMA		2
+#define CYCLES_STC		4
+#define CYCLES_CMC		4
+#define CYCLES_CMA		4
 #define CYCLES_PCHL		5
-#define CYCLES_DAA		5
+#define CYCLES_DAA		4
+#define CYCLES_HLT		7
 
 #endif
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "pico_88dcdd_flash.h"
+#include "io_ports.h"
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -166,6 +168,42 @@ static void seek_to_track(void)
     disk->sector = 0;
 }
 
+// 88-DCDD ports: 08h select/status, 09h function/sector, 0Ah write/read data
+#define DISK_PORT_STATUS 0x08
+#define DISK_PORT_CONTROL 0x09
+#define DISK_PORT_DATA 0x0A
+
+static uint8_t disk_port_in(void* context, uint8_t port)
+{
+    (void)context;
+    switch (port)
+    {
+        case DISK_PORT_STATUS:
+            return pico_disk_status();
+        case DISK_PORT_CONTROL:
+            return pico_disk_sector();
+        default:
+            return pico_disk_read();
+    }
+}
+
+static void disk_port_out(void* context, uint8_t port, uint8_t data)
+{
+    (void)context;
+    switch (port)
+    {
+        case DISK_PORT_STATUS:
+            pico_disk_select(data);
+            break;
+        case DISK_PORT_CONTROL:
+            pico_disk_function(data);
+            break;
+        default:
+            pico_disk_write(data);
+            break;
+    }
+}
+
 // Initialize disk controller
 void pico_disk_init(void)
 {
@@ -200,7 +238,12 @@ void pico_disk_init(void)
     pico_disk_controller.current = &pico_disk_controller.disk[0];
     pico_disk_controller.current_disk = 0;
 
-    printf("[DISK] Patch pool initialized: %u slots (%u KB)\n", PATCH_POOL_SIZE,
+    for (uint8_t port = DISK_PORT_STATUS; port <= DISK_PORT_DATA; port++)
+    {
+        io_port_register(port, disk_port_in, disk_port_out, NULL);
+    }
+
+    printf("[DISK] Patch pool initialized: %u slots (%zu KB)\n", PATCH_POOL_SIZE,
            (PATCH_POOL_SIZE * sizeof(sector_patch_t)) / 1024);
 }
 
@@ -439,3 +482,75 @@ void pico_disk_get_patch_stats(uint16_t* used, uint16_t* total)
         *total = PATCH_POOL_SIZE;
     }
 }
+
+// Everything in pico_disk_t from track on; the image pointer and size come
+// from pico_disk_load()
+#define DISK_STATE_OFFSET offsetof(pico_disk_t, track)
+#define DISK_STATE_SIZE (sizeof(pico_disk_t) - DISK_STATE_OFFSET)
+
+void pico_disk_save_state(snapshot_stream_t* stream)
+{
+    for (int i = 0; i < MAX_DRIVES; i++)
+    {
+        snapshot_write(stream, (const uint8_t*)&pico_disk_controller.disk[i] + DISK_STATE_OFFSET, DISK_STATE_SIZE);
+    }
+    snapshot_write(stream, &pico_disk_controller.current_disk, sizeof(pico_disk_controller.current_disk));
+
+    // Only the patches in use; free slots are rebuilt on restore
+    snapshot_write(stream, &g_patch_pool_used, sizeof(g_patch_pool_used));
+    for (uint16_t i = 0; i < PATCH_POOL_SIZE; i++)
+    {
+        if (g_patch_pool[i].index != PATCH_INDEX_INVALID)
+        {
+            snapshot_write(stream, &i, sizeof(i));
+            snapshot_write(stream, &g_patch_pool[i], sizeof(g_patch_pool[i]));
+        }
+    }
+}
+
+bool pico_disk_restore_state(snapshot_stream_t* stream)
+{
+    uint16_t used;
+    uint8_t current_disk;
+
+    for (int i = 0; i < MAX_DRIVES; i++)
+    {
+        pico_disk_t* disk = &pico_disk_controller.disk[i];
+        bool loaded = disk->disk_loaded;
+
+        if (!snapshot_read(stream, (uint8_t*)disk + DISK_STATE_OFFSET, DISK_STATE_SIZE))
+        {
+            return false;
+        }
+        disk->disk_loaded = loaded;
+    }
+
+    if (!snapshot_read(stream, &current_disk, sizeof(current_disk)) || current_disk >= MAX_DRIVES ||
+        !snapshot_read(stream, &used, sizeof(used)) || used > PATCH_POOL_SIZE)
+    {
+        return false;
+    }
+    pico_disk_controller.current_disk = current_disk;
+    pico_disk_controller.current = &pico_disk_controller.disk[current_disk];
+
+    for (uint16_t i = 0; i < PATCH_POOL_SIZE; i++)
+    {
+        g_patch_pool[i].index = PATCH_INDEX_INVALID;
+        g_patch_pool[i].next_pool_index = PATCH_INDEX_INVALID;
+    }
+
+    for (uint16_t n = 0; n < used; n++)
+    {
+        uint16_t slot;
+        if (!snapshot_read(stream, &slot, sizeof(slot)) || slot >= PATCH_POOL_SIZE ||
+            !snapshot_read(stream, &g_patch_pool[slot], sizeof(g_patch_pool[slot])))
+        {
+            return false;
+        }
+    }
+
+    g_patch_pool_used = used;
+    g_patch_pool_next_free = 0;
+    g_patch_pool_exhausted = false;
+    return true;
+}
@@ -1,6 +1,7 @@
 #ifndef _PICO_88DCDD_FLASH_H_
 #define _PICO_88DCDD_FLASH_H_
 
+#include "snapshot.h"
 #include "types.h"
 #include <stdbool.h>
 
@@ -88,11 +89,16 @@ uint8_t pico_disk_sector(void);
 void pico_disk_write(uint8_t data);
 uint8_t pico_disk_read(void);
 
-// Initialization
+// Initialization; also registers the controller on ports 08h-0Ah
 void pico_disk_init(void);
 bool pico_disk_load(uint8_t drive, const uint8_t* disk_image, uint32_t size);
 
 // Statistics
 void pico_disk_get_patch_stats(uint16_t* used, uint16_t* total);
 
+// Snapshot the drive state and the patch pool. Restore expects the same
+// images to be loaded already.
+void pico_disk_save_state(snapshot_stream_t* stream);
+bool pico_disk_restore_state(snapshot_stream_t* stream);
+
 #endif
@@ -1,4 +1,6 @@
 #include "pico_88dcdd_sd_card.h"
+#include "io_ports.h"
+#include <stddef.h>
 
 // MITS 88-DCDD Disk Controller Emulation for Pico with SD Card
 // Implements active-low status bit logic for Altair 8800 floppy disk controller
@@ -54,6 +56,42 @@ static void seek_to_track(void)
     disk->sector = 0;
 }
 
+// 88-DCDD ports: 08h select/status, 09h function/sector, 0Ah write/read data
+#define DISK_PORT_STATUS 0x08
+#define DISK_PORT_CONTROL 0x09
+#define DISK_PORT_DATA 0x0A
+
+static uint8_t disk_port_in(void* context, uint8_t port)
+{
+    (void)context;
+    switch (port)
+    {
+        case DISK_PORT_STATUS:
+            return sd_disk_status();
+        case DISK_PORT_CONTROL:
+            return sd_disk_sector();
+        default:
+            return sd_disk_read();
+    }
+}
+
+static void disk_port_out(void* context, uint8_t port, uint8_t data)
+{
+    (void)context;
+    switch (port)
+    {
+        case DISK_PORT_STATUS:
+            sd_disk_select(data);
+            break;
+        case DISK_PORT_CONTROL:
+            sd_disk_function(data);
+            break;
+        default:
+            sd_disk_write(data);
+            break;
+    }
+}
+
 // Initialize disk controller
 void sd_disk_init(void)
 {
@@ -71,6 +109,11 @@ void sd_disk_init(void)
     // Select drive 0 by default
     sd_disk_controller.current = &sd_disk_controller.disk[0];
     sd_disk_controller.currentDisk = 0;
+
+    for (uint8_t port = DISK_PORT_STATUS; port <= DISK_PORT_DATA; port++)
+    {
+        io_port_register(port, disk_port_in, disk_port_out, NULL);
+    }
 }
 
 // Load disk image for specified drive from SD card
@@ -354,3 +397,47 @@ static void writeSector(sd_disk_t* pDisk)
     pDisk->sectorPointer = 0;
     pDisk->sectorDirty = false;
 }
+
+// Everything in sd_disk_t after the FatFs handle
+#define DISK_STATE_OFFSET offsetof(sd_disk_t, track)
+#define DISK_STATE_SIZE (sizeof(sd_disk_t) - DISK_STATE_OFFSET)
+
+void sd_disk_save_state(snapshot_stream_t* stream)
+{
+    for (int i = 0; i < MAX_DRIVES; i++)
+    {
+        snapshot_write(stream, (const uint8_t*)&sd_disk_controller.disk[i] + DISK_STATE_OFFSET, DISK_STATE_SIZE);
+    }
+    snapshot_write(stream, &sd_disk_controller.currentDisk, sizeof(sd_disk_controller.currentDisk));
+}
+
+bool sd_disk_restore_state(snapshot_stream_t* stream)
+{
+    uint8_t current_disk;
+
+    for (int i = 0; i < MAX_DRIVES; i++)
+    {
+        sd_disk_t* disk = &sd_disk_controller.disk[i];
+        bool loaded = disk->disk_loaded;
+
+        if (!snapshot_read(stream, (uint8_t*)disk + DISK_STATE_OFFSET, DISK_STATE_SIZE))
+        {
+            return false;
+        }
+        disk->disk_loaded = loaded;
+
+        if (loaded)
+        {
+            // A buffered sector has already been read past
+            f_lseek(&disk->fil, disk->diskPointer + (disk->haveSectorData ? SECTOR_SIZE : 0));
+        }
+    }
+
+    if (!snapshot_read(stream, &current_disk, sizeof(current_disk)) || current_disk >= MAX_DRIVES)
+    {
+        return false;
+    }
+    sd_disk_controller.currentDisk = current_disk;
+    sd_disk_controller.current = &sd_disk_controller.disk[current_disk];
+    return true;
+}
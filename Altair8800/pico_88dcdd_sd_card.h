@@ -1,6 +1,7 @@
 #ifndef _PICO_88DCDD_SD_CARD_H_
 #define _PICO_88DCDD_SD_CARD_H_
 
+#include "snapshot.h"
 #include "types.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -88,8 +89,13 @@ uint8_t sd_disk_sector(void);
 void sd_disk_write(uint8_t data);
 uint8_t sd_disk_read(void);
 
-// Initialization
+// Initialization; also registers the controller on ports 08h-0Ah
 void sd_disk_init(void);
 bool sd_disk_load(uint8_t drive, const char* disk_path);
 
+// Snapshot the controller and head positions. Disk contents live on the card
+// and are not part of the snapshot; restore expects the same files open.
+void sd_disk_save_state(snapshot_stream_t* stream);
+bool sd_disk_restore_state(snapshot_stream_t* stream);
+
 #endif // _PICO_88DCDD_SD_CARD_H_
@@ -0,0 +1,150 @@
+#include "profiler.h"
+
+#if defined(I8080_PROFILER) && I8080_PROFILER
+
+#include <string.h>
+
+// Roughly one sample per 256 T-states, with up to 63 T-states of jitter so a
+// loop whose length divides the interval is not always caught at the same
+// instruction. Short sub-slices cost an extra call into the core each, which
+// is the only overhead while the profiler runs.
+#define PROFILER_INTERVAL 256
+#define PROFILER_JITTER_MASK 63
+
+// Open-addressed histogram keyed by PC. Programs spend their time in far fewer
+// than this many distinct places; a sample that cannot find a slot within
+// PROFILER_MAX_PROBE is counted as dropped.
+#define PROFILER_SLOTS 1024
+#define PROFILER_MAX_PROBE 16
+
+typedef struct
+{
+    uint16_t pc;
+    uint32_t samples; // 0 marks a free slot
+} profiler_slot_t;
+
+static profiler_slot_t slots[PROFILER_SLOTS];
+static uint64_t total_samples;
+static uint64_t dropped_samples;
+static bool running;
+static uint16_t lfsr = 0xace1;
+
+static inline uint32_t next_interval(void)
+{
+    // 16-bit Galois LFSR, taps 16 14 13 11
+    lfsr = (uint16_t)((lfsr >> 1) ^ (-(lfsr & 1u) & 0xb400u));
+    return PROFILER_INTERVAL + (lfsr & PROFILER_JITTER_MASK);
+}
+
+static void record(uint16_t pc)
+{
+    // Fibonacci hash; code addresses cluster in the low pages
+    uint32_t index = ((uint32_t)pc * 40503u >> 6) & (PROFILER_SLOTS - 1);
+
+    total_samples++;
+    for (uint32_t probe = 0; probe < PROFILER_MAX_PROBE; probe++)
+    {
+        profiler_slot_t* slot = &slots[(index + probe) & (PROFILER_SLOTS - 1)];
+        if (slot->samples == 0)
+        {
+            slot->pc = pc;
+            slot->samples = 1;
+            return;
+        }
+        if (slot->pc == pc)
+        {
+            slot->samples++;
+            return;
+        }
+    }
+    dropped_samples++;
+}
+
+void profiler_start(void)
+{
+    running = true;
+}
+
+void profiler_stop(void)
+{
+    running = false;
+}
+
+void profiler_clear(void)
+{
+    memset(slots, 0, sizeof(slots));
+    total_samples = 0;
+    dropped_samples = 0;
+}
+
+bool profiler_running(void)
+{
+    return running;
+}
+
+uint32_t profiler_run(intel8080_t* cpu, uint32_t cycle_budget, profiler_core_t core)
+{
+    if (!running)
+    {
+        return core(cpu, cycle_budget);
+    }
+
+    uint32_t executed = 0;
+    while (executed < cycle_budget)
+    {
+        uint32_t slice = next_interval();
+        if (slice > cycle_budget - executed)
+        {
+            slice = cycle_budget - executed;
+        }
+
+        executed += core(cpu, slice);
+        record(cpu->registers.pc);
+
+        // The core ends its batch early when the program is waiting on the
+        // console; the caller relies on seeing that
+        if (cpu->console_idle)
+        {
+            break;
+        }
+    }
+    return executed;
+}
+
+size_t profiler_top(profiler_entry_t* entries, size_t max)
+{
+    size_t count = 0;
+
+    if (max == 0)
+    {
+        return 0;
+    }
+
+    // Insertion into a short sorted list; max is small
+    for (size_t i = 0; i < PROFILER_SLOTS; i++)
+    {
+        const profiler_slot_t* slot = &slots[i];
+        if (slot->samples == 0 || (count == max && slot->samples <= entries[count - 1].samples))
+        {
+            continue;
+        }
+
+        size_t pos = count < max ? count++ : max - 1;
+        while (pos > 0 && entries[pos - 1].samples < slot->samples)
+        {
+            entries[pos] = entries[pos - 1];
+            pos--;
+        }
+        entries[pos].pc = slot->pc;
+        entries[pos].samples = slot->samples;
+    }
+    return count;
+}
+
+void profiler_totals(uint64_t* samples, uint64_t* dropped)
+{
+    *samples = total_samples;
+    *dropped = dropped_samples;
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include "intel8080.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Sampling PC profiler. Built with -DPROFILER=ON; without it nothing here is
+// compiled and the run loop calls the core directly.
+#if defined(I8080_PROFILER) && I8080_PROFILER
+
+// Hot addresses reported by the monitor PROF command
+#define PROFILER_TOP_MAX 16
+
+typedef struct
+{
+    uint16_t pc;
+    uint32_t samples;
+} profiler_entry_t;
+
+typedef uint32_t (*profiler_core_t)(intel8080_t* cpu, uint32_t cycle_budget);
+
+void profiler_start(void);
+void profiler_stop(void);
+void profiler_clear(void);
+bool profiler_running(void);
+
+// Run up to cycle_budget T-states through core, splitting the budget into
+// short sub-slices and sampling the PC after each. While stopped this is a
+// plain call to core.
+uint32_t profiler_run(intel8080_t* cpu, uint32_t cycle_budget, profiler_core_t core);
+
+// Fill entries with up to max hottest addresses, most samples first.
+// Returns the number filled.
+size_t profiler_top(profiler_entry_t* entries, size_t max);
+
+// Samples taken, and samples that found the table full and were not counted
+// against an address
+void profiler_totals(uint64_t* samples, uint64_t* dropped);
+
+#endif
+
+#endif
@@ -0,0 +1,56 @@
+#include "trace.h"
+
+#if defined(I8080_TRACE) && I8080_TRACE
+
+#include "i8080_disasm.h"
+#include <stdio.h>
+#include <string.h>
+
+trace_entry_t trace_ring[I8080_TRACE_ENTRIES];
+uint32_t trace_head;
+volatile bool trace_enabled = true;
+
+void trace_set_enabled(bool enabled)
+{
+    trace_enabled = enabled;
+}
+
+void trace_clear(void)
+{
+    trace_head = 0;
+}
+
+uint32_t trace_count(void)
+{
+    return trace_head < I8080_TRACE_ENTRIES ? trace_head : I8080_TRACE_ENTRIES;
+}
+
+const trace_entry_t* trace_get(uint32_t index)
+{
+    return &trace_ring[(trace_head - 1 - index) & (I8080_TRACE_ENTRIES - 1)];
+}
+
+size_t trace_format(const trace_entry_t* entry, uint32_t elapsed, char* buffer, size_t size)
+{
+    uint8_t length = 0;
+    const char* name = get_i8080_instruction_name(entry->op_code, &length);
+    char bytes[10] = {0};
+    size_t used = (size_t)snprintf(bytes, sizeof(bytes), "%02x ", entry->op_code);
+
+    for (uint8_t i = 1; i < length && i < 3; i++)
+    {
+        used += (size_t)snprintf(bytes + used, sizeof(bytes) - used, "%02x ", read8(memory, (uint16_t)(entry->pc + i)));
+    }
+
+    // '*' marks an address whose opcode has changed since it ran
+    int written = snprintf(buffer, size, "%10lu %04x%c %-9s %-12s A=%02x F=%02x HL=%04x SP=%04x",
+                           (unsigned long)elapsed, entry->pc, read8(memory, entry->pc) == entry->op_code ? ' ' : '*',
+                           bytes, name, entry->a, entry->flags, entry->hl, entry->sp);
+    if (written < 0)
+    {
+        return 0;
+    }
+    return (size_t)written < size ? (size_t)written : size - 1;
+}
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include "intel8080.h"
+#include "memory.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Execution trace ring. Built with -DTRACE=ON; the table-driven core then
+// records every instruction it executes while tracing is on. Entries are raw
+// machine state and are only turned into text when dumped.
+#if defined(I8080_TRACE) && I8080_TRACE
+
+// Power of two; 12 bytes each
+#ifndef I8080_TRACE_ENTRIES
+#define I8080_TRACE_ENTRIES 4096
+#endif
+
+#if I8080_TRACE_ENTRIES & (I8080_TRACE_ENTRIES - 1)
+#error "I8080_TRACE_ENTRIES must be a power of two"
+#endif
+
+// CPU state before the instruction at pc runs. The T-state stamp is the low
+// 24 bits of cpu->cycles, enough to recover the time between neighbours.
+typedef struct
+{
+    uint16_t pc;
+    uint16_t hl;
+    uint16_t sp;
+    uint16_t cycles_low;
+    uint8_t cycles_high;
+    uint8_t op_code;
+    uint8_t a;
+    uint8_t flags;
+} trace_entry_t;
+
+extern trace_entry_t trace_ring[I8080_TRACE_ENTRIES];
+extern uint32_t trace_head; // Entries recorded since the last clear
+extern volatile bool trace_enabled;
+
+static inline void trace_record(const intel8080_t* cpu)
+{
+    trace_entry_t* entry = &trace_ring[trace_head++ & (I8080_TRACE_ENTRIES - 1)];
+    uint32_t cycles = (uint32_t)cpu->cycles;
+
+    entry->pc = cpu->registers.pc;
+    entry->hl = cpu->registers.hl;
+    entry->sp = cpu->registers.sp;
+    entry->cycles_low = (uint16_t)cycles;
+    entry->cycles_high = (uint8_t)(cycles >> 16);
+    entry->op_code = read8(cpu->memory, cpu->registers.pc);
+    entry->a = cpu->registers.a;
+    entry->flags = cpu->registers.flags;
+}
+
+void trace_set_enabled(bool enabled);
+void trace_clear(void);
+
+// Entries held, at most I8080_TRACE_ENTRIES
+uint32_t trace_count(void);
+
+// The entry index places back from the newest; 0 is the last one recorded
+const trace_entry_t* trace_get(uint32_t index);
+
+// Format one entry as a disassembly line. elapsed is the T-state count since
+// the first entry of the dump. Operand bytes are read from memory now, so
+// code patched after it ran shows its current operands.
+size_t trace_format(const trace_entry_t* entry, uint32_t elapsed, char* buffer, size_t size);
+
+// T-states from entry previous to entry
+static inline uint32_t trace_delta(const trace_entry_t* previous, const trace_entry_t* entry)
+{
+    uint32_t before = ((uint32_t)previous->cycles_high << 16) | previous->cycles_low;
+    uint32_t after = ((uint32_t)entry->cycles_high << 16) | entry->cycles_low;
+    return (after - before) & 0xffffff;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,330 @@
+#include "panel_sampler.h"
+
+#include "pico/time.h"
+#include "spsc_ring.h"
+#include "ws_protocol.h"
+
+#include <string.h>
+
+#define PANEL_SAMPLER_RING_SIZE 512   // Power of two
+#define PANEL_SAMPLER_MIN_INTERVAL 64 // T-states; shorter sub-slices cost more than they show
+#define PANEL_SAMPLER_DEFAULT_CLOCK 2000000
+#define PANEL_SAMPLER_LEDS 33 // A0-A15, D0-D7, status 0-7, INTE
+
+typedef struct
+{
+    // Configuration (core 0)
+    uint32_t rate_hz;
+    uint32_t clock_hz;
+    uint32_t interval; // T-states between samples
+    bool persistence;
+
+    // Set by core 1
+    volatile bool enabled;
+    volatile bool key_requested;
+
+    // The frame being sampled
+    bool active;        // Enabled as core 0 last saw it
+    uint32_t countdown; // T-states to the next sample
+    uint64_t frame_due_us;
+    uint32_t frame_samples;
+    uint32_t lit[PANEL_SAMPLER_LEDS]; // Samples each LED was lit in
+    uint16_t address;                 // Latest sample
+    uint8_t data;
+    uint8_t status;
+    bool inte;
+
+    // Cells of the last frame queued, for the next delta
+    uint8_t cells[WS_LEDS_PERSISTENCE_CELLS];
+    bool key_pending;
+
+    panel_sampler_stats_t stats;
+} panel_sampler_t;
+
+static panel_sampler_t sampler = {
+    .rate_hz = PANEL_SAMPLER_DEFAULT_RATE,
+    .clock_hz = PANEL_SAMPLER_DEFAULT_CLOCK,
+    .interval = PANEL_SAMPLER_DEFAULT_CLOCK / PANEL_SAMPLER_DEFAULT_RATE,
+    .persistence = true,
+};
+
+// Frames, core 0 -> core 1: a length byte and the encoded frame
+static uint8_t frame_storage[PANEL_SAMPLER_RING_SIZE];
+static spsc_ring_t frame_ring = {frame_storage, PANEL_SAMPLER_RING_SIZE - 1, 0, 0};
+
+static void update_interval(void)
+{
+    uint32_t interval = sampler.clock_hz / sampler.rate_hz;
+    sampler.interval = interval > PANEL_SAMPLER_MIN_INTERVAL ? interval : PANEL_SAMPLER_MIN_INTERVAL;
+    sampler.countdown = sampler.interval;
+}
+
+static void sample(const intel8080_t* cpu)
+{
+    sampler.address = cpu->address_bus;
+    sampler.data = cpu->data_bus;
+    sampler.status = cpu->cpuStatus;
+    sampler.inte = (cpu->registers.flags & FLAGS_IF) != 0;
+    sampler.frame_samples++;
+    sampler.stats.samples++;
+
+    if (sampler.persistence)
+    {
+        // Only lit LEDs are counted, one step per set bit
+        uint64_t lit = sampler.address | (uint64_t)sampler.data << 16 | (uint64_t)sampler.status << 24 |
+                       (uint64_t)sampler.inte << 32;
+        while (lit)
+        {
+            sampler.lit[__builtin_ctzll(lit)]++;
+            lit &= lit - 1;
+        }
+    }
+}
+
+// Cell values of the frame just sampled; returns how many
+static size_t build_cells(uint8_t* cells, bool wait)
+{
+    uint8_t flags = wait ? WS_LEDS_WAIT : 0;
+
+    if (!sampler.persistence)
+    {
+        cells[0] = (uint8_t)sampler.address;
+        cells[1] = (uint8_t)(sampler.address >> 8);
+        cells[2] = sampler.data;
+        cells[3] = sampler.status;
+        cells[4] = (uint8_t)(flags | (sampler.inte ? WS_LEDS_INTE : 0));
+        return WS_LEDS_LATCH_CELLS;
+    }
+
+    uint32_t samples = sampler.frame_samples;
+    for (size_t i = 0; i < PANEL_SAMPLER_LEDS; i++)
+    {
+        cells[i] = (uint8_t)((sampler.lit[i] * 255 + samples / 2) / samples);
+    }
+    cells[PANEL_SAMPLER_LEDS] = flags;
+    return WS_LEDS_PERSISTENCE_CELLS;
+}
+
+static void close_frame(bool wait)
+{
+    uint8_t cells[WS_LEDS_PERSISTENCE_CELLS];
+    size_t count = build_cells(cells, wait);
+    bool key = sampler.key_pending || sampler.key_requested;
+    size_t bitmap_len = (count + 7) / 8;
+
+    // Length byte, flags, bitmap, values
+    uint8_t frame[1 + PANEL_SAMPLER_FRAME_MAX];
+    uint8_t* out = &frame[2 + bitmap_len];
+    memset(&frame[2], 0, bitmap_len);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (key || cells[i] != sampler.cells[i])
+        {
+            frame[2 + i / 8] |= (uint8_t)(1u << (i % 8));
+            *out++ = cells[i];
+        }
+    }
+
+    sampler.frame_samples = 0;
+    memset(sampler.lit, 0, sizeof(sampler.lit));
+
+    size_t length = (size_t)(out - &frame[1]);
+    if (!key && length == 1 + bitmap_len)
+    {
+        return; // Nothing changed
+    }
+
+    frame[0] = (uint8_t)length;
+    frame[1] = (uint8_t)((key ? WS_LEDS_KEY : 0) | (sampler.persistence ? WS_LEDS_PERSISTENCE : 0));
+
+    // Core 1 may miss a frame but never half of one
+    if (PANEL_SAMPLER_RING_SIZE - spsc_ring_count(&frame_ring) < 1 + length)
+    {
+        sampler.stats.dropped++;
+        sampler.key_pending = true;
+        return;
+    }
+
+    spsc_ring_enqueue_bytes(&frame_ring, frame, 1 + length);
+    memcpy(sampler.cells, cells, count);
+    if (key)
+    {
+        sampler.key_requested = false;
+        sampler.key_pending = false;
+        sampler.stats.key_frames++;
+    }
+    sampler.stats.frames++;
+    sampler.stats.bytes += length;
+}
+
+void panel_sampler_configure(uint32_t rate_hz, bool persistence)
+{
+    if (rate_hz < PANEL_SAMPLER_MIN_RATE)
+    {
+        rate_hz = PANEL_SAMPLER_MIN_RATE;
+    }
+    else if (rate_hz > PANEL_SAMPLER_MAX_RATE)
+    {
+        rate_hz = PANEL_SAMPLER_MAX_RATE;
+    }
+
+    if (persistence != sampler.persistence)
+    {
+        // The cells change meaning: start over from a key frame
+        sampler.frame_samples = 0;
+        memset(sampler.lit, 0, sizeof(sampler.lit));
+        sampler.key_pending = true;
+    }
+    sampler.rate_hz = rate_hz;
+    sampler.persistence = persistence;
+    update_interval();
+}
+
+void panel_sampler_set_clock(uint32_t hz)
+{
+    if (hz != 0 && hz != sampler.clock_hz)
+    {
+        sampler.clock_hz = hz;
+        update_interval();
+    }
+}
+
+uint32_t panel_sampler_run(intel8080_t* cpu, uint32_t cycle_budget, panel_sampler_core_t core)
+{
+    if (!sampler.enabled)
+    {
+        return core(cpu, cycle_budget);
+    }
+
+    uint32_t executed = 0;
+    while (executed < cycle_budget)
+    {
+        uint32_t slice = sampler.countdown;
+        if (slice > cycle_budget - executed)
+        {
+            slice = cycle_budget - executed;
+        }
+
+        uint32_t ran = core(cpu, slice);
+        executed += ran;
+        if (ran >= sampler.countdown)
+        {
+            sample(cpu);
+            sampler.countdown = sampler.interval;
+        }
+        else
+        {
+            sampler.countdown -= ran;
+        }
+
+        // The core ends its batch early when the program is waiting on the
+        // console; the caller relies on seeing that
+        if (cpu->console_idle)
+        {
+            break;
+        }
+    }
+    return executed;
+}
+
+void panel_sampler_poll(const intel8080_t* cpu, bool wait)
+{
+    if (!sampler.enabled)
+    {
+        sampler.active = false;
+        return;
+    }
+
+    uint64_t now_us = time_us_64();
+
+    if (!sampler.active)
+    {
+        // Start from a clean frame, sent whole
+        sampler.active = true;
+        sampler.frame_samples = 0;
+        memset(sampler.lit, 0, sizeof(sampler.lit));
+        sampler.key_pending = true;
+        sampler.frame_due_us = now_us + PANEL_SAMPLER_FRAME_US;
+        return;
+    }
+
+    if (now_us < sampler.frame_due_us)
+    {
+        return;
+    }
+
+    // A late poll does not bunch up the frames that follow
+    sampler.frame_due_us += PANEL_SAMPLER_FRAME_US;
+    if (sampler.frame_due_us <= now_us)
+    {
+        sampler.frame_due_us = now_us + PANEL_SAMPLER_FRAME_US;
+    }
+
+    if (sampler.frame_samples == 0)
+    {
+        sample(cpu);
+    }
+    close_frame(wait);
+}
+
+void panel_sampler_get_stats(panel_sampler_stats_t* stats)
+{
+    *stats = sampler.stats;
+    stats->rate_hz = sampler.rate_hz;
+    stats->persistence = sampler.persistence;
+    stats->enabled = sampler.enabled;
+}
+
+void panel_sampler_clear_stats(void)
+{
+    memset(&sampler.stats, 0, sizeof(sampler.stats));
+}
+
+void panel_sampler_enable(bool enabled)
+{
+    sampler.enabled = enabled;
+}
+
+void panel_sampler_request_key_frame(void)
+{
+    sampler.key_requested = true;
+}
+
+// Copy length bytes out of the ring, in at most two runs
+static void take_bytes(uint8_t* buffer, size_t length)
+{
+    while (length > 0)
+    {
+        const uint8_t* data;
+        size_t run = spsc_ring_peek(&frame_ring, &data);
+        if (run > length)
+        {
+            run = length;
+        }
+        memcpy(buffer, data, run);
+        spsc_ring_commit(&frame_ring, run);
+        buffer += run;
+        length -= run;
+    }
+}
+
+size_t panel_sampler_take_frame(uint8_t* buffer, size_t max_len)
+{
+    uint8_t length;
+
+    if (spsc_ring_is_empty(&frame_ring))
+    {
+        return 0;
+    }
+
+    take_bytes(&length, 1);
+    if (length > max_len)
+    {
+        // Too big for the caller: skip it whole
+        spsc_ring_commit(&frame_ring, length);
+        return 0;
+    }
+    take_bytes(buffer, length);
+    return length;
+}
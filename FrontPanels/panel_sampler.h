@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Altair8800/intel8080.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Front panel sampler for the WebSocket LEDS channel (ws_protocol.h).
+//
+// While a browser is subscribed, core 0 runs the CPU in short sub-slices and
+// reads the address bus, data bus, status byte and INTE between them, at
+// rate_hz samples per second of emulated time. The batch cores only write the
+// bus back when a batch ends, so this is where a sample is current. While no
+// one is subscribed a run is a plain call to the core.
+//
+// Every PANEL_SAMPLER_FRAME_US the samples become a frame: the latest bus
+// state, or with persistence on the share of samples each LED was lit in, as
+// a brightness. Frames are delta-encoded against the previous one and passed
+// to core 1 through a lock-free ring; a frame the ring has no room for is
+// dropped and the next one is sent whole.
+
+#define PANEL_SAMPLER_DEFAULT_RATE 2000
+#define PANEL_SAMPLER_MIN_RATE 20
+#define PANEL_SAMPLER_MAX_RATE 100000
+#define PANEL_SAMPLER_FRAME_US 50000 // 20 frames a second
+#define PANEL_SAMPLER_FRAME_MAX 48   // Largest encoded frame
+
+typedef uint32_t (*panel_sampler_core_t)(intel8080_t* cpu, uint32_t cycle_budget);
+
+typedef struct
+{
+    uint32_t rate_hz;
+    bool persistence;
+    bool enabled;        // A browser is subscribed
+    uint64_t samples;
+    uint32_t frames;     // Frames queued for core 1
+    uint32_t key_frames; // Of which sent whole
+    uint32_t dropped;    // Frames the ring had no room for
+    uint64_t bytes;      // Encoded bytes queued
+} panel_sampler_stats_t;
+
+// Core 0
+
+// Samples per second of emulated time, and whether frames carry brightness
+void panel_sampler_configure(uint32_t rate_hz, bool persistence);
+
+// The emulated clock in Hz, to space samples in T-states (0 until known)
+void panel_sampler_set_clock(uint32_t hz);
+
+// Run up to cycle_budget T-states through core, sampling the bus between
+// sub-slices while enabled
+uint32_t panel_sampler_run(intel8080_t* cpu, uint32_t cycle_budget, panel_sampler_core_t core);
+
+// Close the frame once it is due; call from the main loop whatever the CPU
+// mode. A frame with no samples (CPU stopped, halted or waiting on the
+// console) takes one now. wait lights the WAIT LED.
+void panel_sampler_poll(const intel8080_t* cpu, bool wait);
+
+void panel_sampler_get_stats(panel_sampler_stats_t* stats);
+void panel_sampler_clear_stats(void);
+
+// Core 1
+
+// Sample while at least one client is subscribed
+void panel_sampler_enable(bool enabled);
+
+// Send the next frame whole, for a client that joined or missed a frame
+void panel_sampler_request_key_frame(void);
+
+// Copy out the oldest waiting frame; returns its length, 0 if none
+size_t panel_sampler_take_frame(uint8_t* buffer, size_t max_len);
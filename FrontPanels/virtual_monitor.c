@@ -2,9 +2,17 @@
    Licensed under the MIT License. */
 
 #include "virtual_monitor.h"
+#include "PortDrivers/sio2_io.h"
+#include "panel_sampler.h"
+#include "hardware/timer.h"
 #include "i8080_disasm.h"
 #include "memory.h"
+#include "profiler.h"
+#include "snapshot.h"
+#include "trace.h"
+#include "ws.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const char* too_many_switches = "\r\nError: Number of input switches must be less that or equal to 16.\n\r";
@@ -74,6 +82,609 @@ static void process_virtual_switches(const char* command)
     }
 }
 
+static const char* clock_preset_name(CPU_CLOCK_PRESET preset)
+{
+    switch (preset)
+    {
+        case CPU_CLOCK_2MHZ:
+            return "2 MHz";
+        case CPU_CLOCK_4MHZ:
+            return "4 MHz";
+        default:
+            return "Unlimited";
+    }
+}
+
+// CLOCK [2|4|MAX] - show or select the clock governor preset
+static void process_clock_command(const char* command)
+{
+    const char* arg = command + 5;
+    while (*arg == ' ')
+    {
+        arg++;
+    }
+
+    if (strcmp(arg, "2") == 0)
+    {
+        cpu_state_set_clock(CPU_CLOCK_2MHZ);
+    }
+    else if (strcmp(arg, "4") == 0)
+    {
+        cpu_state_set_clock(CPU_CLOCK_4MHZ);
+    }
+    else if (strcmp(arg, "MAX") == 0)
+    {
+        cpu_state_set_clock(CPU_CLOCK_UNLIMITED);
+    }
+    else if (*arg != '\0')
+    {
+        const char* usage = "\r\nUsage: CLOCK [2|4|MAX]";
+        publish_message(usage, strlen(usage));
+    }
+
+    uint32_t khz = cpu_state_get_measured_khz();
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info),
+                                         "\r\n%14s: %s, measured %lu.%03lu MHz, %llu T-states", "Clock",
+                                         clock_preset_name(cpu_state_get_clock()), (unsigned long)(khz / 1000),
+                                         (unsigned long)(khz % 1000), (unsigned long long)cpu.cycles);
+    publish_message(panel_info, msg_length);
+}
+
+// FUSE [ON|OFF] - show or switch superinstruction fusion
+static void process_fuse_command(const char* command)
+{
+    const char* arg = command + 4;
+    while (*arg == ' ')
+    {
+        arg++;
+    }
+
+    if (strcmp(arg, "ON") == 0)
+    {
+        i8080_set_fusion(true);
+    }
+    else if (strcmp(arg, "OFF") == 0)
+    {
+        i8080_set_fusion(false);
+    }
+    else if (*arg != '\0')
+    {
+        const char* usage = "\r\nUsage: FUSE [ON|OFF]";
+        publish_message(usage, strlen(usage));
+    }
+
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %s, %llu pairs fused", "Fusion",
+                                         i8080_get_fusion() ? "On" : "Off", (unsigned long long)cpu.fused);
+    publish_message(panel_info, msg_length);
+}
+
+// IDLE [CLEAR] - show or reset console idle statistics
+static void process_idle_command(const char* command)
+{
+    if (strcmp(command, "IDLE CLEAR") == 0)
+    {
+        cpu_state_clear_idle_stats();
+    }
+
+    cpu_idle_stats_t stats;
+    cpu_state_get_idle_stats(&stats);
+
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %llu ms in %lu waits", "Idle",
+                                         (unsigned long long)(stats.idle_us / 1000), (unsigned long)stats.waits);
+    publish_message(panel_info, msg_length);
+
+    msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %lu wakes, last %lu us, max %lu us",
+                                  "Wake latency", (unsigned long)stats.wakes,
+                                  (unsigned long)stats.last_wake_latency_us, (unsigned long)stats.max_wake_latency_us);
+    publish_message(panel_info, msg_length);
+}
+
+#if defined(CYW43_WL_GPIO_LED_PIN)
+// WS [CLEAR|BLOCK|DROP|RESYNC] - show or reset the WebSocket output counters,
+// or choose what happens to a client that falls too far behind
+static void process_ws_command(const char* command)
+{
+    static const char* const policy_names[] = {"Block", "Drop", "Resync"};
+
+    if (strcmp(command, "WS CLEAR") == 0)
+    {
+        ws_clear_output_stats();
+    }
+    else if (strcmp(command, "WS BLOCK") == 0)
+    {
+        ws_set_output_policy(WS_OUTPUT_BLOCK);
+    }
+    else if (strcmp(command, "WS DROP") == 0)
+    {
+        ws_set_output_policy(WS_OUTPUT_DROP);
+    }
+    else if (strcmp(command, "WS RESYNC") == 0)
+    {
+        ws_set_output_policy(WS_OUTPUT_RESYNC);
+    }
+    else if (strcmp(command, "WS") != 0)
+    {
+        const char* usage = "\r\nUsage: WS [CLEAR|BLOCK|DROP|RESYNC]";
+        publish_message(usage, strlen(usage));
+        return;
+    }
+
+    ws_output_stats_t stats;
+    ws_get_output_stats(&stats);
+
+    uint32_t fps_x10 = stats.elapsed_us ? (uint32_t)(stats.frames * 10000000ULL / stats.elapsed_us) : 0;
+    uint32_t bytes_per_frame = stats.frames ? (uint32_t)(stats.bytes / stats.frames) : 0;
+
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info),
+                                         "\r\n%14s: %lu.%lu frames/s, %lu bytes/frame, %s when behind", "WS output",
+                                         (unsigned long)(fps_x10 / 10), (unsigned long)(fps_x10 % 10),
+                                         (unsigned long)bytes_per_frame, policy_names[ws_get_output_policy()]);
+    publish_message(panel_info, msg_length);
+
+    msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: last %lu us, max %lu us",
+                                  "Echo latency", (unsigned long)stats.last_echo_us,
+                                  (unsigned long)stats.max_echo_us);
+    publish_message(panel_info, msg_length);
+
+    ws_client_stats_t clients[4];
+    size_t count = ws_get_client_stats(clients, sizeof(clients) / sizeof(clients[0]));
+    for (size_t i = 0; i < count; i++)
+    {
+        const ws_client_stats_t* client = &clients[i];
+        char label[16];
+
+        snprintf(label, sizeof(label), "Client %lu", (unsigned long)client->conn_id);
+        msg_length = (size_t)snprintf(panel_info, sizeof(panel_info),
+                                      "\r\n%14s: lag %lu (max %lu), limit %lu, %lu refused, %lu stalls, "
+                                      "%lu resyncs, %llu dropped, %lu screens sent",
+                                      label, (unsigned long)client->lag, (unsigned long)client->max_lag,
+                                      (unsigned long)client->frame_limit, (unsigned long)client->send_failures,
+                                      (unsigned long)client->stalls, (unsigned long)client->resyncs,
+                                      (unsigned long long)client->dropped, (unsigned long)client->syncs);
+        publish_message(panel_info, msg_length);
+
+        if (client->channel_mode)
+        {
+            msg_length = (size_t)snprintf(panel_info, sizeof(panel_info),
+                                          "\r\n%14s  channel mode, subscribed 0x%02X, %lu monitor drops", "",
+                                          client->channels, (unsigned long)client->monitor_drops);
+            publish_message(panel_info, msg_length);
+        }
+    }
+}
+
+// LEDS [CLEAR|PERSIST|LATCH|rate] - show the front panel sampler behind the
+// WebSocket LEDS channel, or set its samples per second or frame kind
+static void process_leds_command(const char* command)
+{
+    panel_sampler_stats_t stats;
+    panel_sampler_get_stats(&stats);
+
+    const char* arg = command + 4;
+    while (*arg == ' ')
+    {
+        arg++;
+    }
+
+    if (strcmp(arg, "CLEAR") == 0)
+    {
+        panel_sampler_clear_stats();
+    }
+    else if (strcmp(arg, "PERSIST") == 0)
+    {
+        panel_sampler_configure(stats.rate_hz, true);
+    }
+    else if (strcmp(arg, "LATCH") == 0)
+    {
+        panel_sampler_configure(stats.rate_hz, false);
+    }
+    else if (*arg != '\0')
+    {
+        char* end;
+        unsigned long rate = strtoul(arg, &end, 10);
+        if (end == arg || *end != '\0')
+        {
+            const char* usage = "\r\nUsage: LEDS [CLEAR|PERSIST|LATCH|samples per second]";
+            publish_message(usage, strlen(usage));
+            return;
+        }
+        panel_sampler_configure((uint32_t)rate, stats.persistence);
+    }
+
+    panel_sampler_get_stats(&stats);
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %lu samples/s, %s, %s",
+                                         "Panel LEDs", (unsigned long)stats.rate_hz,
+                                         stats.persistence ? "persistence" : "latched",
+                                         stats.enabled ? "streaming" : "no subscribers");
+    publish_message(panel_info, msg_length);
+
+    uint32_t bytes_per_frame = stats.frames ? (uint32_t)(stats.bytes / stats.frames) : 0;
+    msg_length = (size_t)snprintf(panel_info, sizeof(panel_info),
+                                  "\r\n%14s: %llu samples, %lu frames (%lu whole), %lu dropped, %lu bytes/frame",
+                                  "Panel frames", (unsigned long long)stats.samples, (unsigned long)stats.frames,
+                                  (unsigned long)stats.key_frames, (unsigned long)stats.dropped,
+                                  (unsigned long)bytes_per_frame);
+    publish_message(panel_info, msg_length);
+}
+#endif
+
+// SIO [1|2 baud] - show the 2SIO channels or pace one at a baud rate (0: unpaced)
+static void process_sio_command(const char* command)
+{
+    const char* arg = command + 3;
+    while (*arg == ' ')
+    {
+        arg++;
+    }
+
+    if (*arg != '\0')
+    {
+        char* end;
+        unsigned long channel = strtoul(arg, &end, 10);
+        unsigned long baud = strtoul(end, &end, 10);
+
+        if ((channel == 1 || channel == 2) && *end == '\0' && end != arg)
+        {
+            sio2_set_baud((uint8_t)(channel - 1), (uint32_t)baud);
+        }
+        else
+        {
+            const char* usage = "\r\nUsage: SIO [1|2 baud]";
+            publish_message(usage, strlen(usage));
+        }
+    }
+
+    for (uint8_t channel = 0; channel < SIO2_CHANNELS; channel++)
+    {
+        sio2_stats_t stats;
+        char baud[16] = "Unpaced";
+        char name[16];
+
+        sio2_get_stats(channel, &stats);
+        if (stats.baud)
+        {
+            snprintf(baud, sizeof(baud), "%lu baud", (unsigned long)stats.baud);
+        }
+        snprintf(name, sizeof(name), "2SIO %u", channel + 1);
+
+        size_t msg_length = (size_t)snprintf(
+            panel_info, sizeof(panel_info), "\r\n%14s: %s, %llu in, %llu out in %lu writes, %lu dropped", name,
+            baud, (unsigned long long)stats.rx_bytes, (unsigned long long)stats.tx_bytes,
+            (unsigned long)stats.tx_flushes, (unsigned long)stats.tx_dropped);
+        publish_message(panel_info, msg_length);
+    }
+}
+
+// SAVE [CLEAR] | LOAD - snapshot the stopped machine, drop the snapshot, or
+// resume from it
+static void process_snapshot_command(const char* command)
+{
+    uint64_t start = time_us_64();
+    size_t msg_length;
+
+    if (strcmp(command, "SAVE") == 0)
+    {
+        bool ok = snapshot_save();
+        msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %s in %lu ms", "Snapshot",
+                                      ok ? "Saved" : "Save failed", (unsigned long)((time_us_64() - start) / 1000));
+    }
+    else if (strcmp(command, "SAVE CLEAR") == 0)
+    {
+        msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %s", "Snapshot",
+                                      snapshot_erase() ? "Cleared, next power-on cold boots" : "Clear failed");
+    }
+    else if (strcmp(command, "LOAD") == 0)
+    {
+        if (snapshot_load())
+        {
+            bus_switches = cpu.address_bus;
+            msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: Loaded in %lu ms, PC 0x%04x",
+                                          "Snapshot", (unsigned long)((time_us_64() - start) / 1000),
+                                          cpu.registers.pc);
+        }
+        else
+        {
+            msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %s", "Snapshot",
+                                          "No valid snapshot for this build");
+        }
+    }
+    else
+    {
+        msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %s", "Snapshot",
+                                      "Usage: SAVE, SAVE CLEAR or LOAD");
+    }
+    publish_message(panel_info, msg_length);
+}
+
+#if I8080_PROFILER
+// PROF [START|STOP|CLEAR] - control the PC profiler or list the hottest addresses
+static void process_prof_command(const char* command)
+{
+    const char* arg = command + 4;
+    while (*arg == ' ')
+    {
+        arg++;
+    }
+
+    if (strcmp(arg, "START") == 0)
+    {
+        profiler_start();
+    }
+    else if (strcmp(arg, "STOP") == 0)
+    {
+        profiler_stop();
+    }
+    else if (strcmp(arg, "CLEAR") == 0)
+    {
+        profiler_clear();
+    }
+    else if (*arg != '\0')
+    {
+        const char* usage = "\r\nUsage: PROF [START|STOP|CLEAR]";
+        publish_message(usage, strlen(usage));
+    }
+
+    uint64_t samples, dropped;
+    profiler_totals(&samples, &dropped);
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %s, %llu samples, %llu dropped",
+                                         "Profiler", profiler_running() ? "Running" : "Stopped",
+                                         (unsigned long long)samples, (unsigned long long)dropped);
+    publish_message(panel_info, msg_length);
+
+    if (*arg != '\0' || samples == 0)
+    {
+        return;
+    }
+
+    profiler_entry_t top[PROFILER_TOP_MAX];
+    size_t count = profiler_top(top, PROFILER_TOP_MAX);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint8_t instruction_length = 0;
+        const char* name = get_i8080_instruction_name(read8(cpu.memory, top[i].pc), &instruction_length);
+        unsigned long permille = (unsigned long)((uint64_t)top[i].samples * 1000 / samples);
+
+        char bytes[12] = {0};
+        size_t used = 0;
+        for (uint8_t b = 0; b < instruction_length && b < 3; b++)
+        {
+            used += (size_t)snprintf(bytes + used, sizeof(bytes) - used, "%02x ", read8(cpu.memory, (uint16_t)(top[i].pc + b)));
+        }
+
+        msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: 0x%04x %3lu.%lu%% %-9s %-12s",
+                                      "Hot", top[i].pc, permille / 10, permille % 10, bytes, name);
+        publish_message(panel_info, msg_length);
+    }
+}
+#endif
+
+#if I8080_BREAKPOINTS
+#define DEBUGGER_LIST_MAX 16
+
+static void list_debugger_points(debugger_kind_t kind, const char* label)
+{
+    uint16_t first[DEBUGGER_LIST_MAX];
+    uint16_t last[DEBUGGER_LIST_MAX];
+    size_t count = debugger_list(kind, first, last, DEBUGGER_LIST_MAX);
+    size_t msg_length;
+
+    if (count == 0)
+    {
+        msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: None", label);
+        publish_message(panel_info, msg_length);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (first[i] == last[i])
+        {
+            msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: 0x%04x", label, first[i]);
+        }
+        else
+        {
+            msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: 0x%04x-0x%04x", label,
+                                          first[i], last[i]);
+        }
+        publish_message(panel_info, msg_length);
+    }
+}
+
+// BP addr, BC [addr], BL - breakpoints
+// WR addr [len], WW addr [len], WC [addr [len]] - read and write watchpoints
+// Debugger commands are a two-letter token, alone or followed by arguments
+static bool is_debugger_command(const char* command)
+{
+    static const char* const tokens[] = {"BP", "BC", "BL", "WR", "WW", "WC"};
+
+    if (strlen(command) < 2 || (command[2] != '\0' && command[2] != ' '))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < sizeof(tokens) / sizeof(tokens[0]); i++)
+    {
+        if (strncmp(command, tokens[i], 2) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// command has passed is_debugger_command()
+static void process_debugger_command(const char* command)
+{
+    char* end;
+    unsigned long address = strtoul(command + 2, &end, 16);
+    bool has_address = end != command + 2;
+    unsigned long length = strtoul(end, &end, 16);
+    if (length == 0)
+    {
+        length = 1;
+    }
+
+    if (strncmp(command, "BP", 2) == 0 && has_address)
+    {
+        debugger_set(DEBUGGER_BREAKPOINT, (uint16_t)address, 1, true);
+    }
+    else if (strncmp(command, "BC", 2) == 0)
+    {
+        if (has_address)
+        {
+            debugger_set(DEBUGGER_BREAKPOINT, (uint16_t)address, 1, false);
+        }
+        else
+        {
+            debugger_clear(DEBUGGER_BREAKPOINT);
+        }
+    }
+    else if (strncmp(command, "WR", 2) == 0 && has_address)
+    {
+        debugger_set(DEBUGGER_WATCH_READ, (uint16_t)address, (uint32_t)length, true);
+    }
+    else if (strncmp(command, "WW", 2) == 0 && has_address)
+    {
+        debugger_set(DEBUGGER_WATCH_WRITE, (uint16_t)address, (uint32_t)length, true);
+    }
+    else if (strncmp(command, "WC", 2) == 0)
+    {
+        if (has_address)
+        {
+            debugger_set(DEBUGGER_WATCH_READ, (uint16_t)address, (uint32_t)length, false);
+            debugger_set(DEBUGGER_WATCH_WRITE, (uint16_t)address, (uint32_t)length, false);
+        }
+        else
+        {
+            debugger_clear(DEBUGGER_WATCH_READ);
+            debugger_clear(DEBUGGER_WATCH_WRITE);
+        }
+    }
+    else if (strcmp(command, "BL") != 0)
+    {
+        const char* usage = "\r\nUsage: BP addr | BC [addr] | BL | WR addr [len] | WW addr [len] | WC [addr [len]]";
+        publish_message(usage, strlen(usage));
+        return;
+    }
+
+    list_debugger_points(DEBUGGER_BREAKPOINT, "Breakpoint");
+    list_debugger_points(DEBUGGER_WATCH_READ, "Watch read");
+    list_debugger_points(DEBUGGER_WATCH_WRITE, "Watch write");
+}
+
+void monitor_debugger_stop(const debugger_hit_t* hit)
+{
+    cpu_state_set_mode(CPU_STOPPED);
+    i8080_examine(&cpu, cpu.registers.pc);
+    bus_switches = cpu.address_bus;
+
+    const char* stopped = "\r\n*** CPU STOPPED ***";
+    publish_message(stopped, strlen(stopped));
+
+    if (hit->kind != DEBUGGER_BREAKPOINT)
+    {
+        size_t msg_length = (size_t)snprintf(
+            panel_info, sizeof(panel_info), "\r\n%14s: 0x%04x by the instruction at 0x%04x",
+            hit->kind == DEBUGGER_WATCH_READ ? "Watch read" : "Watch write", hit->address, hit->pc);
+        publish_message(panel_info, msg_length);
+    }
+
+    publish_cpu_state(hit->kind == DEBUGGER_BREAKPOINT ? "Breakpoint" : "Watchpoint", cpu.address_bus, cpu.data_bus);
+}
+#endif
+
+#if I8080_TRACE
+// Oldest first, with T-states counted from the first line
+static void dump_trace(uint32_t count)
+{
+    const char* header = "\r\n  T-states PC    Bytes     Instruction";
+    publish_message(header, strlen(header));
+
+    const trace_entry_t* previous = NULL;
+    uint32_t elapsed = 0;
+
+    for (uint32_t index = count; index-- > 0;)
+    {
+        const trace_entry_t* entry = trace_get(index);
+        if (previous)
+        {
+            elapsed += trace_delta(previous, entry);
+        }
+        previous = entry;
+
+        panel_info[0] = '\r';
+        panel_info[1] = '\n';
+        size_t msg_length = 2 + trace_format(entry, elapsed, panel_info + 2, sizeof(panel_info) - 2);
+        publish_message(panel_info, msg_length);
+    }
+}
+
+// TRACE [ON|OFF|CLEAR|DUMP [n]] - control the execution trace or dump its last n entries
+static void process_trace_command(const char* command)
+{
+    const char* arg = command + 5;
+    while (*arg == ' ')
+    {
+        arg++;
+    }
+
+    if (strcmp(arg, "ON") == 0)
+    {
+        trace_set_enabled(true);
+    }
+    else if (strcmp(arg, "OFF") == 0)
+    {
+        trace_set_enabled(false);
+    }
+    else if (strcmp(arg, "CLEAR") == 0)
+    {
+        trace_clear();
+    }
+    else if (strncmp(arg, "DUMP", 4) == 0)
+    {
+        uint32_t count = trace_count();
+        unsigned long requested = 0;
+        if (sscanf(arg + 4, "%lu", &requested) == 1 && requested < count)
+        {
+            count = (uint32_t)requested;
+        }
+        dump_trace(count);
+    }
+    else if (*arg != '\0')
+    {
+        const char* usage = "\r\nUsage: TRACE [ON|OFF|CLEAR|DUMP [n]]";
+        publish_message(usage, strlen(usage));
+    }
+
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info), "\r\n%14s: %s, %lu of %u entries held",
+                                         "Trace", trace_enabled ? "On" : "Off", (unsigned long)trace_count(),
+                                         (unsigned)I8080_TRACE_ENTRIES);
+    publish_message(panel_info, msg_length);
+}
+#endif
+
+#if I8080_DECODE_CACHE
+// CACHE [CLEAR] - show or reset the decode cache counters
+static void process_cache_command(const char* command)
+{
+    i8080_decode_stats_t stats;
+
+    if (strcmp(command, "CACHE CLEAR") == 0)
+    {
+        i8080_decode_cache_clear_stats();
+    }
+
+    i8080_decode_cache_get_stats(&stats);
+    uint64_t lookups = stats.hits + stats.misses;
+    unsigned long permille = lookups ? (unsigned long)(stats.hits * 1000 / lookups) : 0;
+    size_t msg_length = (size_t)snprintf(panel_info, sizeof(panel_info),
+                                         "\r\n%14s: %llu hits, %llu misses (%lu.%lu%% hit), %lu page flushes",
+                                         "Decode cache", (unsigned long long)stats.hits,
+                                         (unsigned long long)stats.misses, permille / 10, permille % 10,
+                                         (unsigned long)stats.invalidations);
+    publish_message(panel_info, msg_length);
+}
+#endif
+
 void process_virtual_input(const char* command, size_t len)
 {
     if (len == 0)
@@ -132,6 +743,71 @@ void process_virtual_input(const char* command, size_t len)
         cmd_switches = RUN_CMD;
         process_control_panel_commands();
     }
+    else if (strncmp(command, "CLOCK", 5) == 0)
+    {
+        process_clock_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+    else if (strncmp(command, "FUSE", 4) == 0)
+    {
+        process_fuse_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+    else if (strncmp(command, "IDLE", 4) == 0)
+    {
+        process_idle_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+#if defined(CYW43_WL_GPIO_LED_PIN)
+    else if (strcmp(command, "WS") == 0 || strncmp(command, "WS ", 3) == 0)
+    {
+        process_ws_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+    else if (strncmp(command, "LEDS", 4) == 0)
+    {
+        process_leds_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+#endif
+    else if (strncmp(command, "SIO", 3) == 0)
+    {
+        process_sio_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+    else if (strncmp(command, "SAVE", 4) == 0 || strcmp(command, "LOAD") == 0)
+    {
+        process_snapshot_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+#if I8080_PROFILER
+    else if (strncmp(command, "PROF", 4) == 0)
+    {
+        process_prof_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+#endif
+#if I8080_BREAKPOINTS
+    else if (is_debugger_command(command))
+    {
+        process_debugger_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+#endif
+#if I8080_TRACE
+    else if (strncmp(command, "TRACE", 5) == 0)
+    {
+        process_trace_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+#endif
+#if I8080_DECODE_CACHE
+    else if (strncmp(command, "CACHE", 5) == 0)
+    {
+        process_cache_command(command);
+        publish_message("\r\nCPU MONITOR> ", 15);
+    }
+#endif
     else
     {
         process_virtual_switches(command);
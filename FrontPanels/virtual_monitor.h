@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "Altair8800/debugger.h"
 #include "Altair8800/intel8080.h"
 #include "cpu_state.h"
 #include "websocket_console.h"
@@ -37,3 +38,8 @@ void process_virtual_input(const char* command, size_t len);
 void publish_cpu_state(char* command, uint16_t address_bus, uint8_t data_bus);
 void trace(intel8080_t* cpu);
 void altair_reset(void);
+
+#if I8080_BREAKPOINTS
+// Stop the CPU on a breakpoint or watchpoint hit and report it
+void monitor_debugger_stop(const debugger_hit_t* hit);
+#endif
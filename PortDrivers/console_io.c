@@ -0,0 +1,53 @@
+#include "PortDrivers/console_io.h"
+
+#include "io_ports.h"
+
+#include <stddef.h>
+
+#define SIO_STATUS 0x00
+#define SIO_DATA 0x01
+
+typedef struct
+{
+    intel8080_t* cpu;
+    port_in read;
+    port_out write;
+} console_io_t;
+
+static console_io_t console;
+
+static uint8_t console_port_in(void* context, uint8_t port)
+{
+    console_io_t* io = (console_io_t*)context;
+    uint8_t value = 0x00;
+
+    if (port == SIO_STATUS)
+    {
+        // Always ready; the empty read shows up on the data port
+        i8080_console_status(io->cpu);
+    }
+    else
+    {
+        value = io->read();
+        i8080_console_poll(io->cpu, value == 0);
+    }
+    return value;
+}
+
+static void console_port_out(void* context, uint8_t port, uint8_t data)
+{
+    console_io_t* io = (console_io_t*)context;
+
+    (void)port;
+    io->write(data);
+}
+
+void console_io_init(intel8080_t* cpu, port_in read, port_out write)
+{
+    console.cpu = cpu;
+    console.read = read;
+    console.write = write;
+
+    io_port_register(SIO_STATUS, console_port_in, NULL, &console);
+    io_port_register(SIO_DATA, console_port_in, console_port_out, &console);
+}
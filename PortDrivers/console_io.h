@@ -0,0 +1,7 @@
+#pragma once
+
+#include "Altair8800/intel8080.h"
+
+// Console on the 88-SIO (ports 0-1), a byte at a time. read returns 0 when no
+// key is waiting; both run on core 0. The 88-2SIO is PortDrivers/sio2_io.h.
+void console_io_init(intel8080_t* cpu, port_in read, port_out write);
@@ -1,5 +1,6 @@
 #include "http_io.h"
 #include "http_get.h"
+#include "io_ports.h"
 
 #include "pico/stdlib.h" // Must be included before WiFi check to get board definitions
 
@@ -51,6 +52,12 @@ static http_port_state_t port_state;
 
 // === CORE 0: Port Handlers ===
 
+static uint8_t http_port_in(void* context, uint8_t port)
+{
+    (void)context;
+    return http_input(port);
+}
+
 void http_io_init(void)
 {
     // Initialize HTTP GET module
@@ -62,6 +69,12 @@ void http_io_init(void)
     // Initialize state
     memset(&port_state, 0, sizeof(port_state));
     port_state.status = WG_EOF;
+
+    io_port_register(33, http_port_in, NULL, NULL);
+    io_port_register(201, http_port_in, NULL, NULL);
+    io_port_register_response(109, NULL, http_output);
+    io_port_register_response(110, NULL, http_output);
+    io_port_register_response(114, NULL, http_output);
 }
 
 size_t http_output(int port, uint8_t data, char* buffer, size_t buffer_length)
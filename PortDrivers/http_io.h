@@ -6,14 +6,15 @@
 
 /**
  * Initialize HTTP IO subsystem
- * Creates queues for inter-core communication
+ * Creates queues for inter-core communication and registers ports 33, 109,
+ * 110, 114 and 201 (non-WiFi boards leave them unregistered)
  * Must be called before websocket_console_start() on Core 0
  */
 void http_io_init(void);
 
 /**
  * HTTP port output handler
- * Called from io_port_out() on Core 0 (Altair emulator)
+ * Called through the port table on Core 0 (Altair emulator)
  *
  * @param port Port number (109, 110, 114)
  * @param data Data byte written to port
@@ -25,7 +26,7 @@ size_t http_output(int port, uint8_t data, char* buffer, size_t buffer_length);
 
 /**
  * HTTP port input handler
- * Called from io_port_in() on Core 0 (Altair emulator)
+ * Called through the port table on Core 0 (Altair emulator)
  *
  * @param port Port number (33, 201)
  * @return Data byte read from port
@@ -0,0 +1,365 @@
+#include "PortDrivers/sio2_io.h"
+
+#include "io_ports.h"
+
+#include <string.h>
+
+#define SIO2_BASE_PORT 0x10
+
+#define SIO2_FIFO_SIZE 64 // Power of two
+#define SIO2_FIFO_MASK (SIO2_FIFO_SIZE - 1)
+
+// Character times are counted in T-states of the Altair's 2 MHz clock, so a
+// program timing its own I/O sees the same baud rate at any clock preset
+#define SIO2_CLOCK_HZ 2000000
+#define SIO2_BITS_PER_CHAR 10 // Start, 8 data, stop
+
+typedef struct
+{
+    uint8_t data[SIO2_FIFO_SIZE];
+    uint8_t head; // Next byte out
+    uint8_t count;
+} sio2_fifo_t;
+
+typedef struct
+{
+    const sio2_backend_t* backend;
+    uint8_t control;
+    uint8_t last_rx; // Read again from an empty receive data register
+    uint32_t char_tstates;
+    uint64_t rx_ready_at; // cpu->cycles from which the next byte may be read
+    uint64_t tx_ready_at; // cpu->cycles from which the transmitter is empty again
+    sio2_fifo_t rx;
+    sio2_fifo_t tx;
+    sio2_stats_t stats;
+} sio2_channel_t;
+
+typedef struct
+{
+    uint8_t control;
+    uint8_t last_rx;
+    uint8_t rx_count;
+    uint8_t rx[SIO2_FIFO_SIZE];
+    uint64_t rx_ready_at;
+    uint64_t tx_ready_at;
+} sio2_channel_state_t;
+
+static intel8080_t* sio2_cpu;
+static sio2_channel_t channels[SIO2_CHANNELS];
+
+static void fifo_push(sio2_fifo_t* fifo, uint8_t value)
+{
+    fifo->data[(fifo->head + fifo->count) & SIO2_FIFO_MASK] = value;
+    fifo->count++;
+}
+
+static uint8_t fifo_pop(sio2_fifo_t* fifo)
+{
+    uint8_t value = fifo->data[fifo->head];
+    fifo->head = (fifo->head + 1) & SIO2_FIFO_MASK;
+    fifo->count--;
+    return value;
+}
+
+// Top the receive FIFO up from the backend, in at most two contiguous reads
+static void fill_rx(sio2_channel_t* ch)
+{
+    if (!ch->backend || ch->rx.count == SIO2_FIFO_SIZE)
+    {
+        return;
+    }
+
+    while (ch->rx.count < SIO2_FIFO_SIZE)
+    {
+        uint8_t tail = (ch->rx.head + ch->rx.count) & SIO2_FIFO_MASK;
+        size_t space = SIO2_FIFO_SIZE - ch->rx.count;
+        if (space > (size_t)(SIO2_FIFO_SIZE - tail))
+        {
+            space = SIO2_FIFO_SIZE - tail;
+        }
+
+        size_t received = ch->backend->read(&ch->rx.data[tail], space);
+        ch->rx.count += (uint8_t)received;
+        ch->stats.rx_bytes += received;
+        if (received < space)
+        {
+            break;
+        }
+    }
+}
+
+static void drop_tx(sio2_channel_t* ch)
+{
+    ch->stats.tx_dropped += ch->tx.count;
+    ch->tx.head = 0;
+    ch->tx.count = 0;
+}
+
+// Hand the transmit FIFO to the backend, in at most two contiguous writes;
+// what it does not take stays queued
+static void flush_tx(sio2_channel_t* ch)
+{
+    if (ch->tx.count == 0)
+    {
+        return;
+    }
+
+    if (!ch->backend)
+    {
+        drop_tx(ch);
+        return;
+    }
+
+    size_t sent = 0;
+    while (ch->tx.count > 0)
+    {
+        size_t run = SIO2_FIFO_SIZE - ch->tx.head;
+        if (run > ch->tx.count)
+        {
+            run = ch->tx.count;
+        }
+
+        size_t taken = ch->backend->write(&ch->tx.data[ch->tx.head], run);
+        ch->tx.head = (ch->tx.head + taken) & SIO2_FIFO_MASK;
+        ch->tx.count -= (uint8_t)taken;
+        sent += taken;
+        if (taken < run)
+        {
+            break;
+        }
+    }
+
+    if (sent > 0)
+    {
+        ch->stats.tx_bytes += sent;
+        ch->stats.tx_flushes++;
+    }
+    if (ch->tx.count == 0)
+    {
+        ch->tx.head = 0;
+    }
+}
+
+static bool rx_full(const sio2_channel_t* ch)
+{
+    return ch->rx.count > 0 && sio2_cpu->cycles >= ch->rx_ready_at;
+}
+
+static bool tx_empty(const sio2_channel_t* ch)
+{
+    return ch->tx.count < SIO2_FIFO_SIZE && sio2_cpu->cycles >= ch->tx_ready_at;
+}
+
+static bool irq_active(const sio2_channel_t* ch)
+{
+    return ((ch->control & SIO2_CONTROL_RX_INT) && rx_full(ch)) ||
+           ((ch->control & SIO2_CONTROL_TX_MASK) == SIO2_CONTROL_TX_INT && tx_empty(ch));
+}
+
+static void master_reset(sio2_channel_t* ch)
+{
+    flush_tx(ch);
+    drop_tx(ch);
+    ch->rx.head = 0;
+    ch->rx.count = 0;
+    ch->rx_ready_at = 0;
+    ch->tx_ready_at = 0;
+}
+
+static uint8_t sio2_port_in(void* context, uint8_t port)
+{
+    sio2_channel_t* ch = (sio2_channel_t*)context;
+
+    if (ch->rx.count == 0)
+    {
+        fill_rx(ch);
+    }
+
+    if ((port & 1) == 0)
+    {
+        uint8_t status = 0;
+
+        // A full FIFO holds TDRE low until the backend makes room
+        if (ch->tx.count == SIO2_FIFO_SIZE)
+        {
+            flush_tx(ch);
+        }
+        if (rx_full(ch))
+        {
+            status |= SIO2_STATUS_RDRF;
+        }
+        if (tx_empty(ch))
+        {
+            status |= SIO2_STATUS_TDRE;
+        }
+        if (irq_active(ch))
+        {
+            status |= SIO2_STATUS_IRQ;
+        }
+
+        // Only an idle line counts as a console wait; a program pacing its
+        // output on TDRE is busy
+        i8080_console_poll(sio2_cpu, ch->rx.count == 0 && tx_empty(ch));
+        return status;
+    }
+
+    if (rx_full(ch))
+    {
+        ch->last_rx = fifo_pop(&ch->rx);
+        ch->rx_ready_at = sio2_cpu->cycles + ch->char_tstates;
+    }
+    return ch->last_rx;
+}
+
+static void sio2_port_out(void* context, uint8_t port, uint8_t data)
+{
+    sio2_channel_t* ch = (sio2_channel_t*)context;
+
+    if ((port & 1) == 0)
+    {
+        if ((data & SIO2_CONTROL_RESET) == SIO2_CONTROL_RESET)
+        {
+            master_reset(ch);
+        }
+        ch->control = data;
+        return;
+    }
+
+    if (ch->tx.count == SIO2_FIFO_SIZE)
+    {
+        flush_tx(ch);
+    }
+    if (ch->tx.count == SIO2_FIFO_SIZE)
+    {
+        // Written without waiting for TDRE while the backend is backed up
+        ch->stats.tx_dropped++;
+        return;
+    }
+    fifo_push(&ch->tx, data);
+    ch->tx_ready_at = sio2_cpu->cycles + ch->char_tstates;
+}
+
+void sio2_io_init(intel8080_t* cpu)
+{
+    sio2_cpu = cpu;
+    memset(channels, 0, sizeof(channels));
+
+    for (uint8_t i = 0; i < SIO2_CHANNELS; i++)
+    {
+        uint8_t port = (uint8_t)(SIO2_BASE_PORT + 2 * i);
+        io_port_register(port, sio2_port_in, sio2_port_out, &channels[i]);
+        io_port_register(port + 1, sio2_port_in, sio2_port_out, &channels[i]);
+    }
+}
+
+void sio2_attach(uint8_t channel, const sio2_backend_t* backend)
+{
+    if (channel < SIO2_CHANNELS)
+    {
+        flush_tx(&channels[channel]);
+        drop_tx(&channels[channel]);
+        channels[channel].backend = backend;
+    }
+}
+
+void sio2_set_baud(uint8_t channel, uint32_t baud)
+{
+    if (channel < SIO2_CHANNELS)
+    {
+        channels[channel].stats.baud = baud;
+        channels[channel].char_tstates = baud ? SIO2_CLOCK_HZ * SIO2_BITS_PER_CHAR / baud : 0;
+    }
+}
+
+void sio2_get_stats(uint8_t channel, sio2_stats_t* stats)
+{
+    if (channel < SIO2_CHANNELS)
+    {
+        *stats = channels[channel].stats;
+    }
+}
+
+void sio2_reset(void)
+{
+    for (uint8_t i = 0; i < SIO2_CHANNELS; i++)
+    {
+        master_reset(&channels[i]);
+    }
+}
+
+void sio2_flush(void)
+{
+    for (uint8_t i = 0; i < SIO2_CHANNELS; i++)
+    {
+        flush_tx(&channels[i]);
+    }
+}
+
+bool sio2_interrupt_pending(void)
+{
+    for (uint8_t i = 0; i < SIO2_CHANNELS; i++)
+    {
+        sio2_channel_t* ch = &channels[i];
+
+        // Waiting input counts before the program's next status read pulls it in
+        if ((ch->control & SIO2_CONTROL_RX_INT) && ch->rx.count == 0 && ch->backend)
+        {
+            if (!ch->backend->input_pending || ch->backend->input_pending())
+            {
+                fill_rx(ch);
+            }
+        }
+        if (irq_active(ch))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void sio2_save_state(snapshot_stream_t* stream)
+{
+    for (uint8_t i = 0; i < SIO2_CHANNELS; i++)
+    {
+        sio2_channel_t* ch = &channels[i];
+        sio2_channel_state_t state = {0};
+
+        flush_tx(ch);
+        state.control = ch->control;
+        state.last_rx = ch->last_rx;
+        state.rx_count = ch->rx.count;
+        for (uint8_t j = 0; j < ch->rx.count; j++)
+        {
+            state.rx[j] = ch->rx.data[(ch->rx.head + j) & SIO2_FIFO_MASK];
+        }
+        state.rx_ready_at = ch->rx_ready_at;
+        state.tx_ready_at = ch->tx_ready_at;
+
+        snapshot_write(stream, &state, sizeof(state));
+    }
+}
+
+bool sio2_restore_state(snapshot_stream_t* stream)
+{
+    for (uint8_t i = 0; i < SIO2_CHANNELS; i++)
+    {
+        sio2_channel_t* ch = &channels[i];
+        sio2_channel_state_t state;
+
+        if (!snapshot_read(stream, &state, sizeof(state)) || state.rx_count > SIO2_FIFO_SIZE)
+        {
+            return false;
+        }
+
+        ch->control = state.control;
+        ch->last_rx = state.last_rx;
+        memcpy(ch->rx.data, state.rx, sizeof(ch->rx.data));
+        ch->rx.head = 0;
+        ch->rx.count = state.rx_count;
+        ch->tx.head = 0;
+        ch->tx.count = 0;
+        ch->rx_ready_at = state.rx_ready_at;
+        ch->tx_ready_at = state.tx_ready_at;
+    }
+    return true;
+}
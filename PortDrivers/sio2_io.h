@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Altair8800/intel8080.h"
+#include "snapshot.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// 88-2SIO serial board: two MC6850 ACIAs, channel 1 at ports 10h-11h and
+// channel 2 at 12h-13h (even port: control/status, odd port: data). Each
+// channel buffers received and transmitted bytes in a FIFO; transmitted bytes
+// reach the backend in runs, when the FIFO fills or at sio2_flush(). Bytes the
+// backend has no room for stay in the FIFO, and TDRE stays low while it is
+// full. Runs on core 0.
+
+#define SIO2_CHANNELS 2
+
+// Status register
+#define SIO2_STATUS_RDRF 0x01 // Receive data register full
+#define SIO2_STATUS_TDRE 0x02 // Transmit data register empty
+#define SIO2_STATUS_IRQ 0x80  // Interrupt request
+
+// Control register
+#define SIO2_CONTROL_RESET 0x03     // Counter divide select 11: master reset
+#define SIO2_CONTROL_TX_MASK 0x60   // Transmitter control
+#define SIO2_CONTROL_TX_INT 0x20    // RTS low, transmit interrupt enabled
+#define SIO2_CONTROL_RX_INT 0x80    // Receive interrupt enable
+
+// Where a channel's bytes come from and go to
+typedef struct
+{
+    // Copy up to max_len waiting bytes into buffer without blocking; returns
+    // how many were copied
+    size_t (*read)(uint8_t* buffer, size_t max_len);
+
+    // Send a run of transmitted bytes without blocking for long; returns how
+    // many were taken (from the start of the run)
+    size_t (*write)(const uint8_t* data, size_t length);
+
+    // Input is waiting; NULL if only read() can tell
+    bool (*input_pending)(void);
+} sio2_backend_t;
+
+typedef struct
+{
+    uint32_t baud; // 0: unpaced
+    uint64_t rx_bytes;
+    uint64_t tx_bytes;
+    uint32_t tx_flushes; // Backend writes; tx_bytes / tx_flushes is the run length
+    uint32_t tx_dropped; // Discarded: no backend, written to a full FIFO, or reset
+} sio2_stats_t;
+
+// Register ports 10h-13h. Both channels start unpaced with no backend: they
+// receive nothing and transmitted bytes are discarded.
+void sio2_io_init(intel8080_t* cpu);
+
+// Connect a channel (0 or 1) to a backend; NULL detaches it. The backend must
+// outlive the attachment.
+void sio2_attach(uint8_t channel, const sio2_backend_t* backend);
+
+// Pace a channel at baud bits per second of emulated time, ten bits per
+// character: RDRF and TDRE are held off for a character time after each
+// data read and write. 0 turns pacing off.
+void sio2_set_baud(uint8_t channel, uint32_t baud);
+
+void sio2_get_stats(uint8_t channel, sio2_stats_t* stats);
+
+// Machine reset: master-reset both channels. Their character-time deadlines
+// count cpu->cycles, which i8080_reset() sets back to 0, so call this with it.
+// Buffered transmit bytes are offered to the backend once more; unread input
+// is dropped.
+void sio2_reset(void);
+
+// Hand every buffered transmit byte to its backend. Call when the CPU stops
+// running, e.g. at the end of each slice.
+void sio2_flush(void);
+
+// A channel's interrupt request is active: received data with the receive
+// interrupt enabled, or an empty transmitter with the transmit interrupt
+// enabled. Both channels share one interrupt line.
+bool sio2_interrupt_pending(void);
+
+// Snapshot the control registers, pacing and the unread receive FIFOs.
+// Buffered transmit bytes are flushed rather than saved; any the backend
+// cannot take yet are left out of the snapshot.
+void sio2_save_state(snapshot_stream_t* stream);
+bool sio2_restore_state(snapshot_stream_t* stream);
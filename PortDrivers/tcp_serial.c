@@ -0,0 +1,274 @@
+#include "tcp_serial.h"
+
+#include "pico/stdlib.h" // Must be included before WiFi check to get board definitions
+
+// The TCP stream is only available on WiFi-enabled boards
+#if defined(CYW43_WL_GPIO_LED_PIN)
+
+#include <stdio.h>
+
+#include "lwip/pbuf.h"
+#include "lwip/tcp.h"
+#include "pico/util/queue.h"
+
+#define TCP_SERIAL_RX_QUEUE_DEPTH 256
+#define TCP_SERIAL_TX_QUEUE_DEPTH 1024
+#define TCP_SERIAL_SEND_CHUNK 256
+
+static queue_t rx_queue; // Core 1 -> Core 0
+static queue_t tx_queue; // Core 0 -> Core 1
+
+// Core 1 state
+static struct tcp_pcb* listen_pcb;
+static struct tcp_pcb* client_pcb;
+static struct pbuf* rx_hold; // Received data the RX queue had no room for
+static uint16_t rx_offset;   // Bytes of rx_hold already queued
+static volatile bool client_connected;
+static uint8_t tx_chunk[TCP_SERIAL_SEND_CHUNK]; // Output lwIP has not taken yet
+static size_t tx_pending;
+
+// === CORE 0: sio2 backend ===
+
+size_t tcp_serial_read(uint8_t* buffer, size_t max_len)
+{
+    size_t count = 0;
+    while (count < max_len && queue_try_remove(&rx_queue, &buffer[count]))
+    {
+        count++;
+    }
+    return count;
+}
+
+size_t tcp_serial_write(const uint8_t* data, size_t length)
+{
+    if (!client_connected)
+    {
+        return length;
+    }
+
+    size_t count = 0;
+    while (count < length && queue_try_add(&tx_queue, &data[count]))
+    {
+        count++;
+    }
+    return count;
+}
+
+bool tcp_serial_input_pending(void)
+{
+    return !queue_is_empty(&rx_queue);
+}
+
+void tcp_serial_init(void)
+{
+    queue_init(&rx_queue, sizeof(uint8_t), TCP_SERIAL_RX_QUEUE_DEPTH);
+    queue_init(&tx_queue, sizeof(uint8_t), TCP_SERIAL_TX_QUEUE_DEPTH);
+}
+
+// === CORE 1: TCP server ===
+
+// Queue as much held input as fits and open the window by that much
+static void drain_rx_hold(void)
+{
+    uint16_t queued = 0;
+
+    while (rx_hold && rx_offset < rx_hold->tot_len)
+    {
+        uint8_t value = pbuf_get_at(rx_hold, rx_offset);
+        if (!queue_try_add(&rx_queue, &value))
+        {
+            break;
+        }
+        rx_offset++;
+        queued++;
+    }
+
+    if (rx_hold && rx_offset == rx_hold->tot_len)
+    {
+        pbuf_free(rx_hold);
+        rx_hold = NULL;
+        rx_offset = 0;
+    }
+
+    if (client_pcb && queued > 0)
+    {
+        tcp_recved(client_pcb, queued);
+    }
+}
+
+static void drop_client(void)
+{
+    if (rx_hold)
+    {
+        pbuf_free(rx_hold);
+        rx_hold = NULL;
+        rx_offset = 0;
+    }
+    tx_pending = 0;
+    client_pcb = NULL;
+    client_connected = false;
+}
+
+static void close_client(void)
+{
+    struct tcp_pcb* pcb = client_pcb;
+
+    drop_client();
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, NULL);
+    tcp_err(pcb, NULL);
+    if (tcp_close(pcb) != ERR_OK)
+    {
+        tcp_abort(pcb);
+    }
+}
+
+static err_t tcp_serial_recv(void* arg, struct tcp_pcb* pcb, struct pbuf* p, err_t err)
+{
+    (void)arg;
+    (void)pcb;
+
+    if (p == NULL || err != ERR_OK)
+    {
+        if (p)
+        {
+            pbuf_free(p);
+        }
+        close_client();
+        return ERR_OK;
+    }
+
+    if (rx_hold)
+    {
+        pbuf_cat(rx_hold, p);
+    }
+    else
+    {
+        rx_hold = p;
+    }
+    drain_rx_hold();
+    return ERR_OK;
+}
+
+static void tcp_serial_error(void* arg, err_t err)
+{
+    (void)arg;
+    (void)err;
+
+    // The pcb is already freed
+    drop_client();
+}
+
+static err_t tcp_serial_accept(void* arg, struct tcp_pcb* pcb, err_t err)
+{
+    (void)arg;
+
+    if (err != ERR_OK || pcb == NULL)
+    {
+        return ERR_VAL;
+    }
+
+    // One terminal per channel
+    if (client_pcb)
+    {
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+
+    client_pcb = pcb;
+    tcp_recv(pcb, tcp_serial_recv);
+    tcp_err(pcb, tcp_serial_error);
+    tcp_nagle_disable(pcb);
+    client_connected = true;
+    printf("[Core1] 2SIO channel 2 client connected\n");
+    return ERR_OK;
+}
+
+bool tcp_serial_start(void)
+{
+    struct tcp_pcb* pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+    if (pcb == NULL)
+    {
+        return false;
+    }
+
+    if (tcp_bind(pcb, IP_ANY_TYPE, TCP_SERIAL_PORT) != ERR_OK)
+    {
+        tcp_close(pcb);
+        return false;
+    }
+
+    listen_pcb = tcp_listen(pcb);
+    if (listen_pcb == NULL)
+    {
+        tcp_close(pcb);
+        return false;
+    }
+
+    tcp_accept(listen_pcb, tcp_serial_accept);
+    printf("[Core1] 2SIO channel 2 listening on TCP port %d\n", TCP_SERIAL_PORT);
+    return true;
+}
+
+void tcp_serial_poll(void)
+{
+    if (rx_hold)
+    {
+        drain_rx_hold();
+    }
+
+    if (!client_pcb)
+    {
+        return;
+    }
+
+    // A chunk lwIP turned away is offered again before more is dequeued
+    while (tx_pending < sizeof(tx_chunk) && queue_try_remove(&tx_queue, &tx_chunk[tx_pending]))
+    {
+        tx_pending++;
+    }
+
+    if (tx_pending > 0 && tx_pending <= tcp_sndbuf(client_pcb) &&
+        tcp_write(client_pcb, tx_chunk, (u16_t)tx_pending, TCP_WRITE_FLAG_COPY) == ERR_OK)
+    {
+        tcp_output(client_pcb);
+        tx_pending = 0;
+    }
+}
+
+#else // !CYW43_WL_GPIO_LED_PIN - Stub implementations for non-WiFi boards
+
+void tcp_serial_init(void)
+{
+    // No-op on non-WiFi boards
+}
+
+bool tcp_serial_start(void)
+{
+    return false;
+}
+
+void tcp_serial_poll(void)
+{
+    // No-op on non-WiFi boards
+}
+
+size_t tcp_serial_read(uint8_t* buffer, size_t max_len)
+{
+    (void)buffer;
+    (void)max_len;
+    return 0;
+}
+
+size_t tcp_serial_write(const uint8_t* data, size_t length)
+{
+    (void)data;
+    return length;
+}
+
+bool tcp_serial_input_pending(void)
+{
+    return false;
+}
+
+#endif // CYW43_WL_GPIO_LED_PIN
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Raw TCP stream for 2SIO channel 2: one client at a time on TCP_SERIAL_PORT
+// (e.g. `nc <ip> 8801`) sees the channel's output and types into it. Bytes
+// cross between the cores through queues; on non-WiFi boards the stream is
+// never connected.
+
+#define TCP_SERIAL_PORT 8801
+
+/**
+ * Create the inter-core queues
+ * Must be called before websocket_console_start() launches Core 1
+ */
+void tcp_serial_init(void);
+
+/**
+ * Start listening; called on Core 1 once Wi-Fi is up
+ */
+bool tcp_serial_start(void);
+
+/**
+ * Move queued output to the client and retry held input
+ * Called from Core 1's main loop in websocket_console_core1_entry()
+ */
+void tcp_serial_poll(void);
+
+// Core 0: the sio2_backend_t functions for channel 2. Output is discarded
+// while no client is connected; otherwise tcp_serial_write() takes only what
+// fits in the queue to core 1.
+size_t tcp_serial_read(uint8_t* buffer, size_t max_len);
+size_t tcp_serial_write(const uint8_t* data, size_t length);
+bool tcp_serial_input_pending(void);
@@ -1,5 +1,7 @@
 #include "PortDrivers/time_io.h"
 
+#include "cpu_state.h"
+#include "io_ports.h"
 #include "pico/stdlib.h"
 #include "pico/time.h"
 
@@ -12,10 +14,18 @@
 #define TIMER_1 1
 #define TIMER_2 2
 #define NUM_MS_TIMERS 3
+#define SECONDS_TIMER NUM_MS_TIMERS
+
+// Port 31: timer interrupt control. Bit 7 enables an interrupt when any timer
+// expires; bits 0-2 select the RST vector. Polling the timer ports still works.
+#define TIMER_INTERRUPT_ENABLE 0x80
+#define TIMER_INTERRUPT_RST_MASK 0x07
 
 static uint64_t ms_timer_targets[NUM_MS_TIMERS] = {0, 0, 0};
 static uint16_t ms_timer_delays[NUM_MS_TIMERS] = {0, 0, 0};
 static uint64_t seconds_timer_target = 0;
+static uint8_t timer_interrupt_control = 0;
+static alarm_id_t timer_alarms[NUM_MS_TIMERS + 1] = {0, 0, 0, 0};
 
 static inline uint64_t get_elapsed_ms(void)
 {
@@ -40,6 +50,30 @@ static int get_timer_index(int port)
     }
 }
 
+static int64_t timer_alarm_callback(alarm_id_t id, void* user_data)
+{
+    (void)id;
+    timer_alarms[(intptr_t)user_data] = 0;
+    i8080_request_interrupt(&cpu, timer_interrupt_control & TIMER_INTERRUPT_RST_MASK);
+    return 0; // One shot
+}
+
+// Replace the timer's pending expiry interrupt, if interrupts are enabled
+static void arm_timer_interrupt(int timer, uint32_t delay_ms)
+{
+    if (timer_alarms[timer] > 0)
+    {
+        cancel_alarm(timer_alarms[timer]);
+        timer_alarms[timer] = 0;
+    }
+
+    if (timer_interrupt_control & TIMER_INTERRUPT_ENABLE)
+    {
+        alarm_id_t id = add_alarm_in_ms(delay_ms, timer_alarm_callback, (void*)(intptr_t)timer, true);
+        timer_alarms[timer] = id > 0 ? id : 0;
+    }
+}
+
 static size_t format_boot_relative_time(char* buffer, size_t buffer_length)
 {
     if (buffer == NULL || buffer_length == 0)
@@ -97,11 +131,17 @@ size_t time_output(int port, uint8_t data, char* buffer, size_t buffer_length)
             {
                 ms_timer_delays[timer_idx] = (ms_timer_delays[timer_idx] & 0xFF00u) | data;
                 ms_timer_targets[timer_idx] = get_elapsed_ms() + ms_timer_delays[timer_idx];
+                arm_timer_interrupt(timer_idx, ms_timer_delays[timer_idx]);
             }
             break;
         case 30:
-            seconds_timer_target = get_elapsed_ms() / 1000ULL + data;
-            break;
+        {
+            uint64_t now_ms = get_elapsed_ms();
+            seconds_timer_target = now_ms / 1000ULL + data;
+            uint64_t target_ms = seconds_timer_target * 1000ULL;
+            arm_timer_interrupt(SECONDS_TIMER, target_ms > now_ms ? (uint32_t)(target_ms - now_ms) : 0);
+        }
+        break;
         case 41:
             len = (size_t)snprintf(buffer, buffer_length, "%llu", (unsigned long long)(get_elapsed_ms() / 1000ULL));
             break;
@@ -177,3 +217,98 @@ uint8_t time_input(uint8_t port)
 
     return retVal;
 }
+
+// Timers are saved relative to now so they resume with the time they had
+// left; 0 means not running
+typedef struct
+{
+    uint16_t delays[NUM_MS_TIMERS];
+    uint32_t remaining_ms[NUM_MS_TIMERS + 1];
+    uint8_t running; // Bit per timer, SECONDS_TIMER included
+    uint8_t interrupt_control;
+} time_io_state_t;
+
+static uint8_t time_port_in(void* context, uint8_t port)
+{
+    (void)context;
+    return time_input(port);
+}
+
+// Port 31 has no reply, so a write must not disturb one still being read
+static void timer_control_out(void* context, uint8_t port, uint8_t data)
+{
+    (void)context;
+    (void)port;
+    timer_interrupt_control = data;
+}
+
+void time_io_init(void)
+{
+    for (uint8_t port = 24; port <= 30; port++)
+    {
+        io_port_register_response(port, time_port_in, time_output);
+    }
+    io_port_register(31, NULL, timer_control_out, NULL);
+    for (uint8_t port = 41; port <= 43; port++)
+    {
+        io_port_register_response(port, NULL, time_output);
+    }
+}
+
+void time_io_save_state(snapshot_stream_t* stream)
+{
+    time_io_state_t state = {0};
+    uint64_t now_ms = get_elapsed_ms();
+
+    for (int i = 0; i < NUM_MS_TIMERS; i++)
+    {
+        state.delays[i] = ms_timer_delays[i];
+        if (ms_timer_targets[i] > 0)
+        {
+            state.running |= 1u << i;
+            state.remaining_ms[i] = ms_timer_targets[i] > now_ms ? (uint32_t)(ms_timer_targets[i] - now_ms) : 0;
+        }
+    }
+
+    if (seconds_timer_target > 0)
+    {
+        uint64_t target_ms = seconds_timer_target * 1000ULL;
+        state.running |= 1u << SECONDS_TIMER;
+        state.remaining_ms[SECONDS_TIMER] = target_ms > now_ms ? (uint32_t)(target_ms - now_ms) : 0;
+    }
+    state.interrupt_control = timer_interrupt_control;
+
+    snapshot_write(stream, &state, sizeof(state));
+}
+
+bool time_io_restore_state(snapshot_stream_t* stream)
+{
+    time_io_state_t state;
+
+    if (!snapshot_read(stream, &state, sizeof(state)))
+    {
+        return false;
+    }
+
+    uint64_t now_ms = get_elapsed_ms();
+    timer_interrupt_control = state.interrupt_control;
+
+    for (int i = 0; i < NUM_MS_TIMERS; i++)
+    {
+        ms_timer_delays[i] = state.delays[i];
+        ms_timer_targets[i] = (state.running & (1u << i)) ? now_ms + state.remaining_ms[i] : 0;
+        if (ms_timer_targets[i] > 0)
+        {
+            arm_timer_interrupt(i, state.remaining_ms[i]);
+        }
+    }
+
+    seconds_timer_target = 0;
+    if (state.running & (1u << SECONDS_TIMER))
+    {
+        // Whole seconds, rounded up so the timer never fires early
+        seconds_timer_target = (now_ms + state.remaining_ms[SECONDS_TIMER] + 999) / 1000ULL;
+        arm_timer_interrupt(SECONDS_TIMER, state.remaining_ms[SECONDS_TIMER]);
+    }
+    return true;
+}
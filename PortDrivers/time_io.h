@@ -1,7 +1,17 @@
 #pragma once
 
+#include "snapshot.h"
+
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+// Register the timer ports (24-31) and the time query ports (41-43)
+void time_io_init(void);
+
 size_t time_output(int port, uint8_t data, char* buffer, size_t buffer_length);
 uint8_t time_input(uint8_t port);
+
+// Snapshot the port timers as time remaining; restore re-arms them
+void time_io_save_state(snapshot_stream_t* stream);
+bool time_io_restore_state(snapshot_stream_t* stream);
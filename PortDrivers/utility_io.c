@@ -4,6 +4,7 @@
 #include "pico/time.h"
 
 #include "build_version.h"
+#include "io_ports.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -37,6 +38,12 @@ size_t utility_output(int port, uint8_t data, char* buffer, size_t buffer_length
     return len;
 }
 
+void utility_io_init(void)
+{
+    io_port_register_response(45, NULL, utility_output);
+    io_port_register_response(70, NULL, utility_output);
+}
+
 uint8_t utility_input(uint8_t port)
 {
     (void)port;
@@ -3,5 +3,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// Register the random number (45) and version (70) ports
+void utility_io_init(void);
+
 size_t utility_output(int port, uint8_t data, char* buffer, size_t buffer_length);
 uint8_t utility_input(uint8_t port);
@@ -7,6 +7,7 @@
 #include "pico/stdlib.h"
 
 #include "PortDrivers/http_io.h"
+#include "PortDrivers/tcp_serial.h"
 #include "websocket_console.h"
 
 // Enable WiFi/WebSocket functionality only if board has WiFi capability
@@ -16,6 +17,7 @@
 #include "lwip/ip4_addr.h"
 #include "lwip/netif.h"
 #include "pico/cyw43_arch.h"
+#include "pico/flash.h"
 #include "pico/multicore.h"
 #include "wifi.h"
 #include "wifi_config.h"
@@ -26,42 +28,16 @@
 #endif
 
 #define WIFI_CONNECT_TIMEOUT_MS 30000
-#define WS_OUTPUT_TIMER_INTERVAL_MS 20
-#define WS_INPUT_TIMER_INTERVAL_MS 5
 
 static void websocket_console_core1_entry(void);
 
 volatile bool console_running = false;
 volatile bool console_initialized = false;
 volatile bool wifi_connected = false;
-volatile bool pending_ws_output = false;
-volatile bool pending_ws_input = false;
 
 char ip_address_buffer[32] = {0};
 static char connected_ssid[WIFI_CONFIG_SSID_MAX_LEN + 1] = {0};
 
-// Timer for periodic WebSocket output
-static struct repeating_timer ws_output_timer;
-
-// Timer for periodic WebSocket input
-static struct repeating_timer ws_input_timer;
-
-// Timer callback for output - fires every 20ms
-static bool ws_output_timer_callback(struct repeating_timer* t)
-{
-    (void)t;
-    pending_ws_output = true;
-    return true; // Keep repeating
-}
-
-// Timer callback for input - fires every 10ms
-static bool ws_input_timer_callback(struct repeating_timer* t)
-{
-    (void)t;
-    pending_ws_input = true;
-    return true; // Keep repeating
-}
-
 static bool wifi_init(void)
 {
     printf("[Core1] Initializing CYW43...\n");
@@ -135,6 +111,7 @@ void websocket_console_start(void)
 
     websocket_queue_init();
     http_io_init(); // Initialize HTTP file transfer queues
+    tcp_serial_init(); // 2SIO channel 2 stream queues
 
     // Launch core 1 which will handle all Wi-Fi and WebSocket operations
     multicore_launch_core1(websocket_console_core1_entry);
@@ -161,6 +138,9 @@ bool websocket_console_is_running(void)
 
 static void websocket_console_core1_entry(void)
 {
+    // Let core 0 park this core while it writes a snapshot to flash
+    flash_safe_execute_core_init();
+
     // Initialize Wi-Fi on core 1
     bool wifi_ok = wifi_init();
     wifi_connected = wifi_ok;
@@ -194,12 +174,10 @@ static void websocket_console_core1_entry(void)
         return;
     }
 
-    // Start WebSocket timers on Core 1 (after WiFi init)
-    add_repeating_timer_ms(-WS_OUTPUT_TIMER_INTERVAL_MS, ws_output_timer_callback, NULL, &ws_output_timer);
-    printf("[Core1] Started WebSocket output timer (%dms interval)\n", WS_OUTPUT_TIMER_INTERVAL_MS);
-
-    add_repeating_timer_ms(-WS_INPUT_TIMER_INTERVAL_MS, ws_input_timer_callback, NULL, &ws_input_timer);
-    printf("[Core1] Started WebSocket input timer (%dms interval)\n", WS_INPUT_TIMER_INTERVAL_MS);
+    if (!tcp_serial_start())
+    {
+        printf("[Core1] Failed to start 2SIO channel 2 TCP server\n");
+    }
 
     // Mark console as initialized only after successful network stack initialization
     console_initialized = true;
@@ -209,8 +187,9 @@ static void websocket_console_core1_entry(void)
     while (true)
     {
         cyw43_arch_poll();
-        ws_poll(&pending_ws_input, &pending_ws_output);
+        ws_poll();
         http_poll(); // Poll for HTTP file transfer requests
+        tcp_serial_poll();
         tight_loop_contents();
     }
 }
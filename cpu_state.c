@@ -18,6 +18,11 @@ volatile CPU_OPERATING_MODE g_cpu_mode = CPU_STOPPED;
 uint16_t bus_switches = 0x00;
 ALTAIR_COMMAND cmd_switches = NOP;
 
+static volatile CPU_CLOCK_PRESET g_cpu_clock = CPU_CLOCK_UNLIMITED;
+static volatile uint32_t g_measured_khz = 0;
+static cpu_idle_stats_t g_idle_stats = {0};
+static volatile bool g_stop_announce_pending = false; // Set by a toggle on core 1
+
 void cpu_state_set_mode(CPU_OPERATING_MODE mode)
 {
     g_cpu_mode = mode;
@@ -47,11 +52,67 @@ void cpu_state_set_mode(CPU_OPERATING_MODE mode)
 #endif
 }
 
-CPU_OPERATING_MODE cpu_state_toggle_mode(void)
+void cpu_state_set_clock(CPU_CLOCK_PRESET preset)
 {
-    memset(command_buffer, 0, sizeof(command_buffer));
-    command_buffer_length = 0;
+    g_cpu_clock = preset;
+}
+
+CPU_CLOCK_PRESET cpu_state_get_clock(void)
+{
+    return g_cpu_clock;
+}
 
+uint32_t cpu_state_clock_hz(CPU_CLOCK_PRESET preset)
+{
+    switch (preset)
+    {
+        case CPU_CLOCK_2MHZ:
+            return 2000000;
+        case CPU_CLOCK_4MHZ:
+            return 4000000;
+        default:
+            return 0;
+    }
+}
+
+void cpu_state_set_measured_khz(uint32_t khz)
+{
+    g_measured_khz = khz;
+}
+
+uint32_t cpu_state_get_measured_khz(void)
+{
+    return g_measured_khz;
+}
+
+void cpu_state_record_idle(uint64_t idle_us, bool woken_by_input, uint32_t wake_latency_us)
+{
+    g_idle_stats.idle_us += idle_us;
+    g_idle_stats.waits++;
+
+    if (woken_by_input)
+    {
+        g_idle_stats.wakes++;
+        g_idle_stats.last_wake_latency_us = wake_latency_us;
+        if (wake_latency_us > g_idle_stats.max_wake_latency_us)
+        {
+            g_idle_stats.max_wake_latency_us = wake_latency_us;
+        }
+    }
+}
+
+void cpu_state_get_idle_stats(cpu_idle_stats_t* stats)
+{
+    *stats = g_idle_stats;
+}
+
+void cpu_state_clear_idle_stats(void)
+{
+    memset(&g_idle_stats, 0, sizeof(g_idle_stats));
+}
+
+CPU_OPERATING_MODE cpu_state_toggle_mode(void)
+{
     if (g_cpu_mode == CPU_RUNNING)
     {
         cpu_state_set_mode(CPU_STOPPED);
@@ -65,14 +126,26 @@ CPU_OPERATING_MODE cpu_state_toggle_mode(void)
     printf("CPU mode toggled to %s\n", (g_cpu_mode == CPU_RUNNING) ? "RUNNING" : "STOPPED");
 #endif
 
-    if (g_cpu_mode == CPU_STOPPED)
+    // Core 0 owns the command buffer and console output
+    g_stop_announce_pending = g_cpu_mode == CPU_STOPPED;
+
+    return g_cpu_mode;
+}
+
+void cpu_state_announce_stop(void)
+{
+    if (!g_stop_announce_pending)
     {
-        // Prompt for CPU monitor
-        const char* prompt = "\r\n*** CPU STOPPED ***\r\nCPU MONITOR> ";
-        publish_message(prompt, strlen(prompt));
+        return;
     }
+    g_stop_announce_pending = false;
 
-    return g_cpu_mode;
+    memset(command_buffer, 0, sizeof(command_buffer));
+    command_buffer_length = 0;
+
+    // Prompt for CPU monitor
+    const char* prompt = "\r\n*** CPU STOPPED ***\r\nCPU MONITOR> ";
+    publish_message(prompt, strlen(prompt));
 }
 
 void process_control_panel_commands_char(uint8_t ch)
@@ -94,9 +167,7 @@ void process_control_panel_commands_char(uint8_t ch)
         if (command_buffer_length > 0)
         {
             command_buffer_length--;
-            websocket_console_enqueue_output(ch);  // Echo backspace
-            websocket_console_enqueue_output(' '); // Echo space to erase character
-            websocket_console_enqueue_output(ch);  // Echo backspace again
+            publish_message("\b \b", 3); // Echo backspace, space to erase, backspace
         }
         // If command_buffer_length == 0, do nothing (don't echo)
     }
@@ -109,7 +180,7 @@ void process_control_panel_commands_char(uint8_t ch)
             command_buffer[command_buffer_length++] = (char)toupper((unsigned char)ch);
 
             // Echo the character back to the terminal
-            websocket_console_enqueue_output(ch);
+            publish_message((const char*)&ch, 1);
         }
     }
 }
\ No newline at end of file
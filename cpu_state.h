@@ -1,6 +1,7 @@
 #ifndef CPU_STATE_H
 #define CPU_STATE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "Altair8800/intel8080.h"
 
@@ -11,6 +12,14 @@ typedef enum
     CPU_LOW_POWER = 3
 } CPU_OPERATING_MODE;
 
+// Clock governor presets for the main run loop
+typedef enum
+{
+    CPU_CLOCK_2MHZ = 0,     // Authentic Altair 8800 speed
+    CPU_CLOCK_4MHZ = 1,     // Turbo (8080A-1 / 8085 class)
+    CPU_CLOCK_UNLIMITED = 2 // Run as fast as the host allows
+} CPU_CLOCK_PRESET;
+
 // Global CPU instance
 extern intel8080_t cpu;
 
@@ -20,9 +29,41 @@ extern uint16_t bus_switches;
 // Set the CPU operating mode
 void cpu_state_set_mode(CPU_OPERATING_MODE mode);
 
-// Toggle the CPU operating mode between RUNNING and STOPPED
+// Toggle the CPU operating mode between RUNNING and STOPPED. Safe to call
+// from core 1; a stop is announced on core 0 by cpu_state_announce_stop().
 CPU_OPERATING_MODE cpu_state_toggle_mode(void);
 
+// Print the CPU monitor prompt after a toggle to STOPPED (core 0)
+void cpu_state_announce_stop(void);
+
+// Select the clock governor preset used while the CPU is running
+void cpu_state_set_clock(CPU_CLOCK_PRESET preset);
+
+// Get the current clock governor preset
+CPU_CLOCK_PRESET cpu_state_get_clock(void);
+
+// Target frequency of a preset in Hz (0 for unlimited)
+uint32_t cpu_state_clock_hz(CPU_CLOCK_PRESET preset);
+
+// Emulated clock rate measured by the governor, in kHz
+void cpu_state_set_measured_khz(uint32_t khz);
+uint32_t cpu_state_get_measured_khz(void);
+
+// Console idle statistics, kept by the main loop while the CPU waits on an
+// empty console
+typedef struct
+{
+    uint64_t idle_us;               // Time asleep waiting for console input
+    uint32_t waits;                 // Idle waits entered
+    uint32_t wakes;                 // Waits ended by console input
+    uint32_t last_wake_latency_us;  // Keypress to emulation core running again
+    uint32_t max_wake_latency_us;
+} cpu_idle_stats_t;
+
+void cpu_state_record_idle(uint64_t idle_us, bool woken_by_input, uint32_t wake_latency_us);
+void cpu_state_get_idle_stats(cpu_idle_stats_t* stats);
+void cpu_state_clear_idle_stats(void);
+
 // Process a single character for CPU monitor commands in STOPPED mode
 void process_control_panel_commands_char(uint8_t ch);
 
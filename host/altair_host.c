@@ -0,0 +1,1274 @@
+// Host-native runner and benchmark for the Altair 8800 emulator core.
+//
+//   altair_host com FILE.COM [options]  Run a CP/M .COM program (8080PRE,
+//                                       8080EXM, CPUTEST, ...) under a BDOS
+//                                       shim that prints console output
+//   altair_host cpm [options]           Boot the embedded cpm63k disk headless
+//   altair_host opcodes [options]       Host cost of each opcode
+//   altair_host machines N [options]    Run 1, 2, 4 ... N CPUs, each over its
+//                                       own memory, on as many threads
+//                                       (built-in sieve, no I/O)
+//   altair_host latency N [options]     Type N keys into CP/M from a network
+//                                       thread; report keypress to CPU latency
+//   altair_host conform [N] [--seed S]  Check the table core's handlers against
+//                                       the generic handlers they replaced on
+//                                       N random instruction streams
+//                                       (conform.h)
+//   altair_host lockstep [N] [--seed S] Check i8080_run_fast() against the
+//                                       table core a dispatch at a time on N
+//                                       random instruction streams (conform.h)
+//   altair_host interrupts              Check EI and interrupt acknowledge on
+//                                       every core (conform.h)
+//   altair_host sio2                    Check 2SIO output under a slow or
+//                                       stalled backend (sio2_checks.h)
+//   altair_host vt_screen [N] [--seed S]
+//                                       Check the console screen model's
+//                                       repaints and diffs on N random
+//                                       screens (vt_screen_checks.h)
+//   altair_host ws [--seed S]           Check WebSocket output, channels and
+//                                       slow clients against a stand-in
+//                                       server (ws_checks.h)
+//   altair_host debugger [N] [--seed S] Check breakpoints and watchpoints
+//                                       against checking every instruction
+//                                       on N random programs; needs
+//                                       -DBREAKPOINTS=ON (debugger_checks.h)
+//
+// Options:
+//   --core fast|table|step  i8080_run_fast(), i8080_run() or i8080_cycle()
+//                           per instruction (default fast)
+//   --no-fusion             Disable superinstructions in the fast core
+//                           (lockstep too)
+//   --input TEXT            cpm: console input, \r for Return
+//   --max-tstates N         Stop after N T-states (default: no limit)
+//   --profile               List the hottest PCs afterwards (fast and table
+//                           cores; needs -DPROFILER=ON)
+//   --trace N               Dump the last N instructions afterwards (table and
+//                           step cores; needs -DTRACE=ON)
+//   --save FILE             cpm: snapshot the machine to FILE afterwards
+//   --restore FILE          cpm: resume from a snapshot instead of booting
+//   --poll-ms N             latency: deliver keys on an N ms timer, as the
+//                           firmware's input path did, instead of at once
+//   --seed S                conform, lockstep, vt_screen, ws, debugger:
+//                           seed for the random streams (default 1)
+//   --panel RATE[:latch]    com, cpm: run the front panel sampler as for a
+//                           browser watching the LEDs, RATE samples per
+//                           second of a 2 MHz clock, with persistence unless
+//                           :latch is given; report its frames afterwards
+//   --usb packet|byte       com, cpm: write console output to a stand-in USB
+//                           CDC driver (include/pico/stdio_usb.h), a packet
+//                           at a time through usb_console.c as the firmware
+//                           does, or a driver call per byte as putchar() did;
+//                           report the driver calls afterwards
+//
+// Every run ends with the emulated T-states per second and MIPS. The batch
+// cores don't count instructions, so their MIPS uses the T-states per
+// instruction measured on a short i8080_cycle() run of the same workload.
+#include "Altair8800/intel8080.h"
+#include "Altair8800/memory.h"
+#include "Altair8800/op_codes.h"
+#include "Altair8800/pico_88dcdd_flash.h"
+#include "Altair8800/profiler.h"
+#include "Altair8800/trace.h"
+#include "conform.h"
+#include "debugger_checks.h"
+#include "sio2_checks.h"
+#include "vt_screen_checks.h"
+#include "ws_checks.h"
+#include "FrontPanels/panel_sampler.h"
+#include "PortDrivers/console_io.h"
+#include "PortDrivers/sio2_io.h"
+#include "disks/cpm63k_disk.h"
+#include "i8080_disasm.h"
+#include "io_ports.h"
+#include "pico/stdio_usb.h"
+#include "pico/time.h"
+#include "snapshot.h"
+#include "spsc_ring.h"
+#include "usb_console.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SLICE_TSTATES 100000
+#define CALIBRATION_TSTATES 20000000ULL
+
+// .COM runs: BDOS calls trap to the host with OUT 0FEh, warm boot with OUT 0FFh
+#define COM_LOAD_ADDRESS 0x0100
+#define COM_BDOS_ADDRESS 0xFE00
+#define COM_BDOS_PORT 0xFE
+#define COM_EXIT_PORT 0xFF
+
+// opcodes: each block is LXI SP, OPCODE_BLOCK_REPEAT copies of the opcode, JMP
+#define OPCODE_BLOCK_ADDRESS 0x1000
+#define OPCODE_BLOCK_REPEAT 128
+#define OPCODE_DATA_ADDRESS 0x8000
+#define OPCODE_STACK_ADDRESS 0xF000
+#define OPCODE_RUN_TSTATES 20000000U
+
+// machines: each runs the sieve for MACHINE_RUN_TSTATES unless --max-tstates
+// is given, then must have stored SIEVE_PRIMES at SIEVE_RESULT_ADDRESS
+#define MACHINE_RUN_TSTATES 200000000ULL
+#define SIEVE_LOAD_ADDRESS 0x0100
+#define SIEVE_RESULT_ADDRESS 0x0080
+#define SIEVE_PRIMES 1028 // Below 8192
+
+// latency: keys arrive 1-5 ms apart, a Return after every LATENCY_LINE - 1
+// letters; an idle CPU sleeps up to LATENCY_IDLE_WAIT_US as main.c does
+#define LATENCY_RING_SIZE 256 // Power of two
+#define LATENCY_GAP_MIN_US 1000
+#define LATENCY_GAP_MAX_US 5000
+#define LATENCY_LINE 8
+#define LATENCY_IDLE_WAIT_US 10000
+
+#define CONFORM_DEFAULT_STREAMS 4000
+#define DEBUGGER_DEFAULT_TRIALS 500
+#define VT_SCREEN_DEFAULT_TRIALS 20000
+
+typedef enum
+{
+    CORE_FAST,
+    CORE_TABLE,
+    CORE_STEP
+} host_core_t;
+
+typedef enum
+{
+    USB_NONE, // putchar()
+    USB_PACKET,
+    USB_BYTE
+} host_usb_t;
+
+typedef struct
+{
+    host_core_t core;
+    bool fusion;
+    const char* input;
+    uint64_t max_tstates;
+    bool quiet; // Suppress console output (calibration runs)
+    bool profile;
+    uint32_t trace; // Entries to dump
+    const char* save_path;
+    const char* restore_path;
+    uint32_t poll_ms; // latency: input timer period, 0 for none
+    uint32_t panel_rate; // Front panel samples per second, 0 for none
+    bool panel_latch;
+    host_usb_t usb; // com, cpm: console output path
+    uint32_t seed; // conform: random stream seed
+} host_options_t;
+
+typedef struct
+{
+    uint64_t tstates;
+    uint64_t instructions; // Counted by the step core only
+    double seconds;
+} host_result_t;
+
+intel8080_t cpu;
+
+extern const char* snapshot_file_path; // snapshot_file.c
+
+static host_options_t options = {.core = CORE_FAST, .fusion = true, .seed = 1};
+static bool com_finished = false;
+static const char* console_input = NULL;
+static bool prompt_seen = false;
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static const char* core_name(host_core_t core)
+{
+    switch (core)
+    {
+        case CORE_TABLE:
+            return "table";
+        case CORE_STEP:
+            return "step";
+        default:
+            return "fast";
+    }
+}
+
+#if I8080_PROFILER
+#define RUN_BATCH(run, budget) profiler_run(&cpu, (budget), (run))
+#else
+#define RUN_BATCH(run, budget) (run)(&cpu, (budget))
+#endif
+
+// The batch cores go through the front panel sampler as on a Wi-Fi board: a
+// plain call to the core until --panel enables it
+static uint32_t panel_run_table(intel8080_t* c, uint32_t budget)
+{
+    return panel_sampler_run(c, budget, i8080_run);
+}
+
+static uint32_t panel_run_fast(intel8080_t* c, uint32_t budget)
+{
+    return panel_sampler_run(c, budget, i8080_run_fast);
+}
+
+static uint32_t run_slice(host_core_t core, uint32_t budget, uint64_t* instructions)
+{
+    switch (core)
+    {
+        case CORE_TABLE:
+            return RUN_BATCH(panel_run_table, budget);
+        case CORE_STEP:
+        {
+            uint32_t executed = 0;
+            while (executed < budget && !cpu.halted)
+            {
+                executed += i8080_cycle(&cpu);
+                (*instructions)++;
+            }
+            return executed;
+        }
+        default:
+            return RUN_BATCH(panel_run_fast, budget);
+    }
+}
+
+static void console_write(uint8_t c)
+{
+    c &= 0x7F;
+    if (!options.quiet)
+    {
+        switch (options.usb)
+        {
+            case USB_PACKET:
+                usb_console_put(c);
+                break;
+            case USB_BYTE:
+                stdio_usb.out_chars((const char*)&c, 1);
+                break;
+            default:
+                putchar(c);
+                break;
+        }
+    }
+
+    // Hold input back until CP/M first prompts for a command
+    static uint8_t last = 0;
+    if (last == 'A' && c == '>')
+    {
+        prompt_seen = true;
+    }
+    last = c;
+}
+
+static uint8_t console_read(void)
+{
+    if (prompt_seen && console_input != NULL && *console_input != '\0')
+    {
+        return (uint8_t)*console_input++;
+    }
+    return 0x00;
+}
+
+static size_t console_read_bytes(uint8_t* buffer, size_t max_len)
+{
+    size_t count = 0;
+    uint8_t c;
+
+    while (count < max_len && (c = console_read()) != 0)
+    {
+        buffer[count++] = c;
+    }
+    return count;
+}
+
+static size_t console_write_bytes(const uint8_t* data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        console_write(data[i]);
+    }
+    return length;
+}
+
+// 2SIO channel 1; channel 2 is left unattached
+static const sio2_backend_t sio2_console = {console_read_bytes, console_write_bytes, NULL};
+
+// BDOS shim for .COM programs: console output, print string and CONST
+static void com_port_out(void* context, uint8_t port, uint8_t data)
+{
+    (void)context;
+    (void)data;
+
+    if (port == COM_EXIT_PORT)
+    {
+        com_finished = true;
+        return;
+    }
+    if (port != COM_BDOS_PORT)
+    {
+        return;
+    }
+
+    switch (cpu.registers.c)
+    {
+        case 0:
+            com_finished = true;
+            break;
+        case 2:
+            console_write(cpu.registers.e);
+            break;
+        case 9:
+            for (uint16_t addr = cpu.registers.de; memory[addr] != '$'; addr++)
+            {
+                console_write(memory[addr]);
+            }
+            break;
+        case 11:
+            cpu.registers.a = 0x00;
+            break;
+        default:
+            break;
+    }
+}
+
+static uint8_t* com_image = NULL;
+static size_t com_length = 0;
+
+static bool load_com(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        perror(path);
+        return false;
+    }
+
+    com_image = malloc(0x10000);
+    com_length = fread(com_image, 1, COM_BDOS_ADDRESS - COM_LOAD_ADDRESS, file);
+    fclose(file);
+    return com_length > 0;
+}
+
+static void setup_com(void)
+{
+    memset(memory, 0, sizeof(memory));
+    memcpy(&memory[COM_LOAD_ADDRESS], com_image, com_length);
+
+    static const uint8_t warm_boot[] = {0xD3, COM_EXIT_PORT, 0x76};                    // OUT 0FFh; HLT
+    static const uint8_t bdos_entry[] = {0xC3, COM_BDOS_ADDRESS & 0xFF, COM_BDOS_ADDRESS >> 8}; // JMP BDOS
+    static const uint8_t bdos[] = {0xD3, COM_BDOS_PORT, 0xC9};                         // OUT 0FEh; RET
+    memcpy(&memory[0x0000], warm_boot, sizeof(warm_boot));
+    memcpy(&memory[0x0005], bdos_entry, sizeof(bdos_entry));
+    memcpy(&memory[COM_BDOS_ADDRESS], bdos, sizeof(bdos));
+    memory_mark_all_dirty();
+
+    i8080_reset(&cpu, memory);
+    io_port_register(COM_BDOS_PORT, NULL, com_port_out, NULL);
+    io_port_register(COM_EXIT_PORT, NULL, com_port_out, NULL);
+    cpu.registers.sp = COM_BDOS_ADDRESS - 2; // Returning from the program warm boots
+    cpu.registers.pc = COM_LOAD_ADDRESS;
+    com_finished = false;
+}
+
+static bool com_done(void)
+{
+    return com_finished || cpu.halted;
+}
+
+static void setup_cpm(void)
+{
+    memset(memory, 0, sizeof(memory));
+    pico_disk_init();
+    pico_disk_load(0, cpm63k_dsk, cpm63k_dsk_len);
+    loadDiskLoader(0xFF00);
+
+    i8080_reset(&cpu, memory);
+    console_io_init(&cpu, console_read, console_write);
+    sio2_io_init(&cpu);
+    sio2_attach(0, &sio2_console);
+    io_ports_init();
+    i8080_examine(&cpu, 0xFF00);
+    console_input = options.input;
+    prompt_seen = false;
+
+    if (options.restore_path != NULL)
+    {
+        snapshot_file_path = options.restore_path;
+        if (!snapshot_load())
+        {
+            fprintf(stderr, "%s: not a snapshot from this build\n", options.restore_path);
+            exit(1);
+        }
+        prompt_seen = true; // Restored at the prompt it was saved at
+    }
+}
+
+// Finished once CP/M sits at an empty console with all input consumed
+static bool cpm_done(void)
+{
+    bool done = cpu.console_idle && prompt_seen && (console_input == NULL || *console_input == '\0');
+    cpu.console_idle = false;
+    return done;
+}
+
+static host_result_t run_workload(void (*setup)(void), bool (*done)(void), host_core_t core, uint64_t max_tstates)
+{
+    host_result_t result = {0};
+
+    setup();
+    i8080_set_fusion(options.fusion);
+
+    double start = now_seconds();
+    while (!done() && (max_tstates == 0 || result.tstates < max_tstates))
+    {
+        result.tstates += run_slice(core, SLICE_TSTATES, &result.instructions);
+        sio2_flush();
+
+        // Close frames as the main loop does and take them as core 1 does
+        if (options.panel_rate)
+        {
+            uint8_t frame[PANEL_SAMPLER_FRAME_MAX];
+            panel_sampler_poll(&cpu, false);
+            while (panel_sampler_take_frame(frame, sizeof(frame)) > 0)
+            {
+            }
+        }
+
+        // Flushed before an idle wait, and by the main loop once a byte has
+        // waited USB_CONSOLE_FLUSH_US
+        if (options.usb == USB_PACKET)
+        {
+            if (cpu.console_idle)
+            {
+                usb_console_flush();
+            }
+            else
+            {
+                usb_console_poll();
+            }
+        }
+    }
+    if (options.usb == USB_PACKET)
+    {
+        usb_console_flush();
+    }
+    result.seconds = now_seconds() - start;
+    return result;
+}
+
+static void report(const char* workload, host_result_t result, double tstates_per_instruction)
+{
+    double mhz = (double)result.tstates / result.seconds / 1e6;
+    double mips = result.instructions ? (double)result.instructions / result.seconds / 1e6
+                                      : mhz / tstates_per_instruction;
+
+    printf("\n%s: core %s, fusion %s, %llu T-states in %.3f s\n", workload, core_name(options.core),
+           options.fusion ? "on" : "off", (unsigned long long)result.tstates, result.seconds);
+    printf("  %.2f M T-states/s (%.1fx a 2 MHz Altair), %.2f MIPS%s\n", mhz, mhz / 2.0, mips,
+           result.instructions ? "" : " (estimated)");
+}
+
+#if I8080_PROFILER
+static void report_profile(void)
+{
+    profiler_entry_t top[PROFILER_TOP_MAX];
+    uint64_t samples, dropped;
+
+    profiler_totals(&samples, &dropped);
+    size_t count = profiler_top(top, PROFILER_TOP_MAX);
+    printf("  %llu PC samples, %llu dropped\n", (unsigned long long)samples, (unsigned long long)dropped);
+
+    for (size_t i = 0; i < count && samples > 0; i++)
+    {
+        uint8_t length = 0;
+        const char* name = get_i8080_instruction_name(memory[top[i].pc], &length);
+        printf("  %04x %5.1f%%  %s\n", top[i].pc, 100.0 * top[i].samples / (double)samples, name);
+    }
+}
+#endif
+
+static void report_usb(double seconds)
+{
+    printf("USB console: %s, %llu bytes in %llu driver calls, %.1f bytes/call, %.0f bytes/s\n",
+           options.usb == USB_PACKET ? "packet" : "byte", (unsigned long long)stdio_usb_out_bytes,
+           (unsigned long long)stdio_usb_out_calls,
+           stdio_usb_out_calls ? (double)stdio_usb_out_bytes / stdio_usb_out_calls : 0.0,
+           (double)stdio_usb_out_bytes / seconds);
+}
+
+static void report_panel(void)
+{
+    panel_sampler_stats_t stats;
+    panel_sampler_get_stats(&stats);
+
+    printf("Front panel: %u samples/s, %s, %llu samples, %u frames (%u whole), %u dropped, %.1f bytes/frame\n",
+           stats.rate_hz, stats.persistence ? "persistence" : "latched", (unsigned long long)stats.samples,
+           stats.frames, stats.key_frames, stats.dropped, stats.frames ? (double)stats.bytes / stats.frames : 0.0);
+}
+
+#if I8080_TRACE
+static void report_trace(uint32_t count)
+{
+    char line[128];
+    const trace_entry_t* previous = NULL;
+    uint32_t elapsed = 0;
+
+    if (count > trace_count())
+    {
+        count = trace_count();
+    }
+
+    for (uint32_t index = count; index-- > 0;)
+    {
+        const trace_entry_t* entry = trace_get(index);
+        if (previous)
+        {
+            elapsed += trace_delta(previous, entry);
+        }
+        previous = entry;
+
+        trace_format(entry, elapsed, line, sizeof(line));
+        printf("  %s\n", line);
+    }
+}
+#endif
+
+static int run_program(const char* workload, void (*setup)(void), bool (*done)(void))
+{
+    double tstates_per_instruction = 0;
+
+    if (options.core != CORE_STEP)
+    {
+        options.quiet = true;
+        host_result_t sample = run_workload(setup, done, CORE_STEP, CALIBRATION_TSTATES);
+        options.quiet = false;
+        tstates_per_instruction = (double)sample.tstates / (double)sample.instructions;
+    }
+
+#if I8080_PROFILER
+    if (options.profile)
+    {
+        profiler_start();
+    }
+#endif
+
+#if I8080_TRACE
+    trace_clear();
+    trace_set_enabled(options.trace > 0);
+#endif
+
+    if (options.panel_rate)
+    {
+        panel_sampler_configure(options.panel_rate, !options.panel_latch);
+        panel_sampler_enable(true);
+    }
+
+    stdio_usb_out_calls = 0;
+    stdio_usb_out_bytes = 0;
+    host_result_t result = run_workload(setup, done, options.core, options.max_tstates);
+    report(workload, result, tstates_per_instruction);
+
+    if (options.usb != USB_NONE)
+    {
+        report_usb(result.seconds);
+    }
+
+    if (options.panel_rate)
+    {
+        panel_sampler_enable(false);
+        report_panel();
+    }
+
+#if I8080_TRACE
+    if (options.trace > 0)
+    {
+        report_trace(options.trace);
+    }
+#endif
+
+#if I8080_PROFILER
+    if (options.profile)
+    {
+        report_profile();
+    }
+#endif
+    return 0;
+}
+
+static bool opcode_measurable(uint8_t op_code, uint8_t length)
+{
+    if (length == 0 || op_code == 0x76) // Undefined, HLT
+    {
+        return false;
+    }
+    if ((op_code & 0xC0) == 0xC0)
+    {
+        // Jumps, calls, returns, RST, PCHL and I/O leave the block
+        switch (op_code & 0x07)
+        {
+            case 0x00:
+            case 0x02:
+            case 0x04:
+            case 0x07:
+                return false;
+            case 0x03:
+                return op_code == 0xE3 || op_code == 0xEB || op_code == 0xF3 || op_code == 0xFB;
+            case 0x01:
+                return op_code != 0xC9 && op_code != 0xE9;
+            case 0x05:
+                return op_code != 0xCD;
+            default:
+                return true;
+        }
+    }
+    return true;
+}
+
+static void setup_opcode_block(uint8_t op_code, uint8_t length)
+{
+    uint16_t addr = OPCODE_BLOCK_ADDRESS;
+
+    memset(memory, 0, sizeof(memory));
+    memory[addr++] = 0x31; // LXI SP
+    memory[addr++] = OPCODE_STACK_ADDRESS & 0xFF;
+    memory[addr++] = OPCODE_STACK_ADDRESS >> 8;
+    for (int i = 0; i < OPCODE_BLOCK_REPEAT; i++)
+    {
+        memory[addr++] = op_code;
+        if (length == 2)
+        {
+            memory[addr++] = 0x01;
+        }
+        else if (length == 3)
+        {
+            memory[addr++] = OPCODE_DATA_ADDRESS & 0xFF;
+            memory[addr++] = OPCODE_DATA_ADDRESS >> 8;
+        }
+    }
+    memory[addr++] = 0xC3; // JMP
+    memory[addr++] = OPCODE_BLOCK_ADDRESS & 0xFF;
+    memory[addr++] = OPCODE_BLOCK_ADDRESS >> 8;
+    memory_mark_all_dirty();
+
+    i8080_reset(&cpu, memory);
+    cpu.registers.bc = cpu.registers.de = cpu.registers.hl = OPCODE_DATA_ADDRESS;
+    cpu.registers.a = 0x55;
+    cpu.registers.pc = OPCODE_BLOCK_ADDRESS;
+}
+
+static int run_opcodes(void)
+{
+    double total_ns = 0;
+    int measured = 0;
+
+    i8080_set_fusion(options.fusion);
+    printf("Host cost per instruction, core %s (blocks of %d plus LXI SP and JMP)\n", core_name(options.core),
+           OPCODE_BLOCK_REPEAT);
+    printf("op  %-12s %3s %9s %9s\n", "instruction", "T", "ns/instr", "ns/T");
+
+    for (int op = 0; op < 256; op++)
+    {
+        uint8_t length = 0;
+        const char* name = get_i8080_instruction_name((uint8_t)op, &length);
+        if (!opcode_measurable((uint8_t)op, length))
+        {
+            continue;
+        }
+
+        // T-states of one instance of the opcode
+        setup_opcode_block((uint8_t)op, length);
+        i8080_cycle(&cpu);
+        uint8_t tstates = i8080_cycle(&cpu);
+
+        setup_opcode_block((uint8_t)op, length);
+        uint64_t instructions = 0;
+        uint64_t executed = 0;
+        double start = now_seconds();
+        while (executed < OPCODE_RUN_TSTATES)
+        {
+            executed += run_slice(options.core, SLICE_TSTATES, &instructions);
+        }
+        double seconds = now_seconds() - start;
+
+        // Every block runs OPCODE_BLOCK_REPEAT + 2 instructions
+        uint32_t block_tstates = CYCLES_LXI + CYCLES_JMP + OPCODE_BLOCK_REPEAT * tstates;
+        double blocks = (double)executed / block_tstates;
+        double ns = seconds * 1e9 / (blocks * (OPCODE_BLOCK_REPEAT + 2));
+
+        printf("%02X  %-12s %3u %9.2f %9.2f\n", op, name, tstates, ns, ns / tstates);
+        total_ns += ns;
+        measured++;
+    }
+
+    printf("\n%d opcodes, mean %.2f ns per instruction\n", measured, total_ns / measured);
+    return 0;
+}
+
+// Sieve of Eratosthenes over the 8K flags at 2000h-3FFFh, repeated forever.
+// Self-contained: no console or port I/O, which go through process-wide
+// tables, so the machines share no state.
+static const uint8_t sieve_program[] = {
+    0x21, 0x00, 0x20, //       LXI  H,2000h
+    0x01, 0x00, 0x20, //       LXI  B,2000h
+    0x36, 0x01,       // FILL: MVI  M,1
+    0x23,             //       INX  H
+    0x0B,             //       DCX  B
+    0x78,             //       MOV  A,B
+    0xB1,             //       ORA  C
+    0xC2, 0x06, 0x01, //       JNZ  FILL
+    0x11, 0x00, 0x00, //       LXI  D,0        ; primes found
+    0x01, 0x02, 0x00, //       LXI  B,2        ; candidate
+    0x21, 0x00, 0x20, // NEXT: LXI  H,2000h
+    0x09,             //       DAD  B
+    0x7E,             //       MOV  A,M
+    0xB7,             //       ORA  A
+    0xCA, 0x2B, 0x01, //       JZ   SKIP
+    0x13,             //       INX  D
+    0x09,             // MARK: DAD  B          ; strike out the multiples
+    0x7C,             //       MOV  A,H
+    0xFE, 0x40,       //       CPI  40h
+    0xD2, 0x2B, 0x01, //       JNC  SKIP
+    0x36, 0x00,       //       MVI  M,0
+    0xC3, 0x1F, 0x01, //       JMP  MARK
+    0x03,             // SKIP: INX  B
+    0x78,             //       MOV  A,B
+    0xFE, 0x20,       //       CPI  20h
+    0xDA, 0x15, 0x01, //       JC   NEXT
+    0xEB,             //       XCHG
+    0x22, 0x80, 0x00, //       SHLD 0080h
+    0xC3, 0x00, 0x01, //       JMP  0100h
+};
+
+typedef struct
+{
+    intel8080_t cpu;
+    uint8_t* memory;
+    uint64_t tstates;
+    double seconds;
+} host_machine_t;
+
+static void* run_machine(void* arg)
+{
+    host_machine_t* machine = (host_machine_t*)arg;
+    uint64_t budget = options.max_tstates ? options.max_tstates : MACHINE_RUN_TSTATES;
+    double start = now_seconds();
+
+    while (machine->tstates < budget)
+    {
+        switch (options.core)
+        {
+            case CORE_TABLE:
+                machine->tstates += i8080_run(&machine->cpu, SLICE_TSTATES);
+                break;
+            case CORE_STEP:
+                for (uint32_t executed = 0; executed < SLICE_TSTATES;)
+                {
+                    uint8_t tstates = i8080_cycle(&machine->cpu);
+                    executed += tstates;
+                    machine->tstates += tstates;
+                }
+                break;
+            default:
+                machine->tstates += i8080_run_fast(&machine->cpu, SLICE_TSTATES);
+                break;
+        }
+    }
+    machine->seconds = now_seconds() - start;
+    return NULL;
+}
+
+// Run count machines at once, each over its own memory; returns how many
+// finished with the right sieve result
+static int run_machine_set(host_machine_t* machines, int count, double* per_machine, double* total)
+{
+    pthread_t threads[count];
+    double start = now_seconds();
+    int correct = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        host_machine_t* machine = &machines[i];
+        memset(machine->memory, 0, 64 * 1024);
+        memcpy(&machine->memory[SIEVE_LOAD_ADDRESS], sieve_program, sizeof(sieve_program));
+        i8080_reset(&machine->cpu, machine->memory);
+        machine->cpu.registers.pc = SIEVE_LOAD_ADDRESS;
+        machine->tstates = 0;
+        pthread_create(&threads[i], NULL, run_machine, machine);
+    }
+
+    uint64_t tstates = 0;
+    *per_machine = 0;
+    for (int i = 0; i < count; i++)
+    {
+        pthread_join(threads[i], NULL);
+        tstates += machines[i].tstates;
+        *per_machine += (double)machines[i].tstates / machines[i].seconds / 1e6 / count;
+        if (read16(machines[i].memory, SIEVE_RESULT_ADDRESS) == SIEVE_PRIMES)
+        {
+            correct++;
+        }
+    }
+    *total = (double)tstates / (now_seconds() - start) / 1e6;
+    return correct;
+}
+
+static int run_machines(int max_machines)
+{
+    // Only the CPU and its memory are per machine; these record into one
+    // process-wide table or ring from every thread
+#if I8080_DECODE_CACHE || I8080_PROFILER || I8080_TRACE
+    fprintf(stderr, "machines needs a build without DECODE_CACHE, PROFILER or TRACE (they are process-wide)\n");
+    return 2;
+#endif
+    host_machine_t* machines = calloc((size_t)max_machines, sizeof(host_machine_t));
+    int failed = 0;
+
+    for (int i = 0; i < max_machines; i++)
+    {
+        machines[i].memory = malloc(64 * 1024);
+    }
+
+    i8080_set_fusion(options.fusion);
+    printf("Machines, each a CPU over its own memory, running the sieve, core %s, fusion %s\n", core_name(options.core),
+           options.fusion ? "on" : "off");
+    printf("%8s %18s %14s %8s\n", "machines", "M T-states/s each", "M T-states/s", "results");
+
+    for (int count = 1;; count *= 2)
+    {
+        if (count > max_machines)
+        {
+            count = max_machines;
+        }
+
+        double per_machine, total;
+        int correct = run_machine_set(machines, count, &per_machine, &total);
+        printf("%8d %18.2f %14.2f %5d/%d\n", count, per_machine, total, correct, count);
+        failed += count - correct;
+
+        if (count == max_machines)
+        {
+            break;
+        }
+    }
+
+    for (int i = 0; i < max_machines; i++)
+    {
+        free(machines[i].memory);
+    }
+    free(machines);
+    return failed ? 1 : 0;
+}
+
+// Keypress to CPU latency, modelled on the firmware's WebSocket input path: a
+// "network" thread plays core 1, handing keys over through an SPSC ring and
+// ringing a doorbell, while the main thread plays core 0, running slices and
+// sleeping on the doorbell whenever CP/M is idle at the console. A key's
+// latency runs from its arrival to the IN instruction that reads it.
+typedef struct
+{
+    spsc_ring_t ring;
+    uint8_t storage[LATENCY_RING_SIZE];
+    pthread_mutex_t lock;
+    pthread_cond_t doorbell;
+    uint32_t keys;
+    uint64_t* arrived_us; // Written before the key is enqueued
+    uint32_t* latency_us;
+    uint32_t seen;
+} latency_state_t;
+
+static latency_state_t latency = {.lock = PTHREAD_MUTEX_INITIALIZER, .doorbell = PTHREAD_COND_INITIALIZER};
+
+static void sleep_us(uint64_t us)
+{
+    struct timespec ts = {.tv_sec = (time_t)(us / 1000000), .tv_nsec = (long)(us % 1000000) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+static void* latency_network(void* arg)
+{
+    (void)arg;
+
+    for (uint32_t i = 0; i < latency.keys; i++)
+    {
+        sleep_us(LATENCY_GAP_MIN_US + (uint64_t)rand() % (LATENCY_GAP_MAX_US - LATENCY_GAP_MIN_US));
+
+        uint8_t key = (i % LATENCY_LINE == LATENCY_LINE - 1) ? '\r' : (uint8_t)('A' + i % 26);
+        uint64_t now = time_us_64();
+        latency.arrived_us[i] = now;
+
+        // The old input path: the message waits in the server for the next
+        // timer tick
+        if (options.poll_ms > 0)
+        {
+            uint64_t period = options.poll_ms * 1000ULL;
+            sleep_us(period - now % period);
+        }
+
+        while (spsc_ring_enqueue_bytes(&latency.ring, &key, 1) == 0)
+        {
+            sleep_us(100);
+        }
+
+        pthread_mutex_lock(&latency.lock);
+        pthread_cond_signal(&latency.doorbell);
+        pthread_mutex_unlock(&latency.lock);
+    }
+    return NULL;
+}
+
+static uint8_t latency_read(void)
+{
+    const uint8_t* data;
+
+    if (spsc_ring_peek(&latency.ring, &data) == 0)
+    {
+        return 0x00;
+    }
+
+    uint8_t key = *data;
+    spsc_ring_commit(&latency.ring, 1);
+    latency.latency_us[latency.seen] = (uint32_t)(time_us_64() - latency.arrived_us[latency.seen]);
+    latency.seen++;
+    return key;
+}
+
+static size_t latency_read_bytes(uint8_t* buffer, size_t max_len)
+{
+    size_t count = 0;
+    uint8_t c;
+
+    while (count < max_len && (c = latency_read()) != 0)
+    {
+        buffer[count++] = c;
+    }
+    return count;
+}
+
+static const sio2_backend_t sio2_latency = {latency_read_bytes, console_write_bytes, NULL};
+
+// console_idle_wait() in main.c, with the doorbell in place of WFE
+static void latency_idle_wait(void)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += LATENCY_IDLE_WAIT_US * 1000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&latency.lock);
+    while (spsc_ring_is_empty(&latency.ring) &&
+           pthread_cond_timedwait(&latency.doorbell, &latency.lock, &deadline) == 0)
+    {
+    }
+    pthread_mutex_unlock(&latency.lock);
+}
+
+static int compare_u32(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static int run_latency(uint32_t keys)
+{
+    // Boot to the first prompt with no input
+    options.quiet = true;
+    run_workload(setup_cpm, cpm_done, options.core, 0);
+
+    spsc_ring_init(&latency.ring, latency.storage, LATENCY_RING_SIZE);
+    latency.keys = keys;
+    latency.seen = 0;
+    latency.arrived_us = calloc(keys, sizeof(uint64_t));
+    latency.latency_us = calloc(keys, sizeof(uint32_t));
+    console_io_init(&cpu, latency_read, console_write);
+    sio2_attach(0, &sio2_latency);
+
+    printf("Keypress to CPU latency, %u keys %d-%d ms apart, core %s, %s\n", keys, LATENCY_GAP_MIN_US / 1000,
+           LATENCY_GAP_MAX_US / 1000, core_name(options.core), options.poll_ms ? "input timer" : "doorbell");
+
+    pthread_t network;
+    pthread_create(&network, NULL, latency_network, NULL);
+
+    uint64_t instructions = 0;
+    uint32_t waits = 0;
+    while (latency.seen < keys)
+    {
+        run_slice(options.core, SLICE_TSTATES, &instructions);
+        sio2_flush();
+        if (cpu.console_idle)
+        {
+            cpu.console_idle = false;
+            latency_idle_wait();
+            waits++;
+        }
+    }
+    pthread_join(network, NULL);
+
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < keys; i++)
+    {
+        total += latency.latency_us[i];
+    }
+    qsort(latency.latency_us, keys, sizeof(uint32_t), compare_u32);
+
+    if (options.poll_ms)
+    {
+        printf("  input timer %u ms\n", options.poll_ms);
+    }
+    printf("  %u idle waits\n", waits);
+    printf("  latency us: min %u, median %u, mean %.1f, p99 %u, max %u\n", latency.latency_us[0],
+           latency.latency_us[keys / 2], (double)total / keys, latency.latency_us[(uint64_t)keys * 99 / 100],
+           latency.latency_us[keys - 1]);
+
+    free(latency.arrived_us);
+    free(latency.latency_us);
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "Usage: altair_host com FILE.COM | cpm | opcodes | machines N | latency N | conform [N]\n"
+                    "                   | lockstep [N] | interrupts | sio2\n"
+                    "                   | vt_screen [N] | ws | debugger [N]\n"
+                    "                   [--core fast|table|step] [--no-fusion] [--input TEXT]\n"
+                    "                   [--max-tstates N] [--profile] [--trace N] [--save FILE]\n"
+                    "                   [--restore FILE] [--poll-ms N] [--panel RATE[:latch]]\n"
+                    "                   [--usb packet|byte] [--seed S]\n");
+}
+
+// --input accepts \r and \n escapes so a command line can press Return
+static char* unescape(const char* text)
+{
+    char* out = malloc(strlen(text) + 1);
+    char* p = out;
+
+    while (*text)
+    {
+        if (text[0] == '\\' && (text[1] == 'r' || text[1] == 'n'))
+        {
+            *p++ = '\r';
+            text += 2;
+        }
+        else
+        {
+            *p++ = *text++;
+        }
+    }
+    *p = '\0';
+    return out;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        usage();
+        return 2;
+    }
+
+    const char* mode = argv[1];
+    const char* com_path = NULL;
+    int max_machines = 0;
+    int latency_keys = 0;
+    uint32_t conform_streams = CONFORM_DEFAULT_STREAMS;
+    uint32_t vt_screen_trials = VT_SCREEN_DEFAULT_TRIALS;
+#if I8080_BREAKPOINTS
+    uint32_t debugger_trials = DEBUGGER_DEFAULT_TRIALS;
+#endif
+    int arg = 2;
+
+    if (strcmp(mode, "com") == 0)
+    {
+        if (argc < 3)
+        {
+            usage();
+            return 2;
+        }
+        com_path = argv[arg++];
+    }
+    else if (strcmp(mode, "machines") == 0)
+    {
+        if (argc < 3 || (max_machines = atoi(argv[arg++])) < 1)
+        {
+            usage();
+            return 2;
+        }
+    }
+    else if (strcmp(mode, "latency") == 0)
+    {
+        if (argc < 3 || (latency_keys = atoi(argv[arg++])) < 1)
+        {
+            usage();
+            return 2;
+        }
+    }
+    else if ((strcmp(mode, "conform") == 0 || strcmp(mode, "lockstep") == 0) && argc > 2 && argv[arg][0] != '-')
+    {
+        if ((conform_streams = (uint32_t)strtoul(argv[arg++], NULL, 0)) < 1)
+        {
+            usage();
+            return 2;
+        }
+    }
+    else if (strcmp(mode, "vt_screen") == 0 && argc > 2 && argv[arg][0] != '-')
+    {
+        if ((vt_screen_trials = (uint32_t)strtoul(argv[arg++], NULL, 0)) < 1)
+        {
+            usage();
+            return 2;
+        }
+    }
+#if I8080_BREAKPOINTS
+    else if (strcmp(mode, "debugger") == 0 && argc > 2 && argv[arg][0] != '-')
+    {
+        if ((debugger_trials = (uint32_t)strtoul(argv[arg++], NULL, 0)) < 1)
+        {
+            usage();
+            return 2;
+        }
+    }
+#endif
+
+    for (; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--core") == 0 && arg + 1 < argc)
+        {
+            const char* name = argv[++arg];
+            options.core = strcmp(name, "table") == 0 ? CORE_TABLE : strcmp(name, "step") == 0 ? CORE_STEP : CORE_FAST;
+        }
+        else if (strcmp(argv[arg], "--no-fusion") == 0)
+        {
+            options.fusion = false;
+        }
+#if I8080_PROFILER
+        else if (strcmp(argv[arg], "--profile") == 0)
+        {
+            options.profile = true;
+        }
+#endif
+#if I8080_TRACE
+        else if (strcmp(argv[arg], "--trace") == 0 && arg + 1 < argc)
+        {
+            options.trace = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        }
+#endif
+        else if (strcmp(argv[arg], "--input") == 0 && arg + 1 < argc)
+        {
+            options.input = unescape(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "--max-tstates") == 0 && arg + 1 < argc)
+        {
+            options.max_tstates = strtoull(argv[++arg], NULL, 0);
+        }
+        else if (strcmp(argv[arg], "--save") == 0 && arg + 1 < argc)
+        {
+            options.save_path = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "--restore") == 0 && arg + 1 < argc)
+        {
+            options.restore_path = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "--poll-ms") == 0 && arg + 1 < argc)
+        {
+            options.poll_ms = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        }
+        else if (strcmp(argv[arg], "--panel") == 0 && arg + 1 < argc)
+        {
+            char* end;
+            options.panel_rate = (uint32_t)strtoul(argv[++arg], &end, 0);
+            options.panel_latch = strcmp(end, ":latch") == 0;
+        }
+        else if (strcmp(argv[arg], "--usb") == 0 && arg + 1 < argc)
+        {
+            const char* path = argv[++arg];
+            options.usb = strcmp(path, "byte") == 0 ? USB_BYTE : USB_PACKET;
+        }
+        else if (strcmp(argv[arg], "--seed") == 0 && arg + 1 < argc)
+        {
+            options.seed = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        }
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+#if I8080_TRACE
+    // Only the measured run of com and cpm records
+    trace_set_enabled(false);
+#endif
+
+    if (com_path != NULL)
+    {
+        return load_com(com_path) ? run_program(com_path, setup_com, com_done) : 1;
+    }
+    if (strcmp(mode, "cpm") == 0)
+    {
+        int status = run_program("cpm63k", setup_cpm, cpm_done);
+        if (status == 0 && options.save_path != NULL)
+        {
+            snapshot_file_path = options.save_path;
+            if (!snapshot_save())
+            {
+                perror(options.save_path);
+                return 1;
+            }
+            printf("Snapshot saved to %s\n", options.save_path);
+        }
+        return status;
+    }
+    if (strcmp(mode, "opcodes") == 0)
+    {
+        return run_opcodes();
+    }
+    if (max_machines > 0)
+    {
+        return run_machines(max_machines);
+    }
+    if (latency_keys > 0)
+    {
+        return run_latency((uint32_t)latency_keys);
+    }
+    if (strcmp(mode, "conform") == 0)
+    {
+        return run_conformance(conform_streams, options.seed);
+    }
+    if (strcmp(mode, "lockstep") == 0)
+    {
+        return run_lockstep(conform_streams, options.seed, options.fusion);
+    }
+    if (strcmp(mode, "interrupts") == 0)
+    {
+        return run_interrupt_checks();
+    }
+    if (strcmp(mode, "sio2") == 0)
+    {
+        return run_sio2_checks();
+    }
+    if (strcmp(mode, "vt_screen") == 0)
+    {
+        return run_vt_screen_checks(vt_screen_trials, options.seed);
+    }
+    if (strcmp(mode, "ws") == 0)
+    {
+        return run_ws_checks(options.seed);
+    }
+#if I8080_BREAKPOINTS
+    if (strcmp(mode, "debugger") == 0)
+    {
+        return run_debugger_checks(debugger_trials, options.seed);
+    }
+#endif
+
+    usage();
+    return 2;
+}
@@ -0,0 +1,334 @@
+// Conformance, lockstep and interrupt runs (conform.h)
+#include "conform.h"
+
+#include "conform_reference.h"
+
+#include "Altair8800/intel8080.h"
+#include "Altair8800/memory.h"
+#include "Altair8800/op_codes.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint8_t test_memory[64 * 1024];
+static uint8_t reference_memory[64 * 1024];
+static uint8_t batch_memory[64 * 1024];
+
+// xorshift32
+static uint32_t next_random(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// Reset test onto test_memory with random memory and registers, and make
+// reference a copy of it on reference_memory
+static void random_machines(intel8080_t* test, intel8080_t* reference, uint32_t* state)
+{
+    i8080_reset(test, test_memory);
+    for (size_t i = 0; i < sizeof(test_memory); i += 4)
+    {
+        uint32_t r = next_random(state);
+        memcpy(&test_memory[i], &r, 4);
+    }
+    memory_mark_all_dirty();
+
+    test->registers.af = (uint16_t)((next_random(state) & 0xffd7) | 0x02); // IF and bit 3 clear, bit 1 set
+    test->registers.bc = (uint16_t)next_random(state);
+    test->registers.de = (uint16_t)next_random(state);
+    test->registers.hl = (uint16_t)next_random(state);
+    test->registers.sp = (uint16_t)next_random(state);
+    test->registers.pc = (uint16_t)next_random(state);
+
+    *reference = *test;
+    reference->memory = reference_memory;
+    memcpy(reference_memory, test_memory, sizeof(test_memory));
+}
+
+static bool same_state(const intel8080_t* test, const intel8080_t* reference)
+{
+    return memcmp(&test->registers, &reference->registers, sizeof(registers_t)) == 0 &&
+           test->cycles == reference->cycles && test->address_bus == reference->address_bus &&
+           test->data_bus == reference->data_bus && test->cpuStatus == reference->cpuStatus &&
+           test->halted == reference->halted && test->ei_delay == reference->ei_delay &&
+           memcmp(test->memory, reference->memory, sizeof(test_memory)) == 0;
+}
+
+static void report(const char* name, const intel8080_t* cpu)
+{
+    fprintf(stderr,
+            "  %-9s AF %04X BC %04X DE %04X HL %04X SP %04X PC %04X  T %llu  bus %04X/%02X  status %02X\n", name,
+            cpu->registers.af, cpu->registers.bc, cpu->registers.de, cpu->registers.hl, cpu->registers.sp,
+            cpu->registers.pc, (unsigned long long)cpu->cycles, cpu->address_bus, cpu->data_bus, cpu->cpuStatus);
+}
+
+static void report_memory(const char* test_name, const intel8080_t* test, const intel8080_t* reference)
+{
+    for (size_t i = 0; i < sizeof(test_memory); i++)
+    {
+        if (test->memory[i] != reference->memory[i])
+        {
+            fprintf(stderr, "  memory %04zX: %s %02X reference %02X\n", i, test_name, test->memory[i],
+                    reference->memory[i]);
+        }
+    }
+}
+
+int run_conformance(uint32_t streams, uint32_t seed)
+{
+    static intel8080_t test;
+    static intel8080_t reference;
+    static intel8080_t batch;
+    uint32_t state = seed ? seed : 1;
+    uint64_t checked = 0;
+    uint64_t opcodes[256] = {0};
+
+    for (uint32_t stream = 0; stream < streams; stream++)
+    {
+        random_machines(&test, &reference, &state);
+        batch = test;
+        batch.memory = batch_memory;
+        memcpy(batch_memory, test_memory, sizeof(test_memory));
+
+        for (uint32_t step = 0; step < CONFORM_STREAM_STEPS && !test.halted; step++)
+        {
+            uint16_t pc = test.registers.pc;
+            uint8_t op_code = test_memory[pc];
+            intel8080_t before = test;
+
+            i8080_cycle(&test);
+            conform_reference_cycle(&reference, reference_memory);
+
+            checked++;
+            opcodes[op_code]++;
+            if (!same_state(&test, &reference))
+            {
+                fprintf(stderr, "conform: opcode %02X at %04X differs (seed %u, stream %u, step %u)\n", op_code, pc,
+                        seed, stream, step);
+                report("before", &before);
+                report("handler", &test);
+                report("reference", &reference);
+                report_memory("handler", &test, &reference);
+                return 1;
+            }
+        }
+
+        // The same instructions in one i8080_run() batch, where deferred
+        // flags carry from one instruction to the next
+        memory_mark_all_dirty();
+        i8080_run(&batch, (uint32_t)(reference.cycles - batch.cycles));
+        if (!same_state(&batch, &reference))
+        {
+            fprintf(stderr, "conform: stream %u differs when run as one batch (seed %u)\n", stream, seed);
+            report("batch", &batch);
+            report("reference", &reference);
+            report_memory("batch", &batch, &reference);
+            return 1;
+        }
+    }
+
+    int covered = 0;
+    for (int i = 0; i < 256; i++)
+    {
+        covered += opcodes[i] != 0;
+    }
+    printf("conform: %llu instructions over %d opcodes in %u streams (seed %u) match the reference handlers\n",
+           (unsigned long long)checked, covered, streams, seed);
+    if (covered < 256)
+    {
+        fprintf(stderr, "conform: only %d of the 256 opcodes ran; use more streams\n", covered);
+        return 1;
+    }
+    return 0;
+}
+
+// Plant one of the fast core's superinstruction pairs at pc in both memories,
+// keeping the random operands after it
+static void plant_fused_pair(uint16_t pc, uint32_t* state)
+{
+    static const uint8_t dcr[] = {0x05, 0x0d, 0x15, 0x1d, 0x25, 0x2d, 0x3d};
+    uint32_t r = next_random(state);
+    uint8_t pair[3];
+    int length = 2;
+
+    switch (r % 4)
+    {
+        case 0: // DCR r / JNZ
+            pair[0] = dcr[(r >> 8) % sizeof(dcr)];
+            pair[1] = 0xc2;
+            break;
+        case 1: // CPI / JZ or JNZ
+            pair[0] = 0xfe;
+            pair[1] = test_memory[(uint16_t)(pc + 1)];
+            pair[2] = r & 0x100 ? 0xca : 0xc2;
+            length = 3;
+            break;
+        case 2: // MOV A,M / INX H
+            pair[0] = 0x7e;
+            pair[1] = 0x23;
+            break;
+        default: // LDAX D / STAX B
+            pair[0] = 0x1a;
+            pair[1] = 0x02;
+            break;
+    }
+    for (int i = 0; i < length; i++)
+    {
+        test_memory[(uint16_t)(pc + i)] = reference_memory[(uint16_t)(pc + i)] = pair[i];
+    }
+    memory_mark_all_dirty();
+}
+
+static bool same_lockstep_state(const intel8080_t* test, const intel8080_t* reference)
+{
+    return memcmp(&test->registers, &reference->registers, sizeof(registers_t)) == 0 &&
+           test->cycles == reference->cycles && test->halted == reference->halted &&
+           test->ei_delay == reference->ei_delay && memcmp(test->memory, reference->memory, sizeof(test_memory)) == 0;
+}
+
+int run_lockstep(uint32_t streams, uint32_t seed, bool fusion)
+{
+    static intel8080_t test;
+    static intel8080_t reference;
+    uint32_t state = seed ? seed : 1;
+    uint64_t dispatches = 0;
+    uint64_t fused = 0;
+    bool was_fusion = i8080_get_fusion();
+
+    i8080_set_fusion(fusion);
+    for (uint32_t stream = 0; stream < streams; stream++)
+    {
+        random_machines(&test, &reference, &state);
+
+        for (uint32_t step = 0; step < CONFORM_STREAM_STEPS && !test.halted; step++)
+        {
+            uint16_t pc = test.registers.pc;
+            if (fusion && (next_random(&state) & 7) == 0)
+            {
+                plant_fused_pair(pc, &state);
+            }
+            uint8_t op_code = test_memory[pc];
+            intel8080_t before = test;
+
+            // One dispatch of the fast core, then the table core up to the same
+            // T-state, which takes two instructions after a fused pair
+            i8080_run_fast(&test, 1);
+            while (reference.cycles < test.cycles && !reference.halted)
+            {
+                i8080_cycle(&reference);
+            }
+
+            dispatches++;
+            if (!same_lockstep_state(&test, &reference))
+            {
+                fprintf(stderr, "lockstep: opcode %02X at %04X differs (seed %u, stream %u, step %u, fusion %s)\n",
+                        op_code, pc, seed, stream, step, fusion ? "on" : "off");
+                report("before", &before);
+                report("fast", &test);
+                report("table", &reference);
+                i8080_set_fusion(was_fusion);
+                return 1;
+            }
+        }
+        fused += test.fused;
+    }
+    i8080_set_fusion(was_fusion);
+
+    printf("lockstep: %llu fast core dispatches (%llu fused pairs) in %u streams (seed %u) match the table core\n",
+           (unsigned long long)dispatches, (unsigned long long)fused, streams, seed);
+    return 0;
+}
+
+// EI program for run_interrupt_checks(): EI, two NOPs, DI, then a tight loop
+static const uint8_t interrupt_program[] = {0xfb, 0x00, 0x00, 0xf3, 0xc3, 0x04, 0x00};
+
+#define INTERRUPT_RST 7
+#define INTERRUPT_STACK 0x8000
+
+// Run the CPU for the given T-states on one core: whole instructions through
+// i8080_cycle(), or one batch of i8080_run() or i8080_run_fast()
+static void run_core(intel8080_t* cpu, int core, uint32_t tstates)
+{
+    switch (core)
+    {
+        case 0:
+            for (uint32_t executed = 0; executed < tstates;)
+            {
+                executed += i8080_cycle(cpu);
+            }
+            break;
+        case 1:
+            i8080_run(cpu, tstates);
+            break;
+        default:
+            i8080_run_fast(cpu, tstates);
+            break;
+    }
+}
+
+static void reset_interrupt_program(intel8080_t* cpu)
+{
+    i8080_reset(cpu, test_memory);
+    memset(test_memory, 0, sizeof(test_memory));
+    memcpy(test_memory, interrupt_program, sizeof(interrupt_program));
+    memory_mark_all_dirty();
+    cpu->registers.sp = INTERRUPT_STACK;
+}
+
+static bool check_interrupt_taken(const char* core, const char* check, const intel8080_t* cpu, uint16_t return_pc)
+{
+    uint16_t pushed = (uint16_t)(test_memory[INTERRUPT_STACK - 2] | (test_memory[INTERRUPT_STACK - 1] << 8));
+
+    if (cpu->registers.pc == INTERRUPT_RST * 8 && cpu->registers.sp == INTERRUPT_STACK - 2 && pushed == return_pc &&
+        !(cpu->registers.flags & FLAGS_IF))
+    {
+        return true;
+    }
+    fprintf(stderr, "interrupts: %s core, %s: PC %04X SP %04X return %04X, expected RST %d from %04X\n", core, check,
+            cpu->registers.pc, cpu->registers.sp, pushed, INTERRUPT_RST, return_pc);
+    return false;
+}
+
+int run_interrupt_checks(void)
+{
+    static const char* const core_names[] = {"step", "table", "fast"};
+    static intel8080_t cpu;
+
+    for (int core = 0; core < 3; core++)
+    {
+        // EI holds an interrupt off for exactly one instruction
+        reset_interrupt_program(&cpu);
+        run_core(&cpu, core, CYCLES_EI);
+        i8080_request_interrupt(&cpu, INTERRUPT_RST);
+        run_core(&cpu, core, 1);
+        if (cpu.registers.pc != 2)
+        {
+            fprintf(stderr, "interrupts: %s core took the interrupt before the instruction after EI\n",
+                    core_names[core]);
+            return 1;
+        }
+        run_core(&cpu, core, 1);
+        if (!check_interrupt_taken(core_names[core], "right after EI", &cpu, 2))
+        {
+            return 1;
+        }
+
+        // Once that instruction has run, an interrupt raised later is taken
+        // before the next one, here the DI that would otherwise lose it
+        reset_interrupt_program(&cpu);
+        run_core(&cpu, core, CYCLES_EI + 2 * CYCLES_NOP);
+        i8080_request_interrupt(&cpu, INTERRUPT_RST);
+        run_core(&cpu, core, 1);
+        if (!check_interrupt_taken(core_names[core], "raised before DI", &cpu, 3))
+        {
+            return 1;
+        }
+    }
+
+    printf("interrupts: EI delay and acknowledge match on the step, table and fast cores\n");
+    return 0;
+}
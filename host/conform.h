@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Conformance test for the table-driven core's specialised handlers.
+//
+// Runs the given number of random instruction streams, each of
+// CONFORM_STREAM_STEPS steps from random memory and registers generated from
+// seed, through i8080_cycle() and through the generic handlers the table core
+// had before they were specialised per encoding (conform_reference.c). Every
+// opcode is compared, the undocumented ones included. After every step the
+// registers, flags, T-states, address and data bus, status byte, HLT and EI
+// state and all 64 KB of memory must match. Each stream then runs again as a
+// single i8080_run() batch, which with I8080_LAZY_FLAGS carries deferred
+// flags between instructions, and must end in the same state. No ports are
+// registered in this mode, so IN reads 0x00.
+//
+// Returns 0 when every step matched and all 256 opcodes ran, 1 otherwise (a
+// difference is described on stderr).
+#define CONFORM_STREAM_STEPS 64
+
+int run_conformance(uint32_t streams, uint32_t seed);
+
+// Lockstep test of i8080_run_fast() against the table core.
+//
+// Runs the given number of random instruction streams, generated as for
+// run_conformance(), one dispatch of the fast core at a time, with the table
+// core stepped through i8080_cycle() to the same T-state after each. The
+// registers, T-states, HLT and EI state and memory must then match; the bus
+// and status fields are not compared, as the fast core leaves them showing
+// the next fetch. With fusion on, one step in eight first plants a
+// superinstruction pair at PC, so each fused dispatch is checked against the
+// two instructions it replaces.
+//
+// Returns 0 when every dispatch matched, 1 at the first difference
+// (described on stderr).
+int run_lockstep(uint32_t streams, uint32_t seed, bool fusion);
+
+// Interrupt acknowledge around EI on the i8080_cycle(), i8080_run() and
+// i8080_run_fast() cores: an interrupt raised straight after EI waits for one
+// more instruction, and one raised after that instruction is taken before the
+// next, even when EI finished several instructions or batches earlier.
+//
+// Returns 0 when every core behaves, 1 otherwise (described on stderr).
+int run_interrupt_checks(void);
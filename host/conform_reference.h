@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Altair8800/intel8080.h"
+
+#include <stdint.h>
+
+// Fetch and execute one instruction of cpu on machine_memory with the
+// reference handlers (conform_reference.c), adding its T-states to
+// cpu->cycles. Returns the T-states.
+uint8_t conform_reference_cycle(intel8080_t *cpu, uint8_t *machine_memory);
@@ -0,0 +1,434 @@
+// Breakpoint and watchpoint checks for I8080_BREAKPOINTS builds (debugger_checks.h)
+#include "debugger_checks.h"
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+
+#include "Altair8800/debugger.h"
+#include "Altair8800/intel8080.h"
+#include "Altair8800/memory.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// A trial ends when no hit comes within this many T-states
+#define HIT_TSTATES 2000000ULL
+
+static uint8_t debugger_memory[64 * 1024];
+static uint8_t reference_memory[64 * 1024];
+
+// The reference's own copy of what is set
+static bool reference_set[DEBUGGER_KINDS][64 * 1024];
+static bool reference_resume;
+static uint16_t reference_resume_pc;
+
+// xorshift32
+static uint32_t random_state;
+
+static uint32_t next_random(void)
+{
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return random_state = x;
+}
+
+static void set_point(debugger_kind_t kind, uint16_t address, uint32_t length, bool enable)
+{
+    debugger_set(kind, address, length, enable);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        reference_set[kind][(uint16_t)(address + i)] = enable;
+    }
+    if (kind == DEBUGGER_BREAKPOINT && !enable)
+    {
+        reference_resume = false;
+    }
+}
+
+static void clear_points(debugger_kind_t kind)
+{
+    debugger_clear(kind);
+    memset(reference_set[kind], 0, sizeof(reference_set[kind]));
+    if (kind == DEBUGGER_BREAKPOINT)
+    {
+        reference_resume = false;
+    }
+}
+
+static bool condition(uint8_t flags, uint8_t op_code)
+{
+    switch ((op_code >> 3) & 7)
+    {
+        case 0:
+            return !(flags & FLAGS_ZERO);
+        case 1:
+            return flags & FLAGS_ZERO;
+        case 2:
+            return !(flags & FLAGS_CARRY);
+        case 3:
+            return flags & FLAGS_CARRY;
+        case 4:
+            return !(flags & FLAGS_PARITY);
+        case 5:
+            return flags & FLAGS_PARITY;
+        case 6:
+            return !(flags & FLAGS_SIGN);
+        default:
+            return flags & FLAGS_SIGN;
+    }
+}
+
+// Data bytes the instruction at PC reads and writes, from the 8080 manual's
+// description of each opcode
+static void reference_access(const intel8080_t* c, uint16_t* address, int* length, bool* reads, bool* writes)
+{
+    const registers_t* r = &c->registers;
+    uint8_t op = c->memory[r->pc];
+    uint16_t direct = (uint16_t)(c->memory[(uint16_t)(r->pc + 1)] | (c->memory[(uint16_t)(r->pc + 2)] << 8));
+    uint8_t low = op & 7;
+
+    *length = 0;
+    *reads = *writes = false;
+
+    if (op == 0x02 || op == 0x12 || op == 0x0a || op == 0x1a) // STAX, LDAX
+    {
+        *address = op & 0x10 ? r->de : r->bc;
+        *length = 1;
+        *writes = !(op & 0x08);
+        *reads = op & 0x08;
+    }
+    else if (op == 0x22 || op == 0x2a || op == 0x32 || op == 0x3a) // SHLD, LHLD, STA, LDA
+    {
+        *address = direct;
+        *length = op & 0x10 ? 1 : 2;
+        *writes = !(op & 0x08);
+        *reads = op & 0x08;
+    }
+    else if (op == 0x34 || op == 0x35) // INR M, DCR M
+    {
+        *address = r->hl;
+        *length = 1;
+        *reads = *writes = true;
+    }
+    else if (op == 0x36 || (op >= 0x70 && op <= 0x77 && op != 0x76)) // MVI M, MOV M,r
+    {
+        *address = r->hl;
+        *length = 1;
+        *writes = true;
+    }
+    else if ((op >= 0x40 && op <= 0xbf && low == 6 && op != 0x76)) // MOV r,M, ALU M
+    {
+        *address = r->hl;
+        *length = 1;
+        *reads = true;
+    }
+    else if (op == 0xe3) // XTHL
+    {
+        *address = r->sp;
+        *length = 2;
+        *reads = *writes = true;
+    }
+    else if ((op >= 0xc0 && low == 5) || (op >= 0xc0 && low == 7) || op == 0xcd || op == 0xdd || op == 0xed ||
+             op == 0xfd || (op >= 0xc0 && low == 4 && condition(r->flags, op))) // PUSH, RST, CALL, taken Ccc
+    {
+        *address = (uint16_t)(r->sp - 2);
+        *length = 2;
+        *writes = true;
+    }
+    else if ((op >= 0xc0 && low == 1 && op != 0xc9 && op != 0xd9 && op != 0xe9 && op != 0xf9) || op == 0xc9 ||
+             op == 0xd9 || (op >= 0xc0 && low == 0 && condition(r->flags, op))) // POP, RET, taken Rcc
+    {
+        *address = r->sp;
+        *length = 2;
+        *reads = true;
+    }
+}
+
+// A breakpoint at PC stops before the instruction, except when resuming from
+// that same breakpoint
+static bool reference_breakpoint(const intel8080_t* c, debugger_hit_t* hit)
+{
+    uint16_t pc = c->registers.pc;
+
+    if (reference_set[DEBUGGER_BREAKPOINT][pc] && !(reference_resume && reference_resume_pc == pc))
+    {
+        *hit = (debugger_hit_t){DEBUGGER_BREAKPOINT, pc, pc};
+        reference_resume = true;
+        reference_resume_pc = pc;
+        return true;
+    }
+    return false;
+}
+
+// Run to the next hit checking every instruction, as debugger_run() must
+// behave; stop without a hit once the CPU has reached limit T-states
+static bool reference_run(intel8080_t* c, uint64_t limit, debugger_hit_t* hit)
+{
+    // Decoded instructions from the other memory are not this one's
+    memory_mark_all_dirty();
+
+    while (c->cycles < limit)
+    {
+        uint16_t pc = c->registers.pc;
+
+        // Random code can store an HLT in its own path, and with no
+        // interrupts it idles there for the rest of the run
+        if (c->halted)
+        {
+            c->cycles = limit;
+            break;
+        }
+
+        if (reference_breakpoint(c, hit))
+        {
+            return true;
+        }
+        reference_resume = false;
+
+        uint16_t address = 0;
+        int length;
+        bool reads, writes;
+        reference_access(c, &address, &length, &reads, &writes);
+        i8080_cycle(c);
+
+        for (int i = 0; i < length; i++)
+        {
+            uint16_t a = (uint16_t)(address + i);
+            if (writes && reference_set[DEBUGGER_WATCH_WRITE][a])
+            {
+                *hit = (debugger_hit_t){DEBUGGER_WATCH_WRITE, pc, a};
+                return true;
+            }
+            if (reads && reference_set[DEBUGGER_WATCH_READ][a])
+            {
+                *hit = (debugger_hit_t){DEBUGGER_WATCH_READ, pc, a};
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool debugger_run_to_hit(intel8080_t* c, uint32_t budget, uint64_t limit, debugger_hit_t* hit)
+{
+    memory_mark_all_dirty();
+
+    while (c->cycles < limit)
+    {
+        debugger_run(c, budget);
+        if (debugger_take_hit(hit))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static const char* const kind_names[DEBUGGER_KINDS] = {"breakpoint", "watch read", "watch write"};
+
+static int run_trials(uint32_t trials)
+{
+    static intel8080_t test;
+    static intel8080_t reference;
+    long hits = 0;
+
+    for (uint32_t trial = 0; trial < trials; trial++)
+    {
+        i8080_reset(&test, debugger_memory);
+        for (size_t i = 0; i < sizeof(debugger_memory); i++)
+        {
+            uint32_t r = next_random();
+            uint8_t op = (r & 3) ? (uint8_t)(r >> 8) : 0x00;
+
+            // No HLT, IN or OUT: nothing would wake or answer them
+            debugger_memory[i] = (op == 0x76 || op == 0xdb || op == 0xd3) ? 0x00 : op;
+        }
+        memory_mark_all_dirty();
+        test.registers.pc = (uint16_t)next_random();
+        test.registers.sp = (uint16_t)next_random();
+        test.registers.bc = (uint16_t)next_random();
+        test.registers.de = (uint16_t)next_random();
+        test.registers.hl = (uint16_t)next_random();
+        reference = test;
+        reference.memory = reference_memory;
+        memcpy(reference_memory, debugger_memory, sizeof(debugger_memory));
+
+        for (int kind = 0; kind < DEBUGGER_KINDS; kind++)
+        {
+            clear_points((debugger_kind_t)kind);
+        }
+        for (uint32_t n = next_random() % 6; n > 0; n--)
+        {
+            set_point((debugger_kind_t)(next_random() % DEBUGGER_KINDS), (uint16_t)next_random(),
+                      1 + next_random() % 4, true);
+        }
+
+        for (int step = 0; step < DEBUGGER_TRIAL_HITS; step++)
+        {
+            uint32_t budget = 1 + next_random() % 5000;
+            uint64_t limit = test.cycles + HIT_TSTATES;
+            debugger_hit_t test_hit = {0}, reference_hit = {0};
+            bool test_stopped = debugger_run_to_hit(&test, budget, limit, &test_hit);
+            bool reference_stopped = reference_run(&reference, test.cycles, &reference_hit);
+
+            // A breakpoint stops before its instruction runs, so at the
+            // T-state the reference ran to
+            if (test_stopped && !reference_stopped)
+            {
+                reference_stopped = reference_breakpoint(&reference, &reference_hit);
+            }
+
+            if (test_stopped != reference_stopped ||
+                (test_stopped && memcmp(&test_hit, &reference_hit, sizeof(test_hit)) != 0) ||
+                memcmp(&test.registers, &reference.registers, sizeof(registers_t)) != 0 ||
+                test.cycles != reference.cycles ||
+                memcmp(debugger_memory, reference_memory, sizeof(debugger_memory)) != 0)
+            {
+                fprintf(stderr, "debugger: trial %u hit %d differs\n", trial, step);
+                fprintf(stderr, "  debugger  %s at %04X (%04X), PC %04X T %llu\n",
+                        test_stopped ? kind_names[test_hit.kind] : "no hit", test_hit.pc, test_hit.address,
+                        test.registers.pc, (unsigned long long)test.cycles);
+                fprintf(stderr, "  reference %s at %04X (%04X), PC %04X T %llu\n",
+                        reference_stopped ? kind_names[reference_hit.kind] : "no hit", reference_hit.pc,
+                        reference_hit.address, reference.registers.pc, (unsigned long long)reference.cycles);
+                return 1;
+            }
+            if (!test_stopped)
+            {
+                break;
+            }
+            hits++;
+        }
+    }
+
+    printf("debugger: %ld hits in %u random trials match per-instruction checking\n", hits, trials);
+    return 0;
+}
+
+// Run program at 0x0100 with SP at 0x8000 until a hit, which must be kind at
+// address from the instruction at pc
+static bool expect_hit(const char* name, const uint8_t* program, size_t length, debugger_kind_t kind, uint16_t pc,
+                       uint16_t address)
+{
+    static intel8080_t c;
+    debugger_hit_t hit;
+
+    i8080_reset(&c, debugger_memory);
+    memset(debugger_memory, 0, sizeof(debugger_memory));
+    memcpy(&debugger_memory[0x0100], program, length);
+    memory_mark_all_dirty();
+    c.registers.pc = 0x0100;
+    c.registers.sp = 0x8000;
+
+    if (!debugger_run_to_hit(&c, 1000, 100000, &hit))
+    {
+        fprintf(stderr, "debugger: %s: no hit\n", name);
+        return false;
+    }
+    if (hit.kind != kind || hit.pc != pc || hit.address != address)
+    {
+        fprintf(stderr, "debugger: %s: %s at %04X (%04X), expected %s at %04X (%04X)\n", name, kind_names[hit.kind],
+                hit.pc, hit.address, kind_names[kind], pc, address);
+        return false;
+    }
+    return true;
+}
+
+static int run_cases(void)
+{
+    // The undocumented CALL aliases push, and the RET alias pops
+    static const uint8_t call_aliases[][3] = {{0xdd, 0x00, 0x02}, {0xed, 0x00, 0x02}, {0xfd, 0x00, 0x02}};
+    static const uint8_t ret_alias[] = {0xcd, 0x00, 0x02};
+    static const uint8_t jump_loop[] = {0xc3, 0x00, 0x01};
+    static const uint8_t jmp_alias[] = {0xcb, 0x00, 0x03};
+
+    for (int kind = 0; kind < DEBUGGER_KINDS; kind++)
+    {
+        clear_points((debugger_kind_t)kind);
+    }
+
+    set_point(DEBUGGER_WATCH_WRITE, 0x7ffe, 2, true);
+    for (size_t i = 0; i < sizeof(call_aliases) / sizeof(call_aliases[0]); i++)
+    {
+        if (!expect_hit("CALL alias push", call_aliases[i], sizeof(call_aliases[i]), DEBUGGER_WATCH_WRITE, 0x0100,
+                        0x7ffe))
+        {
+            return 1;
+        }
+    }
+    clear_points(DEBUGGER_WATCH_WRITE);
+
+    // CALL 0200h, where 0D9h returns through the watched stack slot
+    set_point(DEBUGGER_WATCH_READ, 0x7ffe, 2, true);
+    {
+        static intel8080_t c;
+        debugger_hit_t hit;
+
+        i8080_reset(&c, debugger_memory);
+        memset(debugger_memory, 0, sizeof(debugger_memory));
+        memcpy(&debugger_memory[0x0100], ret_alias, sizeof(ret_alias));
+        debugger_memory[0x0200] = 0xd9;
+        memory_mark_all_dirty();
+        c.registers.pc = 0x0100;
+        c.registers.sp = 0x8000;
+        if (!debugger_run_to_hit(&c, 1000, 100000, &hit) || hit.kind != DEBUGGER_WATCH_READ || hit.pc != 0x0200 ||
+            hit.address != 0x7ffe || c.registers.pc != 0x0103)
+        {
+            fprintf(stderr, "debugger: RET alias pop: not caught at 0200\n");
+            return 1;
+        }
+    }
+    clear_points(DEBUGGER_WATCH_READ);
+
+    // The JMP alias goes to its target, where a breakpoint stops it
+    set_point(DEBUGGER_BREAKPOINT, 0x0300, 1, true);
+    if (!expect_hit("JMP alias", jmp_alias, sizeof(jmp_alias), DEBUGGER_BREAKPOINT, 0x0300, 0x0300))
+    {
+        return 1;
+    }
+    clear_points(DEBUGGER_BREAKPOINT);
+
+    // A breakpoint cleared and set again at the PC it last stopped at must
+    // stop there again rather than be stepped over as a resume
+    {
+        static intel8080_t c;
+        debugger_hit_t hit;
+
+        set_point(DEBUGGER_BREAKPOINT, 0x0100, 1, true);
+        i8080_reset(&c, debugger_memory);
+        memset(debugger_memory, 0, sizeof(debugger_memory));
+        memcpy(&debugger_memory[0x0100], jump_loop, sizeof(jump_loop));
+        memory_mark_all_dirty();
+        c.registers.pc = 0x0100;
+        if (!debugger_run_to_hit(&c, 1000, 100000, &hit))
+        {
+            fprintf(stderr, "debugger: breakpoint: no hit\n");
+            return 1;
+        }
+        clear_points(DEBUGGER_BREAKPOINT);
+        set_point(DEBUGGER_BREAKPOINT, 0x0100, 1, true);
+        debugger_run(&c, 1000);
+        if (!debugger_take_hit(&hit) || c.registers.pc != 0x0100 || c.cycles != 0)
+        {
+            fprintf(stderr, "debugger: breakpoint set again after BC was stepped over\n");
+            return 1;
+        }
+        clear_points(DEBUGGER_BREAKPOINT);
+    }
+
+    printf("debugger: CALL, RET and JMP aliases and breakpoint resume after clearing behave\n");
+    return 0;
+}
+
+int run_debugger_checks(uint32_t trials, uint32_t seed)
+{
+    random_state = seed != 0 ? seed : 1;
+    if (run_cases() != 0)
+    {
+        return 1;
+    }
+    return run_trials(trials);
+}
+
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#if defined(I8080_BREAKPOINTS) && I8080_BREAKPOINTS
+
+// Check of debugger_run() against a debugger that checks every instruction.
+//
+// debugger_run() hands most instructions to the guarded threaded core and
+// decodes only those near a breakpoint or a watched page. Each of the given
+// number of trials fills memory with random code and registers from seed,
+// sets a few random breakpoints and watchpoints, and runs to the next hit up
+// to DEBUGGER_TRIAL_HITS times with random budgets. A reference that steps
+// i8080_cycle() and decodes every instruction's data accesses on its own
+// must report the same hits and reach the same registers, T-states and
+// memory. The code has no IN or OUT, nor HLT but what it stores itself,
+// which idles to the end of the trial. Fixed cases first cover the
+// undocumented CALL, RET and JMP aliases and a breakpoint set again after
+// debugger_clear() at the PC it last stopped at.
+//
+// Returns 0 when everything matched, 1 otherwise (described on stderr).
+#define DEBUGGER_TRIAL_HITS 200
+
+int run_debugger_checks(uint32_t trials, uint32_t seed);
+
+#endif
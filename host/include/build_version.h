@@ -0,0 +1,10 @@
+// Host builds are not versioned
+#ifndef BUILD_VERSION_H
+#define BUILD_VERSION_H
+
+#define BUILD_VERSION 0
+#define BUILD_DATE __DATE__
+#define BUILD_TIME __TIME__
+#define BUILD_DATETIME __DATE__ " " __TIME__
+
+#endif // BUILD_VERSION_H
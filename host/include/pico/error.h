@@ -0,0 +1,6 @@
+// Host stand-in for the Pico SDK's pico/error.h
+#pragma once
+
+#define PICO_OK 0
+#define PICO_ERROR_TIMEOUT (-1)
+#define PICO_ERROR_NO_DATA (-3)
@@ -0,0 +1,6 @@
+// Host stand-in for the Pico SDK's pico/rand.h
+#pragma once
+
+#include <stdint.h>
+
+uint32_t get_rand_32(void);
@@ -0,0 +1,18 @@
+// Host stand-in for the Pico SDK's pico/stdio_usb.h: the CDC driver writes
+// each out_chars() call to stdout as its own write, as the device sends each
+// as its own packet, and has no input
+#pragma once
+
+#include <stdint.h>
+
+typedef struct stdio_driver
+{
+    void (*out_chars)(const char* buf, int len);
+    int (*in_chars)(char* buf, int len);
+} stdio_driver_t;
+
+extern stdio_driver_t stdio_usb;
+
+// Host only: out_chars() calls and the bytes they carried
+extern uint64_t stdio_usb_out_calls;
+extern uint64_t stdio_usb_out_bytes;
@@ -0,0 +1,16 @@
+// Host stand-in for the Pico SDK's pico/stdlib.h: only what the emulator core
+// and port drivers use.
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "pico/error.h"
+#include "pico/time.h"
+
+static inline void tight_loop_contents(void)
+{
+}
+
+int getchar_timeout_us(uint32_t timeout_us);
@@ -0,0 +1,8 @@
+// Host stand-in for the Pico SDK's pico/util/queue.h. Only the type is
+// needed: the HTTP port driver compiles to stubs without WiFi.
+#pragma once
+
+typedef struct
+{
+    int unused;
+} queue_t;
@@ -0,0 +1,59 @@
+// Host stand-in for pico-ws-server's WebSocketServer. There is no network:
+// a test plays the clients, connecting them, delivering their messages and
+// collecting what ws.cpp sends them, and can make a client's send buffer
+// refuse messages as a full TCP send buffer does.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+class WebSocketServer
+{
+  public:
+    typedef void (*ConnectCallback)(WebSocketServer& server, uint32_t conn_id);
+    typedef void (*MessageCallback)(WebSocketServer& server, uint32_t conn_id, const void* data, size_t len);
+
+    explicit WebSocketServer(uint32_t max_connections);
+    ~WebSocketServer();
+
+    void setConnectCallback(ConnectCallback callback);
+    void setCloseCallback(ConnectCallback callback);
+    void setMessageCallback(MessageCallback callback);
+    void setPongCallback(MessageCallback callback);
+    void setCallbackExtra(void* extra);
+    void* getCallbackExtra();
+    void setTcpNoDelay(bool enabled);
+
+    bool startListening(uint16_t port);
+    void popMessages();
+    bool sendMessage(uint32_t conn_id, const void* payload, size_t payload_size);
+    bool sendPing(uint32_t conn_id, const void* payload, size_t payload_size);
+    bool close(uint32_t conn_id);
+
+    // Host only: the test's side of the connections
+    static WebSocketServer* instance(); // The last one constructed
+    void clientConnect(uint32_t conn_id);
+    void clientSend(uint32_t conn_id, const void* data, size_t len);
+    void clientClose(uint32_t conn_id);
+    void clientRefuse(uint32_t conn_id, bool refuse); // Its sends fail while set
+    bool clientReceive(uint32_t conn_id, std::vector<uint8_t>* message); // Oldest message sent to it
+    bool clientClosed(uint32_t conn_id);
+
+  private:
+    struct Client
+    {
+        bool refuse = false;
+        bool closed = false;
+        std::deque<std::vector<uint8_t>> received;
+    };
+
+    ConnectCallback connect_callback_ = nullptr;
+    ConnectCallback close_callback_ = nullptr;
+    MessageCallback message_callback_ = nullptr;
+    MessageCallback pong_callback_ = nullptr;
+    void* extra_ = nullptr;
+    std::map<uint32_t, Client> clients_;
+};
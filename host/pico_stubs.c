@@ -0,0 +1,96 @@
+// Host implementations of the Pico SDK and console calls the emulator core
+// and port drivers link against.
+#include "pico/rand.h"
+#include "pico/stdlib.h"
+#include "pico/stdio_usb.h"
+#include "websocket_console.h"
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+uint64_t time_us_64(void)
+{
+    static uint64_t start_us = 0;
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t now_us = (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+    if (start_us == 0)
+    {
+        start_us = now_us;
+    }
+    return now_us - start_us;
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void* user_data, bool fire_if_past)
+{
+    (void)ms;
+    (void)callback;
+    (void)user_data;
+    (void)fire_if_past;
+    return 0; // No alarm scheduled
+}
+
+bool cancel_alarm(alarm_id_t alarm_id)
+{
+    (void)alarm_id;
+    return false;
+}
+
+uint32_t get_rand_32(void)
+{
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+int getchar_timeout_us(uint32_t timeout_us)
+{
+    (void)timeout_us;
+    return PICO_ERROR_TIMEOUT;
+}
+
+// CPU monitor output (publish_message) goes to stdout
+void websocket_console_enqueue_bytes(const uint8_t* data, size_t length)
+{
+    fwrite(data, 1, length, stdout);
+}
+
+void websocket_console_enqueue_output(uint8_t value)
+{
+    putchar(value);
+}
+
+// The console copy above is the only one shown
+void websocket_console_enqueue_monitor(const uint8_t* data, size_t length)
+{
+    (void)data;
+    (void)length;
+}
+
+uint64_t stdio_usb_out_calls;
+uint64_t stdio_usb_out_bytes;
+
+static void stdio_usb_out_chars(const char* buf, int len)
+{
+    stdio_usb_out_calls++;
+    stdio_usb_out_bytes += (uint64_t)len;
+    while (len > 0)
+    {
+        ssize_t written = write(STDOUT_FILENO, buf, (size_t)len);
+        if (written <= 0)
+        {
+            break;
+        }
+        buf += written;
+        len -= (int)written;
+    }
+}
+
+static int stdio_usb_in_chars(char* buf, int len)
+{
+    (void)buf;
+    (void)len;
+    return PICO_ERROR_NO_DATA;
+}
+
+stdio_driver_t stdio_usb = {stdio_usb_out_chars, stdio_usb_in_chars};
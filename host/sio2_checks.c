@@ -0,0 +1,177 @@
+// 88-2SIO transmit checks (sio2_checks.h)
+#include "sio2_checks.h"
+
+#include "Altair8800/intel8080.h"
+#include "Altair8800/memory.h"
+#include "PortDrivers/sio2_io.h"
+#include "io_ports.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SIO2_CHECK_CHANNEL 1 // Ports 12h-13h
+#define SIO2_CHECK_STATUS_PORT 0x12
+#define SIO2_CHECK_DATA_ADDRESS 0x1000
+#define SIO2_CHECK_SLICE 500
+#define SIO2_CHECK_SLICES 100000
+#define SIO2_CHECK_RUN_LENGTH 3
+
+// Send SIO2_CHECK_BYTES bytes from 1000h on channel 2, waiting for TDRE
+static const uint8_t transmit_program[] = {
+    0x21, 0x00, 0x10,                                     //       LXI  H,1000h
+    0x11, SIO2_CHECK_BYTES & 0xff, SIO2_CHECK_BYTES >> 8, //       LXI  D,SIO2_CHECK_BYTES
+    0xDB, 0x12,                                           // WAIT: IN   12h
+    0xE6, 0x02,                                           //       ANI  2         ; TDRE
+    0xCA, 0x06, 0x00,                                     //       JZ   WAIT
+    0x7E,                                                 //       MOV  A,M
+    0xD3, 0x13,                                           //       OUT  13h
+    0x23,                                                 //       INX  H
+    0x1B,                                                 //       DCX  D
+    0x7A,                                                 //       MOV  A,D
+    0xB3,                                                 //       ORA  E
+    0xC2, 0x06, 0x00,                                     //       JNZ  WAIT
+    0x76,                                                 //       HLT
+};
+
+static intel8080_t machine;
+static uint8_t machine_memory[64 * 1024];
+
+static uint8_t received[SIO2_CHECK_BYTES + SIO2_CHECK_RUN_LENGTH];
+static size_t received_count;
+static bool backend_stalled;
+
+static size_t check_read(uint8_t* buffer, size_t max_len)
+{
+    (void)buffer;
+    (void)max_len;
+    return 0;
+}
+
+// Takes at most SIO2_CHECK_RUN_LENGTH bytes a call, and none while stalled
+static size_t check_write(const uint8_t* data, size_t length)
+{
+    if (backend_stalled)
+    {
+        return 0;
+    }
+    if (length > SIO2_CHECK_RUN_LENGTH)
+    {
+        length = SIO2_CHECK_RUN_LENGTH;
+    }
+    if (length > sizeof(received) - received_count)
+    {
+        length = sizeof(received) - received_count;
+    }
+    memcpy(&received[received_count], data, length);
+    received_count += length;
+    return length;
+}
+
+static const sio2_backend_t check_backend = {check_read, check_write, NULL};
+
+static uint8_t expected_byte(size_t i)
+{
+    return (uint8_t)(i * 7 + 3);
+}
+
+static void load_program(void)
+{
+    i8080_reset(&machine, machine_memory);
+    memset(machine_memory, 0, sizeof(machine_memory));
+    memcpy(machine_memory, transmit_program, sizeof(transmit_program));
+    for (size_t i = 0; i < SIO2_CHECK_BYTES; i++)
+    {
+        machine_memory[SIO2_CHECK_DATA_ADDRESS + i] = expected_byte(i);
+    }
+    memory_mark_all_dirty();
+
+    sio2_io_init(&machine);
+    sio2_attach(SIO2_CHECK_CHANNEL, &check_backend);
+    received_count = 0;
+    backend_stalled = false;
+}
+
+// Run slices as the main loop does, flushing after each, until the program
+// has halted and its output has all arrived
+static void run_slices(uint32_t slices)
+{
+    for (uint32_t i = 0; i < slices && !(machine.halted && received_count == SIO2_CHECK_BYTES); i++)
+    {
+        machine.console_idle = false;
+        i8080_run_fast(&machine, SIO2_CHECK_SLICE);
+        sio2_flush();
+    }
+}
+
+static bool check_received(const char* name)
+{
+    sio2_stats_t stats;
+    sio2_get_stats(SIO2_CHECK_CHANNEL, &stats);
+
+    if (!machine.halted)
+    {
+        fprintf(stderr, "sio2: %s: program still waiting after %zu bytes\n", name, received_count);
+        return false;
+    }
+    if (received_count != SIO2_CHECK_BYTES || stats.tx_dropped != 0 || stats.tx_bytes != SIO2_CHECK_BYTES)
+    {
+        fprintf(stderr, "sio2: %s: received %zu, counted %llu, dropped %u of %d\n", name, received_count,
+                (unsigned long long)stats.tx_bytes, stats.tx_dropped, SIO2_CHECK_BYTES);
+        return false;
+    }
+    for (size_t i = 0; i < received_count; i++)
+    {
+        if (received[i] != expected_byte(i))
+        {
+            fprintf(stderr, "sio2: %s: byte %zu is %02X, expected %02X\n", name, i, received[i], expected_byte(i));
+            return false;
+        }
+    }
+    return true;
+}
+
+int run_sio2_checks(void)
+{
+    // Short backend writes
+    load_program();
+    run_slices(SIO2_CHECK_SLICES);
+    if (!check_received("short writes"))
+    {
+        return 1;
+    }
+
+    // A backend that takes nothing holds the program at TDRE
+    load_program();
+    backend_stalled = true;
+    run_slices(100);
+    uint16_t stalled_pc = machine.registers.pc;
+    if (machine.halted || received_count != 0 || (io_port_in(SIO2_CHECK_STATUS_PORT) & SIO2_STATUS_TDRE) ||
+        stalled_pc < 0x0006 || stalled_pc > 0x000d)
+    {
+        fprintf(stderr, "sio2: stalled backend: TDRE high or program past the wait loop (PC %04X)\n", stalled_pc);
+        return 1;
+    }
+    backend_stalled = false;
+    run_slices(SIO2_CHECK_SLICES);
+    if (!check_received("stalled backend"))
+    {
+        return 1;
+    }
+
+    // Pacing deadlines do not outlive a machine reset
+    load_program();
+    sio2_set_baud(SIO2_CHECK_CHANNEL, 9600);
+    run_slices(200);
+    i8080_reset(&machine, machine_memory);
+    sio2_reset();
+    if (!(io_port_in(SIO2_CHECK_STATUS_PORT) & SIO2_STATUS_TDRE))
+    {
+        fprintf(stderr, "sio2: TDRE low after a reset\n");
+        return 1;
+    }
+    sio2_set_baud(SIO2_CHECK_CHANNEL, 0);
+
+    printf("sio2: %d bytes in order through %d-byte backend writes and a stalled backend, TDRE after reset\n",
+           SIO2_CHECK_BYTES, SIO2_CHECK_RUN_LENGTH);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+// 88-2SIO transmit path (PortDrivers/sio2_io.c) under a backend that takes
+// only a few bytes per write or none at all.
+//
+// A program writes SIO2_CHECK_BYTES bytes to channel 2, polling TDRE before
+// each. With a backend that takes at most three bytes per call every byte
+// must arrive in order with none dropped. With a backend that takes nothing,
+// TDRE must read low once the FIFO is full and the program must wait there
+// without losing a byte, then finish in order once the backend takes them. A
+// paced channel must also show TDRE straight after sio2_reset() following
+// i8080_reset(), however far cpu->cycles had run.
+//
+// Returns 0 when the channel behaves, 1 otherwise (described on stderr).
+#define SIO2_CHECK_BYTES 1000
+
+int run_sio2_checks(void);
@@ -0,0 +1,71 @@
+// Host snapshot backend: a plain file, named by altair_host --save/--restore
+#include "snapshot.h"
+
+#include <stdio.h>
+
+const char* snapshot_file_path = "altair.snap";
+
+static FILE* snapshot_file;
+
+bool snapshot_storage_begin_write(void)
+{
+    snapshot_header_t header = {0};
+
+    snapshot_file = fopen(snapshot_file_path, "wb");
+    if (!snapshot_file)
+    {
+        return false;
+    }
+    if (fwrite(&header, sizeof(header), 1, snapshot_file) != 1)
+    {
+        fclose(snapshot_file);
+        return false;
+    }
+    return true;
+}
+
+bool snapshot_storage_write(const uint8_t* data, size_t length)
+{
+    if (fwrite(data, 1, length, snapshot_file) != length)
+    {
+        fclose(snapshot_file);
+        return false;
+    }
+    return true;
+}
+
+bool snapshot_storage_finish_write(const snapshot_header_t* header)
+{
+    bool ok = fseek(snapshot_file, 0, SEEK_SET) == 0 && fwrite(header, sizeof(*header), 1, snapshot_file) == 1;
+    return fclose(snapshot_file) == 0 && ok;
+}
+
+bool snapshot_storage_begin_read(snapshot_header_t* header)
+{
+    snapshot_file = fopen(snapshot_file_path, "rb");
+    if (!snapshot_file)
+    {
+        return false;
+    }
+    if (fread(header, sizeof(*header), 1, snapshot_file) != 1)
+    {
+        fclose(snapshot_file);
+        return false;
+    }
+    return true;
+}
+
+bool snapshot_storage_read(uint8_t* data, size_t length)
+{
+    return fread(data, 1, length, snapshot_file) == length;
+}
+
+void snapshot_storage_end_read(void)
+{
+    fclose(snapshot_file);
+}
+
+bool snapshot_storage_erase(void)
+{
+    return remove(snapshot_file_path) == 0;
+}
@@ -0,0 +1,230 @@
+// Console screen model checks (vt_screen_checks.h)
+#include "vt_screen_checks.h"
+
+#include "vt_screen.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Room for any repaint: every cell with its own SGR and cursor move
+#define VT_CHECK_OUTPUT_MAX (VT_SCREEN_ROWS * VT_SCREEN_COLS * 24)
+
+static uint8_t stream[VT_SCREEN_CHECK_STREAM_MAX + 32];
+static uint8_t output[VT_CHECK_OUTPUT_MAX];
+
+// xorshift32
+static uint32_t random_state;
+
+static uint32_t next_random(void)
+{
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return random_state = x;
+}
+
+static size_t append(size_t length, const char* text)
+{
+    size_t count = strlen(text);
+    memcpy(&stream[length], text, count);
+    return length + count;
+}
+
+static size_t append_number(size_t length, uint32_t value)
+{
+    char text[12];
+    snprintf(text, sizeof(text), "%u", value);
+    return append(length, text);
+}
+
+// CSI with up to three parameters, mostly near the screen size
+static size_t append_csi(size_t length)
+{
+    static const char finals[] = "ABCDGHJKLMPX@dfmrsu";
+
+    length = append(length, "\x1b[");
+    if (next_random() % 8 == 0)
+    {
+        length = append(length, "?");
+    }
+    for (uint32_t n = next_random() % 4, i = 0; i < n; i++)
+    {
+        if (i > 0)
+        {
+            length = append(length, ";");
+        }
+        uint32_t r = next_random();
+        if (r % 4 != 0)
+        {
+            length = append_number(length, r % 8 == 1 ? (r >> 8) % 10000 : (r >> 8) % 30);
+        }
+    }
+    stream[length++] = (uint8_t)finals[next_random() % (sizeof(finals) - 1)];
+    return length;
+}
+
+// SGR with the codes the model keeps and some it ignores
+static size_t append_sgr(size_t length)
+{
+    static const uint8_t codes[] = {0, 1, 4, 5, 7, 22, 24, 25, 27, 31, 42, 39, 49};
+
+    length = append(length, "\x1b[");
+    for (uint32_t n = 1 + next_random() % 3, i = 0; i < n; i++)
+    {
+        if (i > 0)
+        {
+            length = append(length, ";");
+        }
+        length = append_number(length, codes[next_random() % sizeof(codes)]);
+    }
+    stream[length++] = 'm';
+    return length;
+}
+
+// A random byte stream of up to max_len bytes, which may stop part way
+// through a sequence
+static size_t random_stream(size_t max_len)
+{
+    static const char* const escapes[] = {"\x1b" "7", "\x1b" "8", "\x1b" "D", "\x1b" "E", "\x1b" "M",
+                                          "\x1b" "c", "\x1b(B", "\x1b#8", "\x1b]0;title\x07", "\x1b]2;x\x1b\\"};
+    static const uint8_t controls[] = {0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x07, 0x00, 0x7f, 0x18};
+    size_t target = next_random() % (max_len + 1);
+    size_t length = 0;
+
+    while (length < target)
+    {
+        uint32_t r = next_random() % 100;
+
+        if (r < 55)
+        {
+            stream[length++] = (uint8_t)(0x20 + next_random() % 0x5f);
+        }
+        else if (r < 70)
+        {
+            stream[length++] = controls[next_random() % sizeof(controls)];
+        }
+        else if (r < 85)
+        {
+            length = append_csi(length);
+        }
+        else if (r < 93)
+        {
+            length = append_sgr(length);
+        }
+        else
+        {
+            length = append(length, escapes[next_random() % (sizeof(escapes) / sizeof(escapes[0]))]);
+        }
+    }
+
+    // Sometimes leave the parser inside a sequence
+    if (length > 2 && next_random() % 8 == 0)
+    {
+        static const char* const partials[] = {"\x1b", "\x1b[", "\x1b[12;", "\x1b(", "\x1b]0;part"};
+        length = append(length, partials[next_random() % (sizeof(partials) / sizeof(partials[0]))]);
+    }
+    return length;
+}
+
+// What a terminal shows: cells by screen row, cursor, wrap, attributes and
+// scroll region, with the parser between sequences
+static const char* screen_difference(const vt_screen_t* a, const vt_screen_t* b)
+{
+    for (uint8_t row = 0; row < VT_SCREEN_ROWS; row++)
+    {
+        if (memcmp(a->cells[a->line[row]], b->cells[b->line[row]], sizeof(a->cells[0])) != 0)
+        {
+            return "cells";
+        }
+    }
+    if (a->row != b->row || a->col != b->col)
+    {
+        return "cursor";
+    }
+    if (a->wrap_pending != b->wrap_pending)
+    {
+        return "pending wrap";
+    }
+    if (a->attr != b->attr)
+    {
+        return "attributes";
+    }
+    if (a->top != b->top || a->bottom != b->bottom)
+    {
+        return "scroll region";
+    }
+    if (a->state != 0)
+    {
+        return "parser state";
+    }
+    return NULL;
+}
+
+int run_vt_screen_checks(uint32_t trials, uint32_t seed)
+{
+    static vt_screen_t from, to, applied;
+    size_t diff_bytes = 0, repaint_bytes = 0;
+
+    random_state = seed != 0 ? seed : 1;
+
+    for (uint32_t trial = 0; trial < trials; trial++)
+    {
+        vt_screen_reset(&from);
+        vt_screen_feed(&from, stream, random_stream(VT_SCREEN_CHECK_STREAM_MAX));
+
+        // A client a little behind the model, or one showing something else
+        if (next_random() % 2)
+        {
+            to = from;
+            vt_screen_feed(&to, stream, random_stream(VT_SCREEN_CHECK_STREAM_MAX / 10));
+        }
+        else
+        {
+            vt_screen_reset(&to);
+            vt_screen_feed(&to, stream, random_stream(VT_SCREEN_CHECK_STREAM_MAX));
+        }
+
+        size_t length;
+        const char* difference;
+
+        if (!vt_screen_diff(&from, &to, output, sizeof(output), &length))
+        {
+            fprintf(stderr, "vt_screen: trial %u: diff does not fit in %zu bytes\n", trial, sizeof(output));
+            return 1;
+        }
+        applied = from;
+        vt_screen_feed(&applied, output, length);
+        if ((difference = screen_difference(&applied, &to)) != NULL)
+        {
+            fprintf(stderr, "vt_screen: trial %u: diff of %zu bytes leaves different %s\n", trial, length, difference);
+            return 1;
+        }
+        size_t short_length;
+        if (length > 0 && vt_screen_diff(&from, &to, output, length - 1, &short_length))
+        {
+            fprintf(stderr, "vt_screen: trial %u: diff fits in less room than it used\n", trial);
+            return 1;
+        }
+        diff_bytes += length;
+
+        if (!vt_screen_repaint(&to, output, sizeof(output), &length))
+        {
+            fprintf(stderr, "vt_screen: trial %u: repaint does not fit in %zu bytes\n", trial, sizeof(output));
+            return 1;
+        }
+        applied = from;
+        vt_screen_feed(&applied, output, length);
+        if ((difference = screen_difference(&applied, &to)) != NULL)
+        {
+            fprintf(stderr, "vt_screen: trial %u: repaint of %zu bytes leaves different %s\n", trial, length,
+                    difference);
+            return 1;
+        }
+        repaint_bytes += length;
+    }
+
+    printf("vt_screen: %u random screens reproduced by diff (mean %zu bytes) and repaint (mean %zu bytes)\n", trials,
+           trials ? diff_bytes / trials : 0, trials ? repaint_bytes / trials : 0);
+    return 0;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+// Repaint and diff check of the console screen model (vt_screen.c).
+//
+// Each of the given number of trials feeds a random stream of printable text,
+// controls and ESC, CSI, SGR and OSC sequences, generated from seed, into one
+// model, and then either more of the same or a fresh stream into another.
+// Either may stop part way through a sequence. The output of vt_screen_diff()
+// from the first to the second, fed to a copy of the first, and the output of
+// vt_screen_repaint() of the second, fed to a copy of the first, must each
+// leave a model whose cells, cursor, pending wrap, attributes and scroll
+// region match the second and whose parser is between sequences. A diff
+// given one byte less room than it needs must report that it does not fit.
+//
+// Returns 0 when every trial matched, 1 at the first that did not (described
+// on stderr).
+#define VT_SCREEN_CHECK_STREAM_MAX 3000
+
+int run_vt_screen_checks(uint32_t trials, uint32_t seed);
@@ -0,0 +1,153 @@
+// Host stand-in for pico-ws-server (include/pico_ws_server/web_socket_server.h)
+#include "pico_ws_server/web_socket_server.h"
+
+namespace
+{
+WebSocketServer* g_instance = nullptr;
+}
+
+WebSocketServer::WebSocketServer(uint32_t max_connections)
+{
+    (void)max_connections;
+    g_instance = this;
+}
+
+WebSocketServer::~WebSocketServer()
+{
+    if (g_instance == this)
+    {
+        g_instance = nullptr;
+    }
+}
+
+void WebSocketServer::setConnectCallback(ConnectCallback callback)
+{
+    connect_callback_ = callback;
+}
+
+void WebSocketServer::setCloseCallback(ConnectCallback callback)
+{
+    close_callback_ = callback;
+}
+
+void WebSocketServer::setMessageCallback(MessageCallback callback)
+{
+    message_callback_ = callback;
+}
+
+void WebSocketServer::setPongCallback(MessageCallback callback)
+{
+    pong_callback_ = callback;
+}
+
+void WebSocketServer::setCallbackExtra(void* extra)
+{
+    extra_ = extra;
+}
+
+void* WebSocketServer::getCallbackExtra()
+{
+    return extra_;
+}
+
+void WebSocketServer::setTcpNoDelay(bool enabled)
+{
+    (void)enabled;
+}
+
+bool WebSocketServer::startListening(uint16_t port)
+{
+    (void)port;
+    return true;
+}
+
+// Messages are delivered as the test sends them
+void WebSocketServer::popMessages()
+{
+}
+
+bool WebSocketServer::sendMessage(uint32_t conn_id, const void* payload, size_t payload_size)
+{
+    auto client = clients_.find(conn_id);
+    if (client == clients_.end() || client->second.closed || client->second.refuse)
+    {
+        return false;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(payload);
+    client->second.received.emplace_back(bytes, bytes + payload_size);
+    return true;
+}
+
+bool WebSocketServer::sendPing(uint32_t conn_id, const void* payload, size_t payload_size)
+{
+    (void)payload;
+    (void)payload_size;
+    auto client = clients_.find(conn_id);
+    return client != clients_.end() && !client->second.closed;
+}
+
+bool WebSocketServer::close(uint32_t conn_id)
+{
+    auto client = clients_.find(conn_id);
+    if (client == clients_.end() || client->second.closed)
+    {
+        return false;
+    }
+    client->second.closed = true;
+    if (close_callback_)
+    {
+        close_callback_(*this, conn_id);
+    }
+    return true;
+}
+
+WebSocketServer* WebSocketServer::instance()
+{
+    return g_instance;
+}
+
+void WebSocketServer::clientConnect(uint32_t conn_id)
+{
+    clients_[conn_id] = Client();
+    if (connect_callback_)
+    {
+        connect_callback_(*this, conn_id);
+    }
+}
+
+void WebSocketServer::clientSend(uint32_t conn_id, const void* data, size_t len)
+{
+    if (message_callback_)
+    {
+        message_callback_(*this, conn_id, data, len);
+    }
+}
+
+void WebSocketServer::clientClose(uint32_t conn_id)
+{
+    close(conn_id);
+    clients_.erase(conn_id);
+}
+
+void WebSocketServer::clientRefuse(uint32_t conn_id, bool refuse)
+{
+    clients_[conn_id].refuse = refuse;
+}
+
+bool WebSocketServer::clientReceive(uint32_t conn_id, std::vector<uint8_t>* message)
+{
+    auto client = clients_.find(conn_id);
+    if (client == clients_.end() || client->second.received.empty())
+    {
+        return false;
+    }
+    *message = std::move(client->second.received.front());
+    client->second.received.pop_front();
+    return true;
+}
+
+bool WebSocketServer::clientClosed(uint32_t conn_id)
+{
+    auto client = clients_.find(conn_id);
+    return client == clients_.end() || client->second.closed;
+}
@@ -0,0 +1,667 @@
+// WebSocket output and channel protocol checks (ws_checks.h)
+#include "ws_checks.h"
+
+#include "pico/time.h"
+#include "pico_ws_server/web_socket_server.h"
+#include "spsc_ring.h"
+#include "vt_screen.h"
+#include "ws.h"
+#include "ws_protocol.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t WS_CHECK_OUTPUT_SIZE = 1024;
+constexpr uint32_t WS_CHECK_MONITOR_SIZE = 256;
+constexpr uint32_t WS_CHECK_PLAIN_ID = 1;
+constexpr uint32_t WS_CHECK_MUX_ID = 2;
+// Output written per poll while a client is refusing; well under the lag a
+// reading client may reach while its frames are held for coalescing
+constexpr size_t WS_CHECK_CHUNK = 32;
+constexpr size_t WS_CHECK_REFUSED_BYTES = 4000;
+constexpr uint32_t WS_CHECK_REFUSED_POLLS = 40;
+constexpr useconds_t WS_CHECK_POLL_US = 500;
+// Output has settled once this many polls in a row sent nothing, longer than
+// any flush or sync retry waits
+constexpr int WS_CHECK_QUIET_POLLS = 12;
+constexpr uint64_t WS_CHECK_SETTLE_US = 2000000;
+
+constexpr uint8_t WS_CHECK_MUX_CHANNELS = WS_CHANNEL_BIT(WS_CHANNEL_CONSOLE) | WS_CHANNEL_BIT(WS_CHANNEL_MONITOR) |
+                                          WS_CHANNEL_BIT(WS_CHANNEL_LEDS) | WS_CHANNEL_BIT(WS_CHANNEL_STATS);
+
+uint8_t console_storage[WS_CHECK_OUTPUT_SIZE];
+uint8_t monitor_storage[WS_CHECK_MONITOR_SIZE];
+spsc_ring_t console_ring;
+spsc_ring_t monitor_ring;
+
+// The emulator's side: everything written, and what arrived from clients
+vt_screen_t reference;
+std::vector<uint8_t> monitor_written;
+std::vector<uint8_t> plain_input;
+std::vector<std::vector<uint8_t>> channel_input; // Channel byte, then the payload
+std::deque<std::vector<uint8_t>> leds_queue;      // Frames the sampler has ready
+uint8_t stats_payload[WS_STATS_PAYLOAD_LEN];
+uint32_t leds_resyncs;
+uint8_t subscribed;
+
+// A client's side: its terminal and what it was sent on the other channels
+struct client_t
+{
+    uint32_t conn_id;
+    bool mux;
+    bool replied; // Channel mode: the hello reply has arrived
+    vt_screen_t terminal;
+    std::vector<uint8_t> monitor;
+    std::vector<std::vector<uint8_t>> replies;
+    std::vector<std::vector<uint8_t>> leds;
+    std::vector<std::vector<uint8_t>> stats;
+};
+
+client_t plain;
+client_t mux;
+WebSocketServer* server;
+
+// xorshift32
+uint32_t random_state;
+
+uint32_t next_random()
+{
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return random_state = x;
+}
+
+spsc_ring_t* ring_for(uint8_t channel)
+{
+    return channel == WS_CHANNEL_MONITOR ? &monitor_ring : &console_ring;
+}
+
+size_t output_peek(uint8_t channel, uint32_t position, const uint8_t** data, void* user_data)
+{
+    (void)user_data;
+    return spsc_ring_peek_at(ring_for(channel), position, data);
+}
+
+uint32_t output_head(uint8_t channel, void* user_data)
+{
+    (void)user_data;
+    return spsc_ring_head(ring_for(channel));
+}
+
+void output_release(uint8_t channel, uint32_t position, void* user_data)
+{
+    (void)user_data;
+    spsc_ring_release_to(ring_for(channel), position);
+}
+
+bool receive(const uint8_t* payload, size_t payload_len, void* user_data)
+{
+    (void)user_data;
+    plain_input.insert(plain_input.end(), payload, payload + payload_len);
+    return true;
+}
+
+bool channel_receive(uint8_t channel, const uint8_t* payload, size_t payload_len, void* user_data)
+{
+    (void)user_data;
+    std::vector<uint8_t> message(1 + payload_len, channel);
+    std::copy(payload, payload + payload_len, message.begin() + 1);
+    channel_input.push_back(message);
+    return true;
+}
+
+size_t snapshot(uint8_t channel, uint8_t* buffer, size_t max_len, void* user_data)
+{
+    (void)user_data;
+    if (channel == WS_CHANNEL_STATS)
+    {
+        std::memcpy(buffer, stats_payload, sizeof(stats_payload));
+        return sizeof(stats_payload);
+    }
+    if (leds_queue.empty() || leds_queue.front().size() > max_len)
+    {
+        return 0;
+    }
+    size_t length = leds_queue.front().size();
+    std::memcpy(buffer, leds_queue.front().data(), length);
+    leds_queue.pop_front();
+    return length;
+}
+
+void subscription(uint8_t channels, void* user_data)
+{
+    (void)user_data;
+    subscribed = channels;
+}
+
+void resync(uint8_t channel, void* user_data)
+{
+    (void)user_data;
+    if (channel == WS_CHANNEL_LEDS)
+    {
+        ++leds_resyncs;
+    }
+}
+
+// Write as much as the console ring takes, as the emulator does
+size_t write_console(const uint8_t* data, size_t length)
+{
+    size_t taken = spsc_ring_enqueue_bytes(&console_ring, data, length);
+    vt_screen_feed(&reference, data, taken);
+    return taken;
+}
+
+size_t write_monitor(const char* text)
+{
+    size_t taken = spsc_ring_enqueue_bytes(&monitor_ring, reinterpret_cast<const uint8_t*>(text), strlen(text));
+    monitor_written.insert(monitor_written.end(), text, text + taken);
+    return taken;
+}
+
+// Console output of about length bytes: text, line ends, cursor moves, erases
+// and attribute changes, ending between sequences
+void next_chunk(std::vector<uint8_t>* chunk, size_t length)
+{
+    static const char moves[] = "ABCD";
+    static const uint8_t attributes[] = {0, 1, 4, 7, 0, 0};
+    char text[24];
+
+    chunk->clear();
+    while (chunk->size() < length)
+    {
+        uint32_t r = next_random() % 100;
+
+        if (r < 60)
+        {
+            snprintf(text, sizeof(text), "%c", static_cast<char>(0x20 + next_random() % 0x5f));
+        }
+        else if (r < 72)
+        {
+            snprintf(text, sizeof(text), "\r\n");
+        }
+        else if (r < 80)
+        {
+            snprintf(text, sizeof(text), "\x1b[%u;%uH", 1 + next_random() % VT_SCREEN_ROWS,
+                     1 + next_random() % VT_SCREEN_COLS);
+        }
+        else if (r < 86)
+        {
+            snprintf(text, sizeof(text), "\x1b[%u%c", 1 + next_random() % 5, moves[next_random() % 4]);
+        }
+        else if (r < 90)
+        {
+            snprintf(text, sizeof(text), next_random() % 2 ? "\x1b[K" : "\x1b[J");
+        }
+        else if (r < 95)
+        {
+            snprintf(text, sizeof(text), "\x1b[%um", attributes[next_random() % sizeof(attributes)]);
+        }
+        else if (r < 98)
+        {
+            snprintf(text, sizeof(text), next_random() % 2 ? "\b" : "\t");
+        }
+        else
+        {
+            snprintf(text, sizeof(text), "\x1b[%u;%ur", 1 + next_random() % 3, 4 + next_random() % 21);
+        }
+        chunk->insert(chunk->end(), text, text + strlen(text));
+    }
+}
+
+// Take everything the server has sent a client, as it would. Returns how many
+// messages there were.
+int deliver(client_t* client)
+{
+    std::vector<uint8_t> message;
+    int count = 0;
+
+    while (server->clientReceive(client->conn_id, &message))
+    {
+        ++count;
+        if (!client->mux)
+        {
+            vt_screen_feed(&client->terminal, message.data(), message.size());
+            continue;
+        }
+        if (message.empty())
+        {
+            continue;
+        }
+
+        // Anything before the hello reply was sent to a plain terminal
+        if (!client->replied && message[0] != WS_CHANNEL_CONTROL)
+        {
+            continue;
+        }
+
+        std::vector<uint8_t> payload(message.begin() + 1, message.end());
+        switch (message[0])
+        {
+        case WS_CHANNEL_CONTROL:
+            client->replied |= !payload.empty() && payload[0] == WS_CONTROL_HELLO;
+            client->replies.push_back(payload);
+            break;
+        case WS_CHANNEL_CONSOLE:
+            vt_screen_feed(&client->terminal, payload.data(), payload.size());
+            break;
+        case WS_CHANNEL_MONITOR:
+            client->monitor.insert(client->monitor.end(), payload.begin(), payload.end());
+            break;
+        case WS_CHANNEL_LEDS:
+            client->leds.push_back(payload);
+            break;
+        case WS_CHANNEL_STATS:
+            client->stats.push_back(payload);
+            break;
+        }
+    }
+    return count;
+}
+
+int poll_once()
+{
+    ws_poll_incoming();
+    ws_poll_outgoing();
+    return deliver(&plain) + deliver(&mux);
+}
+
+bool client_stats(const client_t& client, ws_client_stats_t* stats)
+{
+    ws_client_stats_t all[2];
+    size_t count = ws_get_client_stats(all, 2);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (all[i].conn_id == client.conn_id)
+        {
+            *stats = all[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Poll until both clients have been sent all output and nothing more goes out
+bool settle()
+{
+    uint64_t start = time_us_64();
+    int quiet = 0;
+
+    while (time_us_64() - start < WS_CHECK_SETTLE_US)
+    {
+        quiet = poll_once() > 0 ? 0 : quiet + 1;
+
+        ws_client_stats_t plain_stats, mux_stats;
+        if (quiet >= WS_CHECK_QUIET_POLLS && client_stats(plain, &plain_stats) && client_stats(mux, &mux_stats) &&
+            plain_stats.lag == 0 && mux_stats.lag == 0)
+        {
+            return true;
+        }
+        usleep(WS_CHECK_POLL_US);
+    }
+    fprintf(stderr, "ws: output did not settle\n");
+    return false;
+}
+
+// What a terminal shows: cells by screen row, cursor, wrap, attributes and
+// scroll region
+const char* screen_difference(const vt_screen_t* a, const vt_screen_t* b)
+{
+    for (uint8_t row = 0; row < VT_SCREEN_ROWS; row++)
+    {
+        if (std::memcmp(a->cells[a->line[row]], b->cells[b->line[row]], sizeof(a->cells[0])) != 0)
+        {
+            return "cells";
+        }
+    }
+    if (a->row != b->row || a->col != b->col)
+    {
+        return "cursor";
+    }
+    if (a->wrap_pending != b->wrap_pending)
+    {
+        return "pending wrap";
+    }
+    if (a->attr != b->attr)
+    {
+        return "attributes";
+    }
+    if (a->top != b->top || a->bottom != b->bottom)
+    {
+        return "scroll region";
+    }
+    return nullptr;
+}
+
+bool check_terminals(const char* phase)
+{
+    const client_t* clients[] = {&plain, &mux};
+
+    for (const client_t* client : clients)
+    {
+        const char* difference = screen_difference(&client->terminal, &reference);
+        if (difference != nullptr)
+        {
+            fprintf(stderr, "ws: %s: %s client's terminal shows different %s\n", phase,
+                    client->mux ? "channel mode" : "plain", difference);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool check_reply(const std::vector<uint8_t>& reply, uint8_t channels)
+{
+    static const uint8_t head[] = {WS_CONTROL_HELLO, 'A', 'L', 'T', 'A', 'I', 'R', WS_PROTOCOL_VERSION,
+                                   WS_CHANNELS_SUPPORTED};
+
+    if (reply.size() != WS_HELLO_REPLY_LEN || std::memcmp(reply.data(), head, sizeof(head)) != 0 ||
+        reply[sizeof(head)] != channels)
+    {
+        fprintf(stderr, "ws: hello reply is not version %d with channels %02X\n", WS_PROTOCOL_VERSION, channels);
+        return false;
+    }
+    return true;
+}
+
+bool check_connect()
+{
+    static const uint8_t hello[] = {WS_CHANNEL_CONTROL, WS_CONTROL_HELLO, 'A', 'L', 'T', 'A', 'I', 'R',
+                                    WS_PROTOCOL_VERSION, WS_CHECK_MUX_CHANNELS};
+    static const char banner[] = "ALTAIR 8800\r\n\x1b[1mREADY\x1b[0m\r\n";
+
+    // Output from before anyone connected arrives as a repaint
+    write_console(reinterpret_cast<const uint8_t*>(banner), sizeof(banner) - 1);
+    poll_once();
+
+    plain.conn_id = WS_CHECK_PLAIN_ID;
+    mux.conn_id = WS_CHECK_MUX_ID;
+    mux.mux = true;
+    server->clientConnect(plain.conn_id);
+    server->clientConnect(mux.conn_id);
+    server->clientSend(mux.conn_id, hello, sizeof(hello));
+    if (leds_resyncs == 0)
+    {
+        fprintf(stderr, "ws: no LEDS key frame asked for on subscribing\n");
+        return false;
+    }
+
+    // A delta before the key frame is of no use to a client that just joined
+    leds_queue.push_back({0x00, 0x01, 0x12});
+    leds_queue.push_back({WS_LEDS_KEY, 0x1f, 0x34, 0x12, 0xc3, 0x8a, WS_LEDS_INTE});
+    leds_queue.push_back({0x00, 0x10, 0x00});
+    for (size_t i = 0; i < sizeof(stats_payload); i++)
+    {
+        stats_payload[i] = static_cast<uint8_t>(i * 11);
+    }
+    poll_once();
+
+    if (mux.replies.size() != 1)
+    {
+        fprintf(stderr, "ws: %zu hello replies on the control channel\n", mux.replies.size());
+        return false;
+    }
+    if (!check_reply(mux.replies[0], WS_CHECK_MUX_CHANNELS))
+    {
+        return false;
+    }
+    if (subscribed != WS_CHECK_MUX_CHANNELS)
+    {
+        fprintf(stderr, "ws: subscriptions reported as %02X\n", subscribed);
+        return false;
+    }
+    if (mux.leds.size() != 2 || mux.leds[0][0] != WS_LEDS_KEY || mux.leds[1] != std::vector<uint8_t>{0x00, 0x10, 0x00})
+    {
+        fprintf(stderr, "ws: %zu LEDS frames, expected the key frame and the delta after it\n", mux.leds.size());
+        return false;
+    }
+    if (mux.stats.size() != 1 || mux.stats[0] != std::vector<uint8_t>(stats_payload, stats_payload + WS_STATS_PAYLOAD_LEN))
+    {
+        fprintf(stderr, "ws: STATS payload not sent as given\n");
+        return false;
+    }
+
+    // Input goes to the callback for its client kind, control requests the
+    // server does not handle with the rest
+    static const uint8_t typed[] = {'D', 'I', 'R', '\r'};
+    static const uint8_t console_key[] = {WS_CHANNEL_CONSOLE, 'x'};
+    static const uint8_t mode[] = {WS_CHANNEL_CONTROL, WS_CONTROL_MODE, 0};
+    server->clientSend(plain.conn_id, typed, sizeof(typed));
+    server->clientSend(mux.conn_id, console_key, sizeof(console_key));
+    server->clientSend(mux.conn_id, mode, sizeof(mode));
+    if (plain_input != std::vector<uint8_t>(typed, typed + sizeof(typed)) || channel_input.size() != 2 ||
+        channel_input[0] != std::vector<uint8_t>(console_key, console_key + sizeof(console_key)) ||
+        channel_input[1] != std::vector<uint8_t>(mode, mode + sizeof(mode)))
+    {
+        fprintf(stderr, "ws: input not passed on by client kind and channel\n");
+        return false;
+    }
+
+    return settle() && check_terminals("connect");
+}
+
+// Block: a client that stops reading holds the writer once the buffer is full
+// and loses nothing
+bool check_block()
+{
+    std::vector<uint8_t> chunk;
+    size_t written = 0, offset = 0;
+    uint32_t loops = 0, refused_polls = 0;
+    bool writer_waited = false;
+
+    ws_set_output_policy(WS_OUTPUT_BLOCK);
+    ws_clear_output_stats();
+
+    while (written < WS_CHECK_STREAM_BYTES || offset < chunk.size())
+    {
+        bool refusing = written >= WS_CHECK_STREAM_BYTES / 2 && refused_polls < WS_CHECK_REFUSED_POLLS;
+        server->clientRefuse(mux.conn_id, refusing);
+
+        if (offset == chunk.size())
+        {
+            next_chunk(&chunk, 1 + next_random() % 400);
+            offset = 0;
+        }
+        size_t taken = write_console(&chunk[offset], chunk.size() - offset);
+        offset += taken;
+        written += taken;
+
+        if (refusing)
+        {
+            // Its bytes are kept until the buffer is full, and the writer
+            // then waits
+            ws_client_stats_t stats = {};
+            if (!client_stats(mux, &stats) || stats.lag > WS_CHECK_OUTPUT_SIZE)
+            {
+                fprintf(stderr, "ws: block: the buffer was released past a client that is not reading\n");
+                return false;
+            }
+            writer_waited |= taken == 0 && stats.lag == WS_CHECK_OUTPUT_SIZE;
+        }
+        // Monitor output goes only to the channel mode client and is held,
+        // refusing or not, until it has been sent
+        if (spsc_ring_count(&monitor_ring) != monitor_written.size() - mux.monitor.size())
+        {
+            fprintf(stderr, "ws: block: the monitor buffer was released past bytes not yet sent\n");
+            return false;
+        }
+        if (++loops % 8 == 0)
+        {
+            char text[24];
+            snprintf(text, sizeof(text), "%04X 3E 2A MVI A,2AH\r\n", loops & 0xffff);
+            write_monitor(text);
+        }
+
+        refused_polls += refusing;
+        poll_once();
+        usleep(refusing ? WS_CHECK_POLL_US : 100);
+    }
+    server->clientRefuse(mux.conn_id, false);
+
+    if (!settle() || !check_terminals("block"))
+    {
+        return false;
+    }
+
+    ws_client_stats_t plain_stats = {}, mux_stats = {};
+    client_stats(plain, &plain_stats);
+    client_stats(mux, &mux_stats);
+    if (!writer_waited || mux_stats.stalls == 0)
+    {
+        fprintf(stderr, "ws: block: the writer never waited for the client that stopped reading\n");
+        return false;
+    }
+    if (plain_stats.dropped != 0 || mux_stats.dropped != 0 || plain_stats.resyncs != 0 || mux_stats.resyncs != 0)
+    {
+        fprintf(stderr, "ws: block: output was skipped\n");
+        return false;
+    }
+    if (mux.monitor != monitor_written || mux_stats.monitor_drops != 0)
+    {
+        fprintf(stderr, "ws: block: monitor channel received %zu of %zu bytes\n", mux.monitor.size(),
+                monitor_written.size());
+        return false;
+    }
+    return true;
+}
+
+// Write WS_CHECK_REFUSED_BYTES a chunk a poll while the channel mode client
+// refuses every frame; the writer must never find the buffer full
+bool write_past_refusing_client(const char* phase)
+{
+    std::vector<uint8_t> chunk;
+
+    server->clientRefuse(mux.conn_id, true);
+    for (size_t written = 0; written < WS_CHECK_REFUSED_BYTES; written += chunk.size())
+    {
+        next_chunk(&chunk, WS_CHECK_CHUNK);
+        if (write_console(chunk.data(), chunk.size()) != chunk.size())
+        {
+            fprintf(stderr, "ws: %s: the writer waited for a client that is not reading\n", phase);
+            return false;
+        }
+        if (write_monitor("MONITOR\r\n") == 0)
+        {
+            fprintf(stderr, "ws: %s: the monitor writer waited for a client that is not reading\n", phase);
+            return false;
+        }
+        poll_once();
+        usleep(200);
+    }
+    server->clientRefuse(mux.conn_id, false);
+    return settle();
+}
+
+// Resync: the client is skipped forward and brought back by a diff
+bool check_resync()
+{
+    ws_set_output_policy(WS_OUTPUT_RESYNC);
+    ws_clear_output_stats();
+    if (!write_past_refusing_client("resync") || !check_terminals("resync"))
+    {
+        return false;
+    }
+
+    ws_client_stats_t stats = {};
+    client_stats(mux, &stats);
+    if (stats.resyncs == 0 || stats.dropped == 0 || stats.syncs == 0)
+    {
+        fprintf(stderr, "ws: resync: client not skipped forward and synced\n");
+        return false;
+    }
+    return true;
+}
+
+// A client whose hello reply cannot go out does not hold the buffers, even
+// under block, and is repainted once the reply is sent
+bool check_reply_pending()
+{
+    static const uint8_t subscribe[] = {WS_CHANNEL_CONTROL, WS_CONTROL_SUBSCRIBE,
+                                        WS_CHANNEL_BIT(WS_CHANNEL_CONSOLE) | WS_CHANNEL_BIT(WS_CHANNEL_MONITOR)};
+
+    ws_set_output_policy(WS_OUTPUT_BLOCK);
+    ws_clear_output_stats();
+    server->clientRefuse(mux.conn_id, true);
+    server->clientSend(mux.conn_id, subscribe, sizeof(subscribe));
+    size_t replies = mux.replies.size();
+
+    if (!write_past_refusing_client("reply pending") || !check_terminals("reply pending"))
+    {
+        return false;
+    }
+    if (mux.replies.size() != replies + 1)
+    {
+        fprintf(stderr, "ws: reply pending: subscribe not answered once\n");
+        return false;
+    }
+    if (!check_reply(mux.replies.back(), subscribe[2]))
+    {
+        return false;
+    }
+
+    ws_client_stats_t stats = {};
+    client_stats(mux, &stats);
+    if (stats.resyncs == 0 || stats.monitor_drops == 0)
+    {
+        fprintf(stderr, "ws: reply pending: client's cursors not skipped forward\n");
+        return false;
+    }
+
+    // No longer subscribed to LEDS
+    size_t leds = mux.leds.size();
+    leds_queue.push_back({WS_LEDS_KEY, 0x1f, 0, 0, 0, 0, 0});
+    poll_once();
+    if (mux.leds.size() != leds)
+    {
+        fprintf(stderr, "ws: LEDS frame sent after unsubscribing\n");
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+int run_ws_checks(uint32_t seed)
+{
+    ws_callbacks_t callbacks = {};
+
+    random_state = seed != 0 ? seed : 1;
+    spsc_ring_init(&console_ring, console_storage, sizeof(console_storage));
+    spsc_ring_init(&monitor_ring, monitor_storage, sizeof(monitor_storage));
+    vt_screen_reset(&reference);
+    vt_screen_reset(&plain.terminal);
+    vt_screen_reset(&mux.terminal);
+
+    callbacks.on_receive = receive;
+    callbacks.on_channel_receive = channel_receive;
+    callbacks.on_output_peek = output_peek;
+    callbacks.on_output_head = output_head;
+    callbacks.on_output_release = output_release;
+    callbacks.on_snapshot = snapshot;
+    callbacks.on_subscription = subscription;
+    callbacks.on_resync = resync;
+    callbacks.output_size = WS_CHECK_OUTPUT_SIZE;
+    callbacks.monitor_output_size = WS_CHECK_MONITOR_SIZE;
+    ws_init(&callbacks);
+    if (!ws_start() || (server = WebSocketServer::instance()) == nullptr)
+    {
+        fprintf(stderr, "ws: server did not start\n");
+        return 1;
+    }
+
+    if (!check_connect() || !check_block() || !check_resync() || !check_reply_pending())
+    {
+        return 1;
+    }
+
+    printf("ws: plain and channel mode clients match %d bytes of output under block, resync and a stuck reply\n",
+           WS_CHECK_STREAM_BYTES);
+    return 0;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+// WebSocket output and channel protocol (ws.cpp, ws_protocol.h) with the
+// server played by a stand-in (include/pico_ws_server/web_socket_server.h).
+//
+// A plain terminal and a channel mode client connect to a console and a
+// monitor output ring and are fed WS_CHECK_STREAM_BYTES of random console
+// output through ws_poll_outgoing(). Each keeps a screen model of what it was
+// sent, which must match one fed the whole stream once output has settled.
+// Along the way it checks the hello and subscribe replies, that input reaches
+// the callback for its client kind and channel, the monitor stream, STATS
+// payloads, and that LEDS deltas are held back until a key frame.
+//
+// Then, with the channel mode client's send buffer refusing frames: under
+// the block policy the writer must wait for it with its bytes kept; under
+// the resync policy the writer must never wait and the client must be
+// brought back by a diff; and a client whose hello reply cannot go out must
+// not hold the buffers under either.
+//
+// Returns 0 when every check passed, 1 at the first that did not (described
+// on stderr).
+#define WS_CHECK_STREAM_BYTES 20000
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    int run_ws_checks(uint32_t seed);
+
+#ifdef __cplusplus
+}
+#endif
@@ -27,7 +27,7 @@ void uint8_to_binary(uint8_t bitmap, char *buffer, size_t buffer_length)
 }
 
 /**
- * @brief Publish message to WebSocket clients
+ * @brief Publish message to WebSocket clients, on the console and the monitor channel
  */
 void publish_message(const char* message, size_t length)
 {
@@ -36,15 +36,14 @@ void publish_message(const char* message, size_t length)
         return;
     }
     
-    for (size_t i = 0; i < length; i++)
-    {
-        websocket_console_enqueue_output((uint8_t)message[i]);
-    }
+    websocket_console_enqueue_bytes((const uint8_t*)message, length);
+    websocket_console_enqueue_monitor((const uint8_t*)message, length);
 }
 
 const char *get_i8080_instruction_name(uint8_t opcode, uint8_t *i8080_instruction_size)
 {
-    // http://www.emulator101.com/reference/8080-by-opcode.html
+    // http://www.emulator101.com/reference/8080-by-opcode.html; * marks the
+    // undocumented aliases the 8080 decodes as JMP, RET and CALL
     static const char *const i8080_instruction[] = {"NOP", "LXI B,D16", "STAX B", "INX B", "INR B", "DCR B", "MVI B, D8",
         "RLC", "-", "DAD B", "LDAX B", "DCX B", "INR C", "DCR C", "MVI C,D8", "RRC", "-", "LXI D,D16",
         "STAX D", "INX D", "INR D", "DCR D", "MVI D, D8", "RAL", "-", "DAD D", "LDAX D", "DCX D", "INR E",
@@ -65,11 +64,11 @@ const char *get_i8080_instruction_name(uint8_t opcode, uint8_t *i8080_instructio
         "ANA A", "XRA B", "XRA C", "XRA D", "XRA E", "XRA H", "XRA L", "XRA M", "XRA A", "ORA B", "ORA C",
         "ORA D", "ORA E", "ORA H", "ORA L", "ORA M", "ORA A", "CMP B", "CMP C", "CMP D", "CMP E", "CMP H",
         "CMP L", "CMP M", "CMP A", "RNZ", "POP B", "JNZ adr", "JMP adr", "CNZ adr", "PUSH B", "ADI D8",
-        "RST 0", "RZ", "RET", "JZ adr", "-", "CZ adr", "CALL adr", "ACI D8", "RST 1", "RNC", "POP D",
-        "JNC adr", "OUT D8", "CNC adr", "PUSH D", "SUI D8", "RST 2", "RC", "-", "JC adr", "IN D8", "CC adr",
-        "-", "SBI D8", "RST 3", "RPO", "POP H", "JPO adr", "XTHL", "CPO adr", "PUSH H", "ANI D8", "RST 4",
-        "RPE", "PCHL", "JPE adr", "XCHG", "CPE adr", "-", "XRI D8", "RST 5", "RP", "POP PSW", "JP adr", "DI",
-        "CP adr", "PUSH PSW", "ORI D8", "RST 6", "RM", "SPHL", "JM adr", "EI", "CM adr", "-", "CPI D8",
+        "RST 0", "RZ", "RET", "JZ adr", "*JMP adr", "CZ adr", "CALL adr", "ACI D8", "RST 1", "RNC", "POP D",
+        "JNC adr", "OUT D8", "CNC adr", "PUSH D", "SUI D8", "RST 2", "RC", "*RET", "JC adr", "IN D8", "CC adr",
+        "*CALL adr", "SBI D8", "RST 3", "RPO", "POP H", "JPO adr", "XTHL", "CPO adr", "PUSH H", "ANI D8", "RST 4",
+        "RPE", "PCHL", "JPE adr", "XCHG", "CPE adr", "*CALL adr", "XRI D8", "RST 5", "RP", "POP PSW", "JP adr", "DI",
+        "CP adr", "PUSH PSW", "ORI D8", "RST 6", "RM", "SPHL", "JM adr", "EI", "CM adr", "*CALL adr", "CPI D8",
         "RST 7"};
     static const uint8_t i8080_instruction_length[] = {1, 3, 1, 1, 1, 1, 2, 1, 0, 1, 1, 1, 1, 1, 2, 1, 0, 3, 1, 1,
         1, 1, 2, 1, 0, 1, 1, 1, 1, 1, 2, 1, 0, 3, 3, 1, 1, 1, 2, 1, 0, 1, 3, 1, 1, 1, 2, 1, 0, 3, 3, 1, 1, 1,
@@ -77,8 +76,8 @@ const char *get_i8080_instruction_name(uint8_t opcode, uint8_t *i8080_instructio
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 0, 3, 3, 2, 1, 1, 1, 3, 2, 3, 1, 2, 1, 1, 0, 3, 2, 3, 0, 2, 1,
-        1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 0, 2, 1, 1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 0, 2, 1};
+        1, 1, 1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 3, 3, 3, 2, 1, 1, 1, 3, 2, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,
+        1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1, 1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1};
     // int index = 0;
 
     *i8080_instruction_size = i8080_instruction_length[opcode];
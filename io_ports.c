@@ -1,10 +1,7 @@
 #include "io_ports.h"
 
-#include "PortDrivers/http_io.h"
 #include "PortDrivers/time_io.h"
 #include "PortDrivers/utility_io.h"
-#include <stdio.h>
-#include <string.h>
 
 #define REQUEST_BUFFER_SIZE 128
 
@@ -15,62 +12,46 @@ typedef struct
     char buffer[REQUEST_BUFFER_SIZE];
 } request_unit_t;
 
+io_port_t io_port_table[256];
+
+static io_port_response_handler_t response_handlers[256];
 static request_unit_t request_unit;
 
-void io_port_out(uint8_t port, uint8_t data)
+void io_port_register(uint8_t port, io_port_in_handler_t in_fn, io_port_out_handler_t out_fn, void* context)
 {
-    memset(&request_unit, 0, sizeof(request_unit));
+    io_port_table[port].in = in_fn;
+    io_port_table[port].out = out_fn;
+    io_port_table[port].context = context;
+}
 
-    switch (port)
-    {
-        case 24:
-        case 25:
-        case 26:
-        case 27:
-        case 28:
-        case 29:
-        case 30:
-        case 41:
-        case 42:
-        case 43:
-            request_unit.len = time_output(port, data, request_unit.buffer, sizeof(request_unit.buffer));
-            break;
-        case 45:
-        case 70:
-            request_unit.len = utility_output(port, data, request_unit.buffer, sizeof(request_unit.buffer));
-            break;
-        case 109:
-        case 110:
-        case 114:
-            request_unit.len = http_output(port, data, request_unit.buffer, sizeof(request_unit.buffer));
-            break;
-        default:
-            break;
-    }
+// A new request replaces whatever is left of the previous reply
+static void response_out(void* context, uint8_t port, uint8_t data)
+{
+    (void)context;
+    request_unit.count = 0;
+    request_unit.len = response_handlers[port](port, data, request_unit.buffer, sizeof(request_unit.buffer));
 }
 
-uint8_t io_port_in(uint8_t port)
+static uint8_t response_in(void* context, uint8_t port)
 {
-    switch (port)
+    (void)context;
+    (void)port;
+    if (request_unit.count < request_unit.len && request_unit.count < sizeof(request_unit.buffer))
     {
-        case 24:
-        case 25:
-        case 26:
-        case 27:
-        case 28:
-        case 29:
-        case 30:
-            return time_input(port);
-        case 33:
-        case 201:
-            return http_input(port);
-        case 200:
-            if (request_unit.count < request_unit.len && request_unit.count < sizeof(request_unit.buffer))
-            {
-                return (uint8_t)request_unit.buffer[request_unit.count++];
-            }
-            return 0x00;
-        default:
-            return 0x00;
+        return (uint8_t)request_unit.buffer[request_unit.count++];
     }
+    return 0x00;
+}
+
+void io_port_register_response(uint8_t port, io_port_in_handler_t in_fn, io_port_response_handler_t out_fn)
+{
+    response_handlers[port] = out_fn;
+    io_port_register(port, in_fn, response_out, NULL);
+}
+
+void io_ports_init(void)
+{
+    io_port_register(IO_PORT_RESPONSE, response_in, NULL, NULL);
+    time_io_init();
+    utility_io_init();
 }
@@ -1,6 +1,52 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
-uint8_t io_port_in(uint8_t port);
-void io_port_out(uint8_t port, uint8_t data);
+// Port handlers; context is the pointer given to io_port_register()
+typedef uint8_t (*io_port_in_handler_t)(void* context, uint8_t port);
+typedef void (*io_port_out_handler_t)(void* context, uint8_t port, uint8_t data);
+
+// Output handlers that answer through the response port: they write the reply
+// into buffer and return its length
+typedef size_t (*io_port_response_handler_t)(int port, uint8_t data, char* buffer, size_t buffer_length);
+
+typedef struct
+{
+    io_port_in_handler_t in;
+    io_port_out_handler_t out;
+    void* context;
+} io_port_t;
+
+// Indexed by port number; filled by io_port_register()
+extern io_port_t io_port_table[256];
+
+// Attach a device to a port, replacing any earlier registration. Either
+// handler may be NULL: a port with no input handler reads 0x00 and writes to
+// one with no output handler are dropped.
+void io_port_register(uint8_t port, io_port_in_handler_t in_fn, io_port_out_handler_t out_fn, void* context);
+
+// Attach an output handler whose reply the program then reads a byte at a
+// time from IO_PORT_RESPONSE
+void io_port_register_response(uint8_t port, io_port_in_handler_t in_fn, io_port_response_handler_t out_fn);
+
+#define IO_PORT_RESPONSE 200
+
+// Register the response port and the time and utility drivers. The console,
+// disk and HTTP drivers register from their own init functions.
+void io_ports_init(void);
+
+static inline uint8_t io_port_in(uint8_t port)
+{
+    const io_port_t* handler = &io_port_table[port];
+    return handler->in ? handler->in(handler->context, port) : 0x00;
+}
+
+static inline void io_port_out(uint8_t port, uint8_t data)
+{
+    const io_port_t* handler = &io_port_table[port];
+    if (handler->out)
+    {
+        handler->out(handler->context, port, data);
+    }
+}
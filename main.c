@@ -1,5 +1,8 @@
 #include "Altair8800/intel8080.h"
 #include "Altair8800/memory.h"
+#include "Altair8800/debugger.h"
+#include "Altair8800/profiler.h"
+#include "Altair8800/trace.h"
 #ifdef SD_CARD_SUPPORT
 #include "Altair8800/pico_88dcdd_sd_card.h"
 #include "diskio.h"
@@ -10,6 +13,11 @@
 #endif
 #include "FrontPanels/display_2_8.h"
 #include "FrontPanels/inky_display.h"
+#include "FrontPanels/panel_sampler.h"
+#include "FrontPanels/virtual_monitor.h"
+#include "PortDrivers/console_io.h"
+#include "PortDrivers/sio2_io.h"
+#include "PortDrivers/tcp_serial.h"
 #include "build_version.h"
 #include "comms_mgr.h"
 #include "cpu_state.h"
@@ -17,6 +25,8 @@
 #include "io_ports.h"
 #include "pico/error.h"
 #include "pico/stdlib.h"
+#include "snapshot.h"
+#include "usb_console.h"
 #include "wifi_config.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -41,10 +51,17 @@ extern intel8080_t cpu;
 // Forward declarations of static functions
 static uint8_t terminal_read(void);
 static void terminal_write(uint8_t c);
-static inline uint8_t sense(void);
+static uint8_t sense_port_in(void* context, uint8_t port);
+static size_t console_read_bytes(uint8_t* buffer, size_t max_len);
+static size_t console_write_bytes(const uint8_t* data, size_t length);
+static bool console_input_pending(void);
 
-// Static disk controller reference for reset
-static disk_controller_t* g_disk_controller = NULL;
+// 2SIO channel 1 shares the console with the 88-SIO; channel 2 is a TCP stream
+static const sio2_backend_t sio2_console = {console_read_bytes, console_write_bytes, console_input_pending};
+static const sio2_backend_t sio2_tcp = {tcp_serial_read, tcp_serial_write, tcp_serial_input_pending};
+
+// Set once the disks are loaded and the CPU can be reset
+static bool g_machine_ready = false;
 
 void client_connected_cb(void)
 {
@@ -54,11 +71,12 @@ void client_connected_cb(void)
 // Reset function for CPU monitor
 void altair_reset(void)
 {
-    if (g_disk_controller)
+    if (g_machine_ready)
     {
         memset(memory, 0x00, 64 * 1024); // Clear Altair memory
         loadDiskLoader(0xFF00);          // Load disk boot loader at 0xFF00
-        i8080_reset(&cpu, terminal_read, terminal_write, sense, g_disk_controller, io_port_in, io_port_out);
+        i8080_reset(&cpu, memory);
+        sio2_reset();
         i8080_examine(&cpu, 0xFF00); // Reset to boot loader address
         bus_switches = cpu.address_bus;
     }
@@ -160,8 +178,8 @@ static uint8_t terminal_read(void)
         return (uint8_t)(ws_ch & ASCII_MASK_7BIT);
     }
 #else
-    int c = getchar_timeout_us(0); // Non-blocking read
-    if (c == PICO_ERROR_TIMEOUT)
+    int c = usb_console_read(); // Non-blocking read
+    if (c < 0)
     {
         return 0x00; // Return null if no character available
     }
@@ -178,13 +196,62 @@ static void terminal_write(uint8_t c)
 #if defined(CYW43_WL_GPIO_LED_PIN)
     websocket_console_enqueue_output(c);
 #else
-    putchar(c);
+    usb_console_put(c);
+#endif
+}
+
+// 2SIO channel 1 input: whatever the console has, up to max_len
+static size_t console_read_bytes(uint8_t* buffer, size_t max_len)
+{
+    size_t count = 0;
+    uint8_t ch;
+
+    while (count < max_len && (ch = terminal_read()) != 0)
+    {
+        buffer[count++] = ch;
+    }
+    return count;
+}
+
+// 2SIO channel 1 output, a FIFO's worth at a time. The console waits for
+// room itself, so every byte is taken.
+static size_t console_write_bytes(const uint8_t* data, size_t length)
+{
+    size_t taken = length;
+    uint8_t text[64];
+
+    while (length > 0)
+    {
+        size_t chunk = length < sizeof(text) ? length : sizeof(text);
+        for (size_t i = 0; i < chunk; i++)
+        {
+            text[i] = data[i] & ASCII_MASK_7BIT;
+        }
+#if defined(CYW43_WL_GPIO_LED_PIN)
+        websocket_console_enqueue_bytes(text, chunk);
+#else
+        usb_console_write(text, chunk);
+#endif
+        data += chunk;
+        length -= chunk;
+    }
+    return taken;
+}
+
+static bool console_input_pending(void)
+{
+#if defined(CYW43_WL_GPIO_LED_PIN)
+    return websocket_console_input_pending();
+#else
+    return usb_console_input_pending();
 #endif
 }
 
-// Sense switches
-static inline uint8_t sense(void)
+// Sense switches (port FFh)
+static uint8_t sense_port_in(void* context, uint8_t port)
 {
+    (void)context;
+    (void)port;
     return (uint8_t)(bus_switches >> 8);
 }
 
@@ -271,6 +338,217 @@ static inline void update_display_if_changed(void)
 }
 #endif
 
+// Clock governor: the CPU runs in fixed wall-clock slices. Each slice gets a
+// T-state budget from the selected preset and then waits for its deadline,
+// so software that busy-loops sees real Altair timing.
+#define GOVERNOR_SLICE_US 1000
+#define GOVERNOR_MAX_LAG_US 20000
+#define GOVERNOR_MEASURE_INTERVAL_US 1000000
+#define UNLIMITED_SLICE_CYCLES 8000
+
+// The decode cache lives in the table-driven core
+#if I8080_DECODE_CACHE
+#define CPU_RUN_CORE i8080_run
+#elif I8080_TRACE
+// Only the table-driven core records the trace; use it while tracing is on
+static uint32_t cpu_run_core(intel8080_t* cpu, uint32_t cycle_budget)
+{
+    return trace_enabled ? i8080_run(cpu, cycle_budget) : i8080_run_fast(cpu, cycle_budget);
+}
+#define CPU_RUN_CORE cpu_run_core
+#else
+#define CPU_RUN_CORE i8080_run_fast
+#endif
+
+// On Wi-Fi boards slices go through the front panel sampler, which splits them
+// only while a browser is subscribed to the LEDs
+#if defined(CYW43_WL_GPIO_LED_PIN)
+static uint32_t cpu_run_panel(intel8080_t* cpu, uint32_t cycle_budget)
+{
+    return panel_sampler_run(cpu, cycle_budget, CPU_RUN_CORE);
+}
+#define CPU_RUN_PANEL cpu_run_panel
+#else
+#define CPU_RUN_PANEL CPU_RUN_CORE
+#endif
+
+// With the profiler built in, slices go through its sampling wrapper
+#if I8080_PROFILER
+#define CPU_RUN_SAMPLED(cpu, budget) profiler_run((cpu), (budget), CPU_RUN_PANEL)
+#else
+#define CPU_RUN_SAMPLED CPU_RUN_PANEL
+#endif
+
+// The debugger's guarded loop only runs while a breakpoint or watchpoint is set
+#if I8080_BREAKPOINTS
+#define CPU_RUN_SLICE(cpu, budget) \
+    (debugger_armed() ? debugger_run((cpu), (budget)) : CPU_RUN_SAMPLED((cpu), (budget)))
+#else
+#define CPU_RUN_SLICE CPU_RUN_SAMPLED
+#endif
+
+// 2SIO interrupts raise RST 7, the vector an Altair without a vectored
+// interrupt board sees on the bus
+#define SIO_INTERRUPT_RST 7
+
+static inline void poll_console_interrupt(void)
+{
+    if (sio2_interrupt_pending())
+    {
+        i8080_request_interrupt(&cpu, SIO_INTERRUPT_RST);
+    }
+}
+
+// Console idle: the CPU is spinning on an empty console port (see
+// i8080_in). Sleep until input arrives, an IRQ raises a CPU interrupt, the CPU
+// is stopped, or the deadline passes.
+#define CONSOLE_IDLE_WAIT_US 10000
+
+static void console_idle_wait(uint64_t deadline_us)
+{
+    uint64_t start = time_us_64();
+    bool input = false;
+    uint32_t latency_us = 0;
+
+#if defined(CYW43_WL_GPIO_LED_PIN)
+    // Core 1 signals an event when it queues input, which ends the WFE
+    absolute_time_t deadline = from_us_since_boot(deadline_us);
+    while (!(input = websocket_console_input_pending() || tcp_serial_input_pending()) && !cpu.int_pending &&
+           cpu_state_get_mode() == CPU_RUNNING)
+    {
+        if (best_effort_wfe_or_timeout(deadline))
+        {
+            break;
+        }
+    }
+    if (input && websocket_console_input_pending())
+    {
+        latency_us = time_us_32() - websocket_console_last_input_us();
+    }
+#else
+    // The program is waiting on the user; let them see what it wrote. USB and
+    // the CDC background task interrupt often enough to end the WFE.
+    usb_console_flush();
+    absolute_time_t deadline = from_us_since_boot(deadline_us);
+    while (!(input = usb_console_input_pending()) && !cpu.int_pending && cpu_state_get_mode() == CPU_RUNNING)
+    {
+        if (best_effort_wfe_or_timeout(deadline))
+        {
+            break;
+        }
+    }
+#endif
+
+    cpu_state_record_idle(time_us_64() - start, input, latency_us);
+}
+
+typedef struct
+{
+    CPU_CLOCK_PRESET preset;
+    uint64_t deadline_us;          // End of the current pacing slice
+    uint64_t last_slice_us;        // Used to detect resume after STOP
+    uint32_t carry;                // T-states the previous slice overshot its budget
+    uint64_t measure_start_us;     // Start of the emulated MHz measurement window
+    uint64_t measure_start_cycles;
+} clock_governor_t;
+
+static clock_governor_t governor = {.preset = CPU_CLOCK_UNLIMITED};
+
+static void clock_governor_restart(uint64_t now, CPU_CLOCK_PRESET preset)
+{
+    governor.preset = preset;
+    governor.deadline_us = now;
+    governor.carry = 0;
+    governor.measure_start_us = now;
+    governor.measure_start_cycles = cpu.cycles;
+}
+
+// Run one governed slice of emulation
+static void clock_governor_run_slice(void)
+{
+    uint64_t now = time_us_64();
+    CPU_CLOCK_PRESET preset = cpu_state_get_clock();
+
+    // Preset changed or the CPU was stopped: restart pacing and measurement
+    if (preset != governor.preset || now - governor.last_slice_us > GOVERNOR_MAX_LAG_US)
+    {
+        clock_governor_restart(now, preset);
+    }
+
+    poll_console_interrupt();
+    cpu.console_idle = false;
+
+    uint32_t hz = cpu_state_clock_hz(preset);
+    if (hz == 0)
+    {
+        CPU_RUN_SLICE(&cpu, UNLIMITED_SLICE_CYCLES);
+        sio2_flush();
+
+        if (cpu.console_idle)
+        {
+            console_idle_wait(time_us_64() + CONSOLE_IDLE_WAIT_US);
+        }
+        else if (cpu.halted)
+        {
+            // Halted: sleep until an IRQ or the other core signals an event
+            best_effort_wfe_or_timeout(make_timeout_time_us(GOVERNOR_SLICE_US));
+        }
+    }
+    else
+    {
+        uint32_t budget = hz / (1000000 / GOVERNOR_SLICE_US) - governor.carry;
+        uint32_t executed = CPU_RUN_SLICE(&cpu, budget);
+        sio2_flush();
+
+        // A slice cut short by console idle leaves nothing to carry
+        governor.carry = executed > budget ? executed - budget : 0;
+
+        governor.deadline_us += GOVERNOR_SLICE_US;
+        now = time_us_64();
+        if (governor.deadline_us > now)
+        {
+            if (cpu.console_idle)
+            {
+                console_idle_wait(governor.deadline_us);
+            }
+            else if (cpu.halted)
+            {
+                // Wake early on an event so an interrupt is taken promptly
+                best_effort_wfe_or_timeout(from_us_since_boot(governor.deadline_us));
+            }
+            else
+            {
+                sleep_until(from_us_since_boot(governor.deadline_us));
+            }
+        }
+        else if (now - governor.deadline_us > GOVERNOR_MAX_LAG_US)
+        {
+            // Host can't keep up with the preset; don't bank the debt
+            governor.deadline_us = now;
+        }
+    }
+
+#if I8080_BREAKPOINTS
+    debugger_hit_t hit;
+    if (debugger_take_hit(&hit))
+    {
+        monitor_debugger_stop(&hit);
+    }
+#endif
+
+    now = time_us_64();
+    governor.last_slice_us = now;
+
+    if (now - governor.measure_start_us >= GOVERNOR_MEASURE_INTERVAL_US)
+    {
+        uint64_t cycles = cpu.cycles - governor.measure_start_cycles;
+        cpu_state_set_measured_khz((uint32_t)(cycles * 1000 / (now - governor.measure_start_us)));
+        panel_sampler_set_clock((uint32_t)(cycles * 1000000 / (now - governor.measure_start_us)));
+        governor.measure_start_us = now;
+        governor.measure_start_cycles = cpu.cycles;
+    }
+}
+
 int main(void)
 {
     // Initialize stdio first
@@ -451,34 +729,31 @@ int main(void)
     printf("Loading disk boot loader ROM at 0xFF00...\n");
     loadDiskLoader(0xFF00);
 
-    // Set up disk controller structure for CPU
-#ifdef SD_CARD_SUPPORT
-    static disk_controller_t disk_controller = {.disk_select = (port_out)sd_disk_select,
-                                                .disk_status = (port_in)sd_disk_status,
-                                                .disk_function = (port_out)sd_disk_function,
-                                                .sector = (port_in)sd_disk_sector,
-                                                .write = (port_out)sd_disk_write,
-                                                .read = (port_in)sd_disk_read};
-#else
-    static disk_controller_t disk_controller = {.disk_select = (port_out)pico_disk_select,
-                                                .disk_status = (port_in)pico_disk_status,
-                                                .disk_function = (port_out)pico_disk_function,
-                                                .sector = (port_in)pico_disk_sector,
-                                                .write = (port_out)pico_disk_write,
-                                                .read = (port_in)pico_disk_read};
-#endif
-
-    // Store reference for reset function
-    g_disk_controller = &disk_controller;
+    // Attach the console, front panel switches and port drivers; the disk
+    // controller registered itself in its init
+    console_io_init(&cpu, terminal_read, terminal_write);
+    sio2_io_init(&cpu);
+    sio2_attach(0, &sio2_console);
+    sio2_attach(1, &sio2_tcp);
+    io_port_register(0xFF, sense_port_in, NULL, NULL);
+    io_ports_init();
+    g_machine_ready = true;
 
     // Reset and initialize the CPU
     printf("Initializing Intel 8080 CPU...\n");
-    i8080_reset(&cpu, terminal_read, terminal_write, sense, &disk_controller, io_port_in, io_port_out);
+    i8080_reset(&cpu, memory);
 
     // Set CPU to start at ROM_LOADER_ADDRESS (0xFF00) to boot from disk
     printf("Setting CPU to ROM_LOADER_ADDRESS (0xFF00) to boot from disk\n");
     i8080_examine(&cpu, 0xFF00);
 
+    // Resume the session saved by the monitor SAVE command, if there is one
+    if (snapshot_load())
+    {
+        printf("Resumed from snapshot at PC %04X\n", cpu.registers.pc);
+        bus_switches = cpu.address_bus;
+    }
+
     // Report basic memory usage at startup (static allocation only)
     extern char __StackLimit, __bss_end__;
     extern char __flash_binary_end;
@@ -541,10 +816,7 @@ int main(void)
         switch (mode)
         {
             case CPU_RUNNING:
-                for (int i = 0; i < 1000; ++i)
-                {
-                    i8080_cycle(&cpu);
-                }
+                clock_governor_run_slice();
                 break;
             case CPU_LOW_POWER:
                 i8080_cycle(&cpu);
@@ -552,6 +824,8 @@ int main(void)
                 break;
             case CPU_STOPPED:
             {
+                cpu_state_announce_stop();
+
                 uint8_t ch = 0;
                 if (websocket_console_try_dequeue_monitor_input(&ch))
                 {
@@ -565,6 +839,12 @@ int main(void)
                 break;
         }
 
+#if defined(CYW43_WL_GPIO_LED_PIN)
+        panel_sampler_poll(&cpu, mode == CPU_STOPPED);
+#else
+        usb_console_poll();
+#endif
+
 #ifdef DISPLAY_2_8_SUPPORT
         // Check if display update is pending (set by timer callback every 20ms)
         if (display_update_pending)
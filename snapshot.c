@@ -0,0 +1,370 @@
+#include "snapshot.h"
+
+#include "Altair8800/memory.h"
+#include "PortDrivers/sio2_io.h"
+#include "PortDrivers/time_io.h"
+#include "build_version.h"
+#include "cpu_state.h"
+#ifdef SD_CARD_SUPPORT
+#include "Altair8800/pico_88dcdd_sd_card.h"
+#else
+#include "Altair8800/pico_88dcdd_flash.h"
+#endif
+
+#include <string.h>
+
+// PackBits-style encoding. A control byte below 0x80 is followed by that
+// many plus one literal bytes; 0x80 and above repeats the next byte
+// (control - 0x80 + 3) times. Empty memory and unused sector buffers
+// collapse to a few bytes per 130.
+#define RLE_MAX_LITERAL 128
+#define RLE_MIN_RUN 3
+#define RLE_MAX_RUN (0x7F + RLE_MIN_RUN)
+
+#define STREAM_BUFFER_SIZE 256
+
+struct snapshot_stream
+{
+    bool ok;
+    uint32_t crc;
+    uint32_t payload_bytes; // Encoded bytes written, or left to read
+
+    // Encoder
+    uint8_t literal[RLE_MAX_LITERAL];
+    uint8_t literal_length;
+    uint8_t run_byte;
+    uint8_t run_length;
+
+    // Decoder
+    uint8_t remaining; // Bytes left in the current literal or run
+    bool in_run;
+
+    // Encoded bytes on their way to or from the backend
+    uint8_t buffer[STREAM_BUFFER_SIZE];
+    size_t buffer_length;
+    size_t buffer_position;
+};
+
+// CPU fields that make up the machine state; memory stays as i8080_reset()
+// set it (the opcode handlers and console callbacks are not part of
+// intel8080_t)
+typedef struct
+{
+    registers_t registers;
+    uint64_t cycles;
+    uint8_t int_line[8];
+    uint16_t address_bus;
+    uint8_t data_bus;
+    uint8_t current_op_code;
+    uint8_t cpu_status;
+    uint8_t ei_delay;
+    uint8_t halted;
+} snapshot_cpu_t;
+
+static snapshot_stream_t stream;
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t* data, size_t length)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (-(crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static void flush_output(snapshot_stream_t* s)
+{
+    if (s->buffer_length == 0 || !s->ok)
+    {
+        s->buffer_length = 0;
+        return;
+    }
+
+    s->crc = crc32_update(s->crc, s->buffer, s->buffer_length);
+    s->payload_bytes += (uint32_t)s->buffer_length;
+    if (!snapshot_storage_write(s->buffer, s->buffer_length))
+    {
+        s->ok = false;
+    }
+    s->buffer_length = 0;
+}
+
+static void emit(snapshot_stream_t* s, uint8_t value)
+{
+    s->buffer[s->buffer_length++] = value;
+    if (s->buffer_length == STREAM_BUFFER_SIZE)
+    {
+        flush_output(s);
+    }
+}
+
+static void flush_literals(snapshot_stream_t* s)
+{
+    if (s->literal_length == 0)
+    {
+        return;
+    }
+
+    emit(s, (uint8_t)(s->literal_length - 1));
+    for (uint8_t i = 0; i < s->literal_length; i++)
+    {
+        emit(s, s->literal[i]);
+    }
+    s->literal_length = 0;
+}
+
+static void flush_run(snapshot_stream_t* s)
+{
+    if (s->run_length >= RLE_MIN_RUN)
+    {
+        flush_literals(s);
+        emit(s, (uint8_t)(0x80 + s->run_length - RLE_MIN_RUN));
+        emit(s, s->run_byte);
+    }
+    else
+    {
+        // Too short to pay for a run
+        for (uint8_t i = 0; i < s->run_length; i++)
+        {
+            s->literal[s->literal_length++] = s->run_byte;
+            if (s->literal_length == RLE_MAX_LITERAL)
+            {
+                flush_literals(s);
+            }
+        }
+    }
+    s->run_length = 0;
+}
+
+bool snapshot_write(snapshot_stream_t* s, const void* data, size_t length)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    for (size_t i = 0; i < length && s->ok; i++)
+    {
+        if (s->run_length > 0 && (bytes[i] != s->run_byte || s->run_length == RLE_MAX_RUN))
+        {
+            flush_run(s);
+        }
+        s->run_byte = bytes[i];
+        s->run_length++;
+    }
+    return s->ok;
+}
+
+static bool fill_input(snapshot_stream_t* s)
+{
+    size_t chunk = s->payload_bytes < STREAM_BUFFER_SIZE ? s->payload_bytes : STREAM_BUFFER_SIZE;
+
+    if (chunk == 0 || !snapshot_storage_read(s->buffer, chunk))
+    {
+        s->ok = false;
+        return false;
+    }
+    s->payload_bytes -= (uint32_t)chunk;
+    s->buffer_length = chunk;
+    s->buffer_position = 0;
+    return true;
+}
+
+static bool next_encoded(snapshot_stream_t* s, uint8_t* value)
+{
+    if (s->buffer_position == s->buffer_length && !fill_input(s))
+    {
+        return false;
+    }
+    *value = s->buffer[s->buffer_position++];
+    return true;
+}
+
+bool snapshot_read(snapshot_stream_t* s, void* data, size_t length)
+{
+    uint8_t* bytes = (uint8_t*)data;
+
+    for (size_t i = 0; i < length && s->ok; i++)
+    {
+        if (s->remaining == 0)
+        {
+            uint8_t control;
+            if (!next_encoded(s, &control))
+            {
+                break;
+            }
+
+            s->in_run = control >= 0x80;
+            s->remaining = s->in_run ? (uint8_t)(control - 0x80 + RLE_MIN_RUN) : (uint8_t)(control + 1);
+            if (s->in_run && !next_encoded(s, &s->run_byte))
+            {
+                break;
+            }
+        }
+
+        if (!s->in_run && !next_encoded(s, &s->run_byte))
+        {
+            break;
+        }
+        bytes[i] = s->run_byte;
+        s->remaining--;
+    }
+    return s->ok;
+}
+
+static void save_cpu(snapshot_stream_t* s)
+{
+    snapshot_cpu_t state = {0};
+
+    state.registers = cpu.registers;
+    state.cycles = cpu.cycles;
+    for (int i = 0; i < 8; i++)
+    {
+        state.int_line[i] = cpu.int_line[i];
+    }
+    state.address_bus = cpu.address_bus;
+    state.data_bus = cpu.data_bus;
+    state.current_op_code = cpu.current_op_code;
+    state.cpu_status = cpu.cpuStatus;
+    state.ei_delay = cpu.ei_delay;
+    state.halted = cpu.halted;
+
+    snapshot_write(s, &state, sizeof(state));
+}
+
+static bool restore_cpu(snapshot_stream_t* s)
+{
+    snapshot_cpu_t state;
+
+    if (!snapshot_read(s, &state, sizeof(state)))
+    {
+        return false;
+    }
+
+    cpu.registers = state.registers;
+    cpu.cycles = state.cycles;
+    for (int i = 0; i < 8; i++)
+    {
+        cpu.int_line[i] = state.int_line[i];
+    }
+    cpu.address_bus = state.address_bus;
+    cpu.data_bus = state.data_bus;
+    cpu.current_op_code = state.current_op_code;
+    cpu.cpuStatus = state.cpu_status;
+    cpu.ei_delay = state.ei_delay;
+    cpu.halted = state.halted;
+
+    // Saved from a stopped CPU, so the flags are already resolved
+    memset(&cpu.lazy_flags, 0, sizeof(cpu.lazy_flags));
+    cpu.console_idle = false;
+    cpu.idle_polls = 0;
+    return true;
+}
+
+bool snapshot_save(void)
+{
+    memset(&stream, 0, sizeof(stream));
+    stream.ok = snapshot_storage_begin_write();
+
+    save_cpu(&stream);
+    snapshot_write(&stream, memory, sizeof(memory));
+#ifdef SD_CARD_SUPPORT
+    sd_disk_save_state(&stream);
+#else
+    pico_disk_save_state(&stream);
+#endif
+    time_io_save_state(&stream);
+    sio2_save_state(&stream);
+
+    flush_run(&stream);
+    flush_literals(&stream);
+    flush_output(&stream);
+
+    if (!stream.ok)
+    {
+        return false;
+    }
+
+    snapshot_header_t header = {.magic = SNAPSHOT_MAGIC,
+                                .version = SNAPSHOT_VERSION,
+                                .build = BUILD_VERSION,
+                                .payload_bytes = stream.payload_bytes,
+                                .checksum = stream.crc};
+    return snapshot_storage_finish_write(&header);
+}
+
+// Open the stored snapshot and check its header
+static bool begin_read(snapshot_header_t* header)
+{
+    if (!snapshot_storage_begin_read(header))
+    {
+        return false;
+    }
+
+    if (header->magic != SNAPSHOT_MAGIC || header->version != SNAPSHOT_VERSION || header->build != BUILD_VERSION)
+    {
+        snapshot_storage_end_read();
+        return false;
+    }
+    return true;
+}
+
+bool snapshot_exists(void)
+{
+    snapshot_header_t header;
+
+    if (!begin_read(&header))
+    {
+        return false;
+    }
+
+    // Check the whole payload before anything trusts it
+    uint32_t crc = 0;
+    uint32_t left = header.payload_bytes;
+    bool ok = true;
+
+    while (left > 0 && ok)
+    {
+        size_t chunk = left < STREAM_BUFFER_SIZE ? left : STREAM_BUFFER_SIZE;
+        ok = snapshot_storage_read(stream.buffer, chunk);
+        crc = crc32_update(crc, stream.buffer, chunk);
+        left -= (uint32_t)chunk;
+    }
+    snapshot_storage_end_read();
+
+    return ok && crc == header.checksum;
+}
+
+bool snapshot_load(void)
+{
+    snapshot_header_t header;
+
+    if (!snapshot_exists() || !begin_read(&header))
+    {
+        return false;
+    }
+
+    memset(&stream, 0, sizeof(stream));
+    stream.ok = true;
+    stream.payload_bytes = header.payload_bytes;
+
+    bool ok = restore_cpu(&stream) && snapshot_read(&stream, memory, sizeof(memory));
+#ifdef SD_CARD_SUPPORT
+    ok = ok && sd_disk_restore_state(&stream);
+#else
+    ok = ok && pico_disk_restore_state(&stream);
+#endif
+    ok = ok && time_io_restore_state(&stream);
+    ok = ok && sio2_restore_state(&stream);
+    snapshot_storage_end_read();
+
+    memory_mark_all_dirty();
+    return ok;
+}
+
+bool snapshot_erase(void)
+{
+    return snapshot_storage_erase();
+}
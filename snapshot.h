@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Machine snapshots: CPU registers, the 64 KB of Altair memory, the disk
+// controller (including the flash build's patch pool), the port timers and
+// the 2SIO channels.
+// The payload is run-length encoded and stored by a backend: snapshot_flash.c
+// (a reserved flash region) or snapshot_sd.c (a file on the SD card).
+
+#define SNAPSHOT_MAGIC 0x50414E53 // "SNAP" in hex
+#define SNAPSHOT_VERSION 2
+
+// Stored ahead of the payload
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;       // SNAPSHOT_VERSION
+    uint32_t build;         // BUILD_VERSION; embedded disk images change between builds
+    uint32_t payload_bytes; // Encoded length
+    uint32_t checksum;      // CRC32 of the encoded payload
+} snapshot_header_t;
+
+// Sections call these to move their state through the RLE coder
+typedef struct snapshot_stream snapshot_stream_t;
+
+bool snapshot_write(snapshot_stream_t* stream, const void* data, size_t length);
+bool snapshot_read(snapshot_stream_t* stream, void* data, size_t length);
+
+// Capture the stopped machine. Returns false if the backend ran out of room
+// or failed to write.
+bool snapshot_save(void);
+
+// Replace the machine state with the stored snapshot. Nothing is changed
+// unless the snapshot is present, intact and from this build.
+bool snapshot_load(void);
+
+// A valid snapshot from this build is stored
+bool snapshot_exists(void);
+
+// Drop the stored snapshot so the next power-on cold boots
+bool snapshot_erase(void);
+
+// Backend interface (snapshot_flash.c, snapshot_sd.c). Payload bytes are
+// written in order after begin_write; the header goes in last, so an
+// interrupted save leaves no valid snapshot behind.
+bool snapshot_storage_begin_write(void);
+bool snapshot_storage_write(const uint8_t* data, size_t length);
+bool snapshot_storage_finish_write(const snapshot_header_t* header);
+bool snapshot_storage_begin_read(snapshot_header_t* header);
+bool snapshot_storage_read(uint8_t* data, size_t length);
+void snapshot_storage_end_read(void);
+bool snapshot_storage_erase(void);
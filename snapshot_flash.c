@@ -0,0 +1,171 @@
+#include "snapshot.h"
+
+#include "hardware/flash.h"
+#include "pico/flash.h"
+#include "pico/stdlib.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Snapshot region: the 256 KB below the WiFi credentials sector at the top of
+// flash. Its first sector holds only the header; the payload follows.
+// 64 KB of memory plus a full patch pool fits even without compression.
+#ifndef PICO_FLASH_SIZE_BYTES
+#define PICO_FLASH_SIZE_BYTES (2 * 1024 * 1024) // Default to 2MB if not defined
+#endif
+
+#define SNAPSHOT_FLASH_SIZE (256 * 1024)
+#define SNAPSHOT_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE - SNAPSHOT_FLASH_SIZE)
+#define SNAPSHOT_PAYLOAD_OFFSET (SNAPSHOT_FLASH_OFFSET + FLASH_SECTOR_SIZE)
+#define SNAPSHOT_PAYLOAD_MAX (SNAPSHOT_FLASH_SIZE - FLASH_SECTOR_SIZE)
+
+// Core 1 runs the network stack from flash; flash_safe_execute() parks it
+// while a sector is rewritten
+#define SNAPSHOT_FLASH_TIMEOUT_MS 100
+
+typedef struct
+{
+    uint32_t offset;
+    bool erase;          // Erase the sector at offset first
+    const uint8_t* data; // NULL: nothing to program
+    size_t length;
+} flash_op_t;
+
+static uint8_t sector_buffer[FLASH_SECTOR_SIZE];
+static size_t sector_fill;
+static uint32_t write_offset; // Payload bytes already in flash
+static uint32_t read_offset;
+
+static void do_flash_op(void* param)
+{
+    const flash_op_t* op = (const flash_op_t*)param;
+
+    if (op->erase)
+    {
+        flash_range_erase(op->offset, FLASH_SECTOR_SIZE);
+    }
+    if (op->data)
+    {
+        flash_range_program(op->offset, op->data, op->length);
+    }
+}
+
+static bool flash_op(uint32_t offset, bool erase, const uint8_t* data, size_t length)
+{
+    flash_op_t op = {.offset = offset, .erase = erase, .data = data, .length = length};
+    int result = flash_safe_execute(do_flash_op, &op, SNAPSHOT_FLASH_TIMEOUT_MS);
+
+    if (result != PICO_OK)
+    {
+        printf("[SNAPSHOT] Flash write at 0x%08lx failed (%d)\n", (unsigned long)offset, result);
+        return false;
+    }
+    return true;
+}
+
+static bool flush_sector(void)
+{
+    if (sector_fill == 0)
+    {
+        return true;
+    }
+
+    // Program whole pages; the unused tail stays erased
+    memset(sector_buffer + sector_fill, 0xFF, FLASH_SECTOR_SIZE - sector_fill);
+    size_t length = (sector_fill + FLASH_PAGE_SIZE - 1) & ~(size_t)(FLASH_PAGE_SIZE - 1);
+
+    bool ok = flash_op(SNAPSHOT_PAYLOAD_OFFSET + write_offset, true, sector_buffer, length);
+    write_offset += FLASH_SECTOR_SIZE;
+    sector_fill = 0;
+    return ok;
+}
+
+bool snapshot_storage_begin_write(void)
+{
+    extern char __flash_binary_end;
+    uint32_t binary_end = (uint32_t)((uintptr_t)&__flash_binary_end - XIP_BASE);
+
+    if (binary_end > SNAPSHOT_FLASH_OFFSET)
+    {
+        printf("[SNAPSHOT] Firmware overlaps the snapshot region\n");
+        return false;
+    }
+
+    sector_fill = 0;
+    write_offset = 0;
+
+    // Invalidate the old snapshot before any of it is overwritten
+    return flash_op(SNAPSHOT_FLASH_OFFSET, true, NULL, 0);
+}
+
+bool snapshot_storage_write(const uint8_t* data, size_t length)
+{
+    while (length > 0)
+    {
+        if (write_offset + sector_fill + length > SNAPSHOT_PAYLOAD_MAX)
+        {
+            printf("[SNAPSHOT] Snapshot does not fit in %u KB\n", SNAPSHOT_PAYLOAD_MAX / 1024);
+            return false;
+        }
+
+        size_t chunk = FLASH_SECTOR_SIZE - sector_fill;
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+
+        memcpy(sector_buffer + sector_fill, data, chunk);
+        sector_fill += chunk;
+        data += chunk;
+        length -= chunk;
+
+        if (sector_fill == FLASH_SECTOR_SIZE && !flush_sector())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool snapshot_storage_finish_write(const snapshot_header_t* header)
+{
+    if (!flush_sector())
+    {
+        return false;
+    }
+
+    // The header sector was erased by begin_write and programs last
+    static uint8_t page[FLASH_PAGE_SIZE];
+    memset(page, 0xFF, sizeof(page));
+    memcpy(page, header, sizeof(*header));
+
+    return flash_op(SNAPSHOT_FLASH_OFFSET, false, page, sizeof(page));
+}
+
+bool snapshot_storage_begin_read(snapshot_header_t* header)
+{
+    memcpy(header, (const void*)(XIP_BASE + SNAPSHOT_FLASH_OFFSET), sizeof(*header));
+    read_offset = 0;
+    return header->payload_bytes <= SNAPSHOT_PAYLOAD_MAX;
+}
+
+bool snapshot_storage_read(uint8_t* data, size_t length)
+{
+    if (read_offset + length > SNAPSHOT_PAYLOAD_MAX)
+    {
+        return false;
+    }
+
+    memcpy(data, (const void*)(XIP_BASE + SNAPSHOT_PAYLOAD_OFFSET + read_offset), length);
+    read_offset += (uint32_t)length;
+    return true;
+}
+
+void snapshot_storage_end_read(void)
+{
+}
+
+bool snapshot_storage_erase(void)
+{
+    return flash_op(SNAPSHOT_FLASH_OFFSET, true, NULL, 0);
+}
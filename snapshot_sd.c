@@ -0,0 +1,89 @@
+#include "snapshot.h"
+
+#include "ff.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Snapshot file on the SD card, next to the disk images
+#define SNAPSHOT_PATH "Disks/snapshot.bin"
+
+static FIL snapshot_file;
+
+bool snapshot_storage_begin_write(void)
+{
+    FRESULT fr = f_open(&snapshot_file, SNAPSHOT_PATH, FA_CREATE_ALWAYS | FA_WRITE);
+    if (fr != FR_OK)
+    {
+        printf("[SNAPSHOT] Failed to create %s, error: %d\n", SNAPSHOT_PATH, fr);
+        return false;
+    }
+
+    // Zeroed header until the payload is complete
+    snapshot_header_t header = {0};
+    UINT written;
+    fr = f_write(&snapshot_file, &header, sizeof(header), &written);
+    if (fr != FR_OK || written != sizeof(header))
+    {
+        f_close(&snapshot_file);
+        return false;
+    }
+    return true;
+}
+
+bool snapshot_storage_write(const uint8_t* data, size_t length)
+{
+    UINT written;
+    FRESULT fr = f_write(&snapshot_file, data, (UINT)length, &written);
+
+    if (fr != FR_OK || written != length)
+    {
+        printf("[SNAPSHOT] Write failed, error: %d\n", fr);
+        f_close(&snapshot_file);
+        return false;
+    }
+    return true;
+}
+
+bool snapshot_storage_finish_write(const snapshot_header_t* header)
+{
+    UINT written;
+    bool ok = f_lseek(&snapshot_file, 0) == FR_OK &&
+              f_write(&snapshot_file, header, sizeof(*header), &written) == FR_OK && written == sizeof(*header);
+
+    return f_close(&snapshot_file) == FR_OK && ok;
+}
+
+bool snapshot_storage_begin_read(snapshot_header_t* header)
+{
+    UINT bytes_read;
+
+    if (f_open(&snapshot_file, SNAPSHOT_PATH, FA_READ) != FR_OK)
+    {
+        return false;
+    }
+
+    if (f_read(&snapshot_file, header, sizeof(*header), &bytes_read) != FR_OK || bytes_read != sizeof(*header))
+    {
+        f_close(&snapshot_file);
+        return false;
+    }
+    return true;
+}
+
+bool snapshot_storage_read(uint8_t* data, size_t length)
+{
+    UINT bytes_read;
+    return f_read(&snapshot_file, data, (UINT)length, &bytes_read) == FR_OK && bytes_read == length;
+}
+
+void snapshot_storage_end_read(void)
+{
+    f_close(&snapshot_file);
+}
+
+bool snapshot_storage_erase(void)
+{
+    FRESULT fr = f_unlink(SNAPSHOT_PATH);
+    return fr == FR_OK || fr == FR_NO_FILE;
+}
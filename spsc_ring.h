@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Lock-free single-producer/single-consumer byte ring for passing a stream
+// from one core to the other. Only the producer moves head and only the
+// consumer moves tail; each side publishes its index with a release store
+// after touching the bytes, so no spinlock is taken. head and tail run freely
+// and wrap at 2^32; size must be a power of two.
+//
+// The consumer reads in place: spsc_ring_peek() returns the longest
+// contiguous run of waiting bytes and spsc_ring_commit() releases them once
+// they have been sent.
+//
+// A consumer serving several readers can instead keep one stream position
+// (a head/tail value) per reader, read with spsc_ring_peek_at() and release
+// with spsc_ring_release_to() once the slowest reader has moved on.
+
+typedef struct
+{
+    uint8_t* buffer;
+    uint32_t mask;          // size - 1
+    volatile uint32_t head; // Bytes ever written (producer)
+    volatile uint32_t tail; // Bytes ever consumed (consumer)
+} spsc_ring_t;
+
+static inline void spsc_ring_init(spsc_ring_t* ring, uint8_t* storage, uint32_t size)
+{
+    ring->buffer = storage;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+}
+
+static inline uint32_t spsc_ring_count(const spsc_ring_t* ring)
+{
+    return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+}
+
+static inline bool spsc_ring_is_empty(const spsc_ring_t* ring)
+{
+    return spsc_ring_count(ring) == 0;
+}
+
+// Producer: copy in as much of data as fits, in at most two runs. Returns the
+// number of bytes taken.
+static inline size_t spsc_ring_enqueue_bytes(spsc_ring_t* ring, const uint8_t* data, size_t length)
+{
+    uint32_t head = ring->head;
+    uint32_t space = ring->mask + 1 - (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE));
+
+    if (length > space)
+    {
+        length = space;
+    }
+
+    uint32_t offset = head & ring->mask;
+    size_t first = ring->mask + 1 - offset;
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy(&ring->buffer[offset], data, first);
+    memcpy(ring->buffer, data + first, length - first);
+
+    __atomic_store_n(&ring->head, head + (uint32_t)length, __ATOMIC_RELEASE);
+    return length;
+}
+
+// Consumer: the stream position the next enqueued byte will take
+static inline uint32_t spsc_ring_head(const spsc_ring_t* ring)
+{
+    return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+}
+
+// Consumer: point data at the byte at stream position (between tail and head)
+// and return how many follow it without wrapping
+static inline size_t spsc_ring_peek_at(const spsc_ring_t* ring, uint32_t position, const uint8_t** data)
+{
+    uint32_t count = spsc_ring_head(ring) - position;
+    uint32_t offset = position & ring->mask;
+    uint32_t contiguous = ring->mask + 1 - offset;
+
+    *data = &ring->buffer[offset];
+    return count < contiguous ? count : contiguous;
+}
+
+// Consumer: point data at the oldest waiting byte and return how many follow
+// it without wrapping
+static inline size_t spsc_ring_peek(const spsc_ring_t* ring, const uint8_t** data)
+{
+    return spsc_ring_peek_at(ring, ring->tail, data);
+}
+
+// Consumer: release length bytes returned by spsc_ring_peek()
+static inline void spsc_ring_commit(spsc_ring_t* ring, size_t length)
+{
+    __atomic_store_n(&ring->tail, ring->tail + (uint32_t)length, __ATOMIC_RELEASE);
+}
+
+// Consumer: release every byte before stream position
+static inline void spsc_ring_release_to(spsc_ring_t* ring, uint32_t position)
+{
+    __atomic_store_n(&ring->tail, position, __ATOMIC_RELEASE);
+}
+
+// Consumer: drop everything waiting
+static inline void spsc_ring_discard(spsc_ring_t* ring)
+{
+    __atomic_store_n(&ring->tail, __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
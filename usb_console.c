@@ -0,0 +1,99 @@
+#include "usb_console.h"
+
+#include "pico/stdio_usb.h"
+#include "pico/time.h"
+
+#include <string.h>
+
+// Output waiting for a packet's worth, and when its first byte arrived
+static uint8_t out_buffer[USB_CONSOLE_PACKET];
+static size_t out_count;
+static uint64_t out_since_us;
+
+// The last packet read, and how much of it is handed out
+static uint8_t in_buffer[USB_CONSOLE_PACKET];
+static size_t in_count;
+static size_t in_next;
+
+void usb_console_flush(void)
+{
+    if (out_count > 0)
+    {
+        // Straight to the CDC driver, which writes the lot under its own lock
+        // and blocks while the host is not reading, as putchar() did
+        stdio_usb.out_chars((const char*)out_buffer, (int)out_count);
+        out_count = 0;
+    }
+}
+
+void usb_console_write(const uint8_t* data, size_t length)
+{
+    while (length > 0)
+    {
+        if (out_count == 0)
+        {
+            out_since_us = time_us_64();
+        }
+
+        size_t chunk = USB_CONSOLE_PACKET - out_count;
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+        memcpy(&out_buffer[out_count], data, chunk);
+        out_count += chunk;
+        data += chunk;
+        length -= chunk;
+
+        if (out_count == USB_CONSOLE_PACKET)
+        {
+            usb_console_flush();
+        }
+    }
+}
+
+void usb_console_put(uint8_t value)
+{
+    if (out_count == 0)
+    {
+        out_since_us = time_us_64();
+    }
+
+    out_buffer[out_count++] = value;
+    if (out_count == USB_CONSOLE_PACKET)
+    {
+        usb_console_flush();
+    }
+}
+
+void usb_console_poll(void)
+{
+    if (out_count > 0 && time_us_64() - out_since_us >= USB_CONSOLE_FLUSH_US)
+    {
+        usb_console_flush();
+    }
+}
+
+// Read the next packet once the last one is used up
+static bool fill_input(void)
+{
+    if (in_next < in_count)
+    {
+        return true;
+    }
+
+    int count = stdio_usb.in_chars((char*)in_buffer, sizeof(in_buffer));
+    in_count = count > 0 ? (size_t)count : 0;
+    in_next = 0;
+    return in_count > 0;
+}
+
+int usb_console_read(void)
+{
+    return fill_input() ? in_buffer[in_next++] : -1;
+}
+
+bool usb_console_input_pending(void)
+{
+    return fill_input();
+}
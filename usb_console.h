@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Buffered USB CDC console for boards without Wi-Fi (core 0 only).
+//
+// putchar() takes the stdio driver stack and the TinyUSB CDC write path for
+// every byte, and the CDC driver flushes each call as its own USB packet.
+// Here output collects in a packet-sized buffer that is written to the CDC
+// driver in one call when it fills, or once it has waited USB_CONSOLE_FLUSH_US
+// (one USB frame, the most the host would have waited for the packet anyway).
+// Input is read from the driver a packet at a time and handed out from a
+// buffer.
+
+#define USB_CONSOLE_PACKET 64      // Full-speed bulk packet
+#define USB_CONSOLE_FLUSH_US 1000  // Longest a byte waits for the buffer to fill
+
+// Queue console output
+void usb_console_write(const uint8_t* data, size_t length);
+void usb_console_put(uint8_t value);
+
+// Write out whatever is buffered
+void usb_console_flush(void);
+
+// Flush once the oldest buffered byte has waited USB_CONSOLE_FLUSH_US; call
+// from the main loop
+void usb_console_poll(void);
+
+// Next input byte, or -1 if none
+int usb_console_read(void);
+
+// True when input is waiting
+bool usb_console_input_pending(void);
@@ -0,0 +1,779 @@
+#include "vt_screen.h"
+
+#include <string.h>
+
+#define ASCII_BS 0x08
+#define ASCII_HT 0x09
+#define ASCII_LF 0x0A
+#define ASCII_VT 0x0B
+#define ASCII_FF 0x0C
+#define ASCII_CR 0x0D
+#define ASCII_CAN 0x18
+#define ASCII_SUB 0x1A
+#define ASCII_ESC 0x1B
+#define ASCII_DEL 0x7F
+
+#define VT_TAB_WIDTH 8
+#define VT_PARAM_MAX 9999
+#define VT_SKIP_MAX 4 // Unchanged cells rewritten rather than moving the cursor past them
+
+enum
+{
+    VT_GROUND,
+    VT_ESCAPE,
+    VT_ESCAPE_SKIP, // ESC ( ) # and friends: one more byte follows
+    VT_CSI,
+    VT_OSC, // Until BEL or ESC
+};
+
+static const vt_cell_t blank_cell = {' ', 0};
+
+static vt_cell_t* screen_row(vt_screen_t* screen, uint8_t row)
+{
+    return screen->cells[screen->line[row]];
+}
+
+static const vt_cell_t* screen_row_const(const vt_screen_t* screen, uint8_t row)
+{
+    return screen->cells[screen->line[row]];
+}
+
+static bool cell_blank(const vt_cell_t* cell)
+{
+    return cell->ch == ' ' && cell->attr == 0;
+}
+
+static bool cell_equal(const vt_cell_t* a, const vt_cell_t* b)
+{
+    return a->ch == b->ch && a->attr == b->attr;
+}
+
+static void clear_cells(vt_cell_t* cells, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        cells[i] = blank_cell;
+    }
+}
+
+// === Model ===
+
+// Move rows top..bottom up by count, blanking the rows that come in at bottom
+static void scroll_up(vt_screen_t* screen, uint8_t top, uint8_t bottom, uint16_t count)
+{
+    uint8_t height = bottom - top + 1;
+    if (count > height)
+    {
+        count = height;
+    }
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        uint8_t first = screen->line[top];
+        memmove(&screen->line[top], &screen->line[top + 1], height - 1);
+        screen->line[bottom] = first;
+        clear_cells(screen->cells[first], VT_SCREEN_COLS);
+    }
+}
+
+static void scroll_down(vt_screen_t* screen, uint8_t top, uint8_t bottom, uint16_t count)
+{
+    uint8_t height = bottom - top + 1;
+    if (count > height)
+    {
+        count = height;
+    }
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        uint8_t last = screen->line[bottom];
+        memmove(&screen->line[top + 1], &screen->line[top], height - 1);
+        screen->line[top] = last;
+        clear_cells(screen->cells[last], VT_SCREEN_COLS);
+    }
+}
+
+static void line_feed(vt_screen_t* screen)
+{
+    if (screen->row == screen->bottom)
+    {
+        scroll_up(screen, screen->top, screen->bottom, 1);
+    }
+    else if (screen->row < VT_SCREEN_ROWS - 1)
+    {
+        screen->row++;
+    }
+}
+
+static void reverse_line_feed(vt_screen_t* screen)
+{
+    if (screen->row == screen->top)
+    {
+        scroll_down(screen, screen->top, screen->bottom, 1);
+    }
+    else if (screen->row > 0)
+    {
+        screen->row--;
+    }
+}
+
+static void put_char(vt_screen_t* screen, uint8_t ch)
+{
+    if (screen->wrap_pending)
+    {
+        screen->wrap_pending = false;
+        screen->col = 0;
+        line_feed(screen);
+    }
+
+    vt_cell_t* cell = &screen_row(screen, screen->row)[screen->col];
+    cell->ch = ch;
+    cell->attr = screen->attr;
+
+    if (screen->col == VT_SCREEN_COLS - 1)
+    {
+        screen->wrap_pending = true;
+    }
+    else
+    {
+        screen->col++;
+    }
+}
+
+static void move_to(vt_screen_t* screen, int row, int col)
+{
+    screen->row = (uint8_t)(row < 0 ? 0 : row >= VT_SCREEN_ROWS ? VT_SCREEN_ROWS - 1 : row);
+    screen->col = (uint8_t)(col < 0 ? 0 : col >= VT_SCREEN_COLS ? VT_SCREEN_COLS - 1 : col);
+    screen->wrap_pending = false;
+}
+
+// Execute a C0 control; returns false for bytes that are not one
+static bool execute_control(vt_screen_t* screen, uint8_t ch)
+{
+    switch (ch)
+    {
+        case ASCII_BS:
+            move_to(screen, screen->row, screen->col - 1);
+            return true;
+        case ASCII_HT:
+            move_to(screen, screen->row, (screen->col / VT_TAB_WIDTH + 1) * VT_TAB_WIDTH);
+            return true;
+        case ASCII_LF:
+        case ASCII_VT:
+        case ASCII_FF:
+            screen->wrap_pending = false;
+            line_feed(screen);
+            return true;
+        case ASCII_CR:
+            screen->col = 0;
+            screen->wrap_pending = false;
+            return true;
+        case ASCII_CAN:
+        case ASCII_SUB:
+            screen->state = VT_GROUND;
+            return true;
+        default:
+            return ch < 0x20; // BEL, SO, SI and the rest change nothing on screen
+    }
+}
+
+static uint16_t param(const vt_screen_t* screen, uint8_t index, uint16_t fallback)
+{
+    if (index >= screen->param_count || screen->params[index] == 0)
+    {
+        return fallback;
+    }
+    return screen->params[index];
+}
+
+static void erase_in_display(vt_screen_t* screen, uint16_t mode)
+{
+    vt_cell_t* cursor_row = screen_row(screen, screen->row);
+
+    switch (mode)
+    {
+        case 0: // Cursor to end
+            clear_cells(&cursor_row[screen->col], VT_SCREEN_COLS - screen->col);
+            for (uint8_t row = screen->row + 1; row < VT_SCREEN_ROWS; row++)
+            {
+                clear_cells(screen_row(screen, row), VT_SCREEN_COLS);
+            }
+            break;
+        case 1: // Start to cursor
+            for (uint8_t row = 0; row < screen->row; row++)
+            {
+                clear_cells(screen_row(screen, row), VT_SCREEN_COLS);
+            }
+            clear_cells(cursor_row, screen->col + 1);
+            break;
+        case 2:
+        case 3:
+            for (uint8_t row = 0; row < VT_SCREEN_ROWS; row++)
+            {
+                clear_cells(screen_row(screen, row), VT_SCREEN_COLS);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void erase_in_line(vt_screen_t* screen, uint16_t mode)
+{
+    vt_cell_t* cells = screen_row(screen, screen->row);
+
+    switch (mode)
+    {
+        case 0:
+            clear_cells(&cells[screen->col], VT_SCREEN_COLS - screen->col);
+            break;
+        case 1:
+            clear_cells(cells, screen->col + 1);
+            break;
+        case 2:
+            clear_cells(cells, VT_SCREEN_COLS);
+            break;
+        default:
+            break;
+    }
+}
+
+static void select_graphic_rendition(vt_screen_t* screen)
+{
+    if (screen->param_count == 0)
+    {
+        screen->attr = 0;
+        return;
+    }
+
+    for (uint8_t i = 0; i < screen->param_count; i++)
+    {
+        switch (screen->params[i])
+        {
+            case 0:
+                screen->attr = 0;
+                break;
+            case 1:
+                screen->attr |= VT_ATTR_BOLD;
+                break;
+            case 4:
+                screen->attr |= VT_ATTR_UNDERLINE;
+                break;
+            case 5:
+                screen->attr |= VT_ATTR_BLINK;
+                break;
+            case 7:
+                screen->attr |= VT_ATTR_REVERSE;
+                break;
+            case 22:
+                screen->attr &= (uint8_t)~VT_ATTR_BOLD;
+                break;
+            case 24:
+                screen->attr &= (uint8_t)~VT_ATTR_UNDERLINE;
+                break;
+            case 25:
+                screen->attr &= (uint8_t)~VT_ATTR_BLINK;
+                break;
+            case 27:
+                screen->attr &= (uint8_t)~VT_ATTR_REVERSE;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void execute_csi(vt_screen_t* screen, uint8_t final)
+{
+    uint16_t n = param(screen, 0, 1);
+    vt_cell_t* cells = screen_row(screen, screen->row);
+    bool in_region = screen->row >= screen->top && screen->row <= screen->bottom;
+
+    switch (final)
+    {
+        case 'A':
+        {
+            int limit = screen->row >= screen->top ? screen->top : 0;
+            int row = screen->row - n;
+            move_to(screen, row < limit ? limit : row, screen->col);
+            break;
+        }
+        case 'B':
+        {
+            int limit = screen->row <= screen->bottom ? screen->bottom : VT_SCREEN_ROWS - 1;
+            int row = screen->row + n;
+            move_to(screen, row > limit ? limit : row, screen->col);
+            break;
+        }
+        case 'C':
+            move_to(screen, screen->row, screen->col + n);
+            break;
+        case 'D':
+            move_to(screen, screen->row, screen->col - n);
+            break;
+        case 'G':
+            move_to(screen, screen->row, n - 1);
+            break;
+        case 'd':
+            move_to(screen, n - 1, screen->col);
+            break;
+        case 'H':
+        case 'f':
+            move_to(screen, n - 1, param(screen, 1, 1) - 1);
+            break;
+        case 'J':
+            erase_in_display(screen, param(screen, 0, 0));
+            break;
+        case 'K':
+            erase_in_line(screen, param(screen, 0, 0));
+            break;
+        case 'L':
+            if (in_region)
+            {
+                scroll_down(screen, screen->row, screen->bottom, n);
+                move_to(screen, screen->row, 0);
+            }
+            break;
+        case 'M':
+            if (in_region)
+            {
+                scroll_up(screen, screen->row, screen->bottom, n);
+                move_to(screen, screen->row, 0);
+            }
+            break;
+        case 'P':
+        {
+            uint8_t count = (uint8_t)(n > VT_SCREEN_COLS - screen->col ? VT_SCREEN_COLS - screen->col : n);
+            memmove(&cells[screen->col], &cells[screen->col + count],
+                    (VT_SCREEN_COLS - screen->col - count) * sizeof(vt_cell_t));
+            clear_cells(&cells[VT_SCREEN_COLS - count], count);
+            screen->wrap_pending = false;
+            break;
+        }
+        case '@':
+        {
+            uint8_t count = (uint8_t)(n > VT_SCREEN_COLS - screen->col ? VT_SCREEN_COLS - screen->col : n);
+            memmove(&cells[screen->col + count], &cells[screen->col],
+                    (VT_SCREEN_COLS - screen->col - count) * sizeof(vt_cell_t));
+            clear_cells(&cells[screen->col], count);
+            screen->wrap_pending = false;
+            break;
+        }
+        case 'X':
+        {
+            uint8_t count = (uint8_t)(n > VT_SCREEN_COLS - screen->col ? VT_SCREEN_COLS - screen->col : n);
+            clear_cells(&cells[screen->col], count);
+            screen->wrap_pending = false;
+            break;
+        }
+        case 'm':
+            select_graphic_rendition(screen);
+            break;
+        case 'r':
+        {
+            uint16_t top = param(screen, 0, 1);
+            uint16_t bottom = param(screen, 1, VT_SCREEN_ROWS);
+            if (top < bottom && bottom <= VT_SCREEN_ROWS)
+            {
+                screen->top = (uint8_t)(top - 1);
+                screen->bottom = (uint8_t)(bottom - 1);
+                move_to(screen, 0, 0);
+            }
+            break;
+        }
+        case 's':
+            screen->saved_row = screen->row;
+            screen->saved_col = screen->col;
+            screen->saved_attr = screen->attr;
+            break;
+        case 'u':
+            move_to(screen, screen->saved_row, screen->saved_col);
+            screen->attr = screen->saved_attr;
+            break;
+        default:
+            break;
+    }
+}
+
+static void execute_escape(vt_screen_t* screen, uint8_t ch)
+{
+    screen->state = VT_GROUND;
+
+    switch (ch)
+    {
+        case '[':
+            screen->state = VT_CSI;
+            screen->param_count = 0;
+            screen->private_marker = false;
+            memset(screen->params, 0, sizeof(screen->params));
+            break;
+        case ']':
+            screen->state = VT_OSC;
+            break;
+        case '(':
+        case ')':
+        case '*':
+        case '+':
+        case '#':
+            screen->state = VT_ESCAPE_SKIP;
+            break;
+        case '7':
+            screen->saved_row = screen->row;
+            screen->saved_col = screen->col;
+            screen->saved_attr = screen->attr;
+            break;
+        case '8':
+            move_to(screen, screen->saved_row, screen->saved_col);
+            screen->attr = screen->saved_attr;
+            break;
+        case 'D':
+            screen->wrap_pending = false;
+            line_feed(screen);
+            break;
+        case 'E':
+            screen->col = 0;
+            screen->wrap_pending = false;
+            line_feed(screen);
+            break;
+        case 'M':
+            screen->wrap_pending = false;
+            reverse_line_feed(screen);
+            break;
+        case 'c':
+            vt_screen_reset(screen);
+            break;
+        default:
+            break;
+    }
+}
+
+static void parse_csi(vt_screen_t* screen, uint8_t ch)
+{
+    if (ch >= '0' && ch <= '9')
+    {
+        if (screen->param_count == 0)
+        {
+            screen->param_count = 1;
+        }
+        uint16_t* value = &screen->params[screen->param_count - 1];
+        *value = (uint16_t)(*value * 10 + (ch - '0'));
+        if (*value > VT_PARAM_MAX)
+        {
+            *value = VT_PARAM_MAX;
+        }
+    }
+    else if (ch == ';')
+    {
+        if (screen->param_count == 0)
+        {
+            screen->param_count = 1;
+        }
+        if (screen->param_count < VT_SCREEN_MAX_PARAMS)
+        {
+            screen->param_count++;
+        }
+    }
+    else if (ch >= '<' && ch <= '?')
+    {
+        screen->private_marker = true; // DEC private modes and the like: not modelled
+    }
+    else if (ch >= 0x40 && ch <= 0x7E)
+    {
+        screen->state = VT_GROUND;
+        if (!screen->private_marker)
+        {
+            execute_csi(screen, ch);
+        }
+    }
+    // Intermediate bytes (0x20-0x2F) are consumed
+}
+
+void vt_screen_reset(vt_screen_t* screen)
+{
+    memset(screen, 0, sizeof(*screen));
+    for (uint8_t row = 0; row < VT_SCREEN_ROWS; row++)
+    {
+        screen->line[row] = row;
+        clear_cells(screen->cells[row], VT_SCREEN_COLS);
+    }
+    screen->bottom = VT_SCREEN_ROWS - 1;
+}
+
+void vt_screen_feed(vt_screen_t* screen, const uint8_t* data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t ch = data[i] & 0x7F;
+
+        // CAN and SUB abort a string as they do any other sequence
+        if (screen->state == VT_OSC)
+        {
+            if (ch == 0x07 || ch == ASCII_CAN || ch == ASCII_SUB || ch == ASCII_ESC)
+            {
+                screen->state = ch == ASCII_ESC ? VT_ESCAPE : VT_GROUND;
+            }
+            continue;
+        }
+
+        if (ch == ASCII_ESC)
+        {
+            screen->state = VT_ESCAPE;
+            continue;
+        }
+
+        // Controls act even in the middle of a sequence, as on a VT100
+        if (execute_control(screen, ch))
+        {
+            continue;
+        }
+
+        switch (screen->state)
+        {
+            case VT_ESCAPE:
+                execute_escape(screen, ch);
+                break;
+            case VT_ESCAPE_SKIP:
+                screen->state = VT_GROUND;
+                break;
+            case VT_CSI:
+                parse_csi(screen, ch);
+                break;
+            default:
+                if (ch != ASCII_DEL)
+                {
+                    put_char(screen, ch);
+                }
+                break;
+        }
+    }
+}
+
+// === Output ===
+
+// A terminal being driven towards a model, and the bytes that drive it
+typedef struct
+{
+    uint8_t* out;
+    size_t length;
+    size_t max_len;
+    bool overflow;
+    uint8_t row;
+    uint8_t col;
+    bool cursor_known; // False after printing in the last column
+    uint8_t attr;
+} vt_writer_t;
+
+static void emit(vt_writer_t* writer, const char* data, size_t length)
+{
+    if (writer->length + length > writer->max_len)
+    {
+        writer->overflow = true;
+        return;
+    }
+    memcpy(&writer->out[writer->length], data, length);
+    writer->length += length;
+}
+
+// Append a decimal number; returns the new length of text
+static size_t format_number(char* text, size_t length, unsigned value)
+{
+    char digits[5];
+    size_t count = 0;
+
+    do
+    {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0 && count < sizeof(digits));
+
+    while (count > 0)
+    {
+        text[length++] = digits[--count];
+    }
+    return length;
+}
+
+static void emit_attr(vt_writer_t* writer, uint8_t attr)
+{
+    if (writer->attr == attr)
+    {
+        return;
+    }
+
+    char text[16] = "\x1b[0";
+    size_t length = 3;
+    static const struct
+    {
+        uint8_t attr;
+        char code;
+    } codes[] = {{VT_ATTR_BOLD, '1'}, {VT_ATTR_UNDERLINE, '4'}, {VT_ATTR_BLINK, '5'}, {VT_ATTR_REVERSE, '7'}};
+
+    for (size_t i = 0; i < sizeof(codes) / sizeof(codes[0]); i++)
+    {
+        if (attr & codes[i].attr)
+        {
+            text[length++] = ';';
+            text[length++] = codes[i].code;
+        }
+    }
+    text[length++] = 'm';
+
+    emit(writer, text, length);
+    writer->attr = attr;
+}
+
+static void emit_cell(vt_writer_t* writer, const vt_cell_t* cell)
+{
+    emit_attr(writer, cell->attr);
+    emit(writer, (const char*)&cell->ch, 1);
+
+    if (writer->col == VT_SCREEN_COLS - 1)
+    {
+        writer->cursor_known = false;
+    }
+    else
+    {
+        writer->col++;
+    }
+}
+
+// Put the cursor at row, col. Cells the cursor would pass over on its row are
+// rewritten from cells when that is shorter than a cursor position sequence.
+static void emit_move(vt_writer_t* writer, uint8_t row, uint8_t col, const vt_cell_t* cells)
+{
+    if (writer->cursor_known && writer->row == row)
+    {
+        if (writer->col == col)
+        {
+            return;
+        }
+        if (cells && col > writer->col && col - writer->col <= VT_SKIP_MAX)
+        {
+            while (writer->col < col)
+            {
+                emit_cell(writer, &cells[writer->col]);
+            }
+            return;
+        }
+    }
+
+    char text[16] = "\x1b[";
+    size_t length = format_number(text, 2, row + 1u);
+    text[length++] = ';';
+    length = format_number(text, length, col + 1u);
+    text[length++] = 'H';
+
+    emit(writer, text, length);
+    writer->row = row;
+    writer->col = col;
+    writer->cursor_known = true;
+}
+
+bool vt_screen_diff(const vt_screen_t* from, const vt_screen_t* to, uint8_t* out, size_t max_len, size_t* length)
+{
+    vt_writer_t writer = {out, 0, max_len, false, 0, 0, true, 0};
+    uint8_t from_top = 0;
+    uint8_t from_bottom = VT_SCREEN_ROWS - 1;
+
+    if (from)
+    {
+        writer.row = from->row;
+        writer.col = from->col;
+        writer.cursor_known = !from->wrap_pending;
+        writer.attr = from->attr;
+        from_top = from->top;
+        from_bottom = from->bottom;
+
+        // Abandon a sequence the terminal is part way through
+        if (from->state != VT_GROUND)
+        {
+            static const char cancel = ASCII_CAN;
+            emit(&writer, &cancel, 1);
+        }
+    }
+
+    // Setting the scroll region homes the cursor
+    if (from_top != to->top || from_bottom != to->bottom)
+    {
+        char text[16] = "\x1b[";
+        size_t length = format_number(text, 2, to->top + 1u);
+        text[length++] = ';';
+        length = format_number(text, length, to->bottom + 1u);
+        text[length++] = 'r';
+        emit(&writer, text, length);
+        writer.row = 0;
+        writer.col = 0;
+        writer.cursor_known = true;
+    }
+
+    for (uint8_t row = 0; row < VT_SCREEN_ROWS; row++)
+    {
+        const vt_cell_t* old_cells = from ? screen_row_const(from, row) : NULL;
+        const vt_cell_t* new_cells = screen_row_const(to, row);
+
+        // A blank tail is erased in one go if the terminal shows anything there
+        uint8_t end = VT_SCREEN_COLS;
+        while (end > 0 && cell_blank(&new_cells[end - 1]))
+        {
+            end--;
+        }
+        bool erase_tail = false;
+        for (uint8_t col = end; col < VT_SCREEN_COLS && !erase_tail; col++)
+        {
+            erase_tail = old_cells && !cell_blank(&old_cells[col]);
+        }
+
+        for (uint8_t col = 0; col < end; col++)
+        {
+            if (!cell_equal(old_cells ? &old_cells[col] : &blank_cell, &new_cells[col]))
+            {
+                emit_move(&writer, row, col, new_cells);
+                emit_cell(&writer, &new_cells[col]);
+            }
+        }
+
+        if (erase_tail)
+        {
+            emit_move(&writer, row, end, new_cells);
+            emit_attr(&writer, 0);
+            emit(&writer, "\x1b[K", 3);
+        }
+
+        if (writer.overflow)
+        {
+            return false;
+        }
+    }
+
+    // Printing the last cell again leaves the terminal waiting to wrap
+    if (to->wrap_pending)
+    {
+        writer.cursor_known = false;
+        emit_move(&writer, to->row, VT_SCREEN_COLS - 1, NULL);
+        emit_cell(&writer, &screen_row_const(to, to->row)[VT_SCREEN_COLS - 1]);
+    }
+    else
+    {
+        emit_move(&writer, to->row, to->col, NULL);
+    }
+    emit_attr(&writer, to->attr);
+
+    *length = writer.length;
+    return !writer.overflow;
+}
+
+bool vt_screen_repaint(const vt_screen_t* screen, uint8_t* out, size_t max_len, size_t* length)
+{
+    // Cancel any sequence, reset attributes and scroll region, clear
+    static const char reset[] = "\x18\x1b[0m\x1b[r\x1b[H\x1b[2J";
+    size_t prefix = sizeof(reset) - 1;
+
+    if (max_len < prefix || !vt_screen_diff(NULL, screen, out + prefix, max_len - prefix, length))
+    {
+        return false;
+    }
+
+    memcpy(out, reset, prefix);
+    *length += prefix;
+    return true;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Server-side model of the browser terminal: an 80x24 VT100 screen fed with
+// the console output stream on core 1. vt_screen_repaint() draws a model on a
+// freshly connected terminal, and vt_screen_diff() finds the least output that
+// takes a terminal from one model to another, e.g. from what a slow client was
+// last sent to the current screen.
+//
+// Understood: printable ASCII, BS, HT, LF, VT, FF, CR, ESC 7 8 D E M c and the
+// CSI sequences A B C D G H J K L M P X @ d f m r s u. SGR keeps bold,
+// underline, blink and reverse; colours and everything else are parsed and
+// ignored. Scrolling rotates a row index, so a full-screen scroll costs one
+// cleared row rather than a screen copy.
+
+#define VT_SCREEN_COLS 80
+#define VT_SCREEN_ROWS 24
+#define VT_SCREEN_MAX_PARAMS 8
+
+// Cell attributes
+#define VT_ATTR_BOLD 0x01
+#define VT_ATTR_UNDERLINE 0x02
+#define VT_ATTR_BLINK 0x04
+#define VT_ATTR_REVERSE 0x08
+
+typedef struct
+{
+    uint8_t ch;
+    uint8_t attr;
+} vt_cell_t;
+
+typedef struct
+{
+    vt_cell_t cells[VT_SCREEN_ROWS][VT_SCREEN_COLS];
+    uint8_t line[VT_SCREEN_ROWS]; // Screen row -> row of cells
+    uint8_t row;
+    uint8_t col;
+    uint8_t attr;      // Applied to printed characters
+    bool wrap_pending; // Printed in the last column; the next character wraps
+    uint8_t top;       // Scroll region
+    uint8_t bottom;
+    uint8_t saved_row;
+    uint8_t saved_col;
+    uint8_t saved_attr;
+
+    // Escape sequence parser
+    uint8_t state;
+    uint8_t param_count;
+    bool private_marker;
+    uint16_t params[VT_SCREEN_MAX_PARAMS];
+} vt_screen_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Blank screen, cursor home, no attributes, full scroll region
+    void vt_screen_reset(vt_screen_t* screen);
+
+    void vt_screen_feed(vt_screen_t* screen, const uint8_t* data, size_t length);
+
+    // Write to out the bytes that take a terminal showing from to showing to
+    // and set length; from NULL is a blank screen with the cursor home. False
+    // if they need more than max_len bytes.
+    bool vt_screen_diff(const vt_screen_t* from, const vt_screen_t* to, uint8_t* out, size_t max_len, size_t* length);
+
+    // Clear a terminal in any state and draw screen on it, as vt_screen_diff()
+    bool vt_screen_repaint(const vt_screen_t* screen, uint8_t* out, size_t max_len, size_t* length);
+
+#ifdef __cplusplus
+}
+#endif
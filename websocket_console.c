@@ -7,78 +7,58 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "hardware/sync.h"
 #include "pico/multicore.h"
 #include "pico/mutex.h"
 #include "pico/stdlib.h"
 #include "pico/util/queue.h"
 
+#include "FrontPanels/panel_sampler.h"
 #include "cpu_state.h"
+#include "spsc_ring.h"
 #include "ws.h"
+#include "ws_protocol.h"
 
 // Enable WebSocket console only if board has WiFi capability
 #if defined(CYW43_WL_GPIO_LED_PIN)
 
-#define WS_RX_QUEUE_DEPTH 128
-#define WS_TX_QUEUE_DEPTH 512
+#define WS_RX_RING_SIZE 1024 // Power of two
+#define WS_TX_RING_SIZE 4096 // Power of two
+#define WS_MONITOR_RING_SIZE 1024 // Power of two
 #define MONITOR_QUEUE_DEPTH 16
 
-static queue_t ws_rx_queue;
-static queue_t ws_tx_queue;
 static queue_t monitor_queue;
 
-static void websocket_console_clear_tx_buffer(void);
-static void websocket_console_clear_queues(void);
+// Console input, core 1 -> core 0. Core 1 fills it as each message is popped
+// and rings the doorbell (SEV) so an idle core 0 wakes from WFE at once.
+static spsc_ring_t ws_rx_ring;
+static uint8_t ws_rx_storage[WS_RX_RING_SIZE];
 
-/**
- * @brief Pops bytes from the WebSocket console transmit buffer.
- *
- * Retrieves up to max_len bytes from the TX queue.
- * Thread-safe, uses Pico SDK queue.
- *
- * @param buffer Destination buffer for retrieved bytes
- * @param max_len Maximum number of bytes to retrieve
- * @return size_t Number of bytes actually retrieved
- */
-static size_t websocket_console_tx_pop(uint8_t* buffer, size_t max_len)
-{
-    if (!buffer || max_len == 0)
-    {
-        return 0;
-    }
+// Console output, core 0 -> core 1. Core 0 is the only producer and core 1
+// frames WebSocket messages straight out of it, each client from its own
+// position; bytes are released once the screen model has taken them and every
+// client has sent them.
+static spsc_ring_t ws_tx_ring;
+static uint8_t ws_tx_storage[WS_TX_RING_SIZE];
+static volatile uint32_t last_input_us = 0;
 
-    size_t count = 0;
-    while (count < max_len && queue_try_remove(&ws_tx_queue, &buffer[count]))
-    {
-        count++;
-    }
-
-    return count;
-}
-
-/**
- * @brief Clears the WebSocket console transmit buffer.
- *
- * Removes all pending bytes from the TX queue.
- */
-static void websocket_console_clear_tx_buffer(void)
-{
-    uint8_t discard = 0;
-    while (queue_try_remove(&ws_tx_queue, &discard))
-    {
-    }
-}
+// CPU monitor output for the monitor channel, core 0 -> core 1. Nothing waits
+// on it: what does not fit is dropped.
+static spsc_ring_t ws_monitor_ring;
+static uint8_t ws_monitor_storage[WS_MONITOR_RING_SIZE];
 
 /**
  * @brief Initializes the WebSocket console queues and synchronization primitives.
  *
- * Sets up the TX and RX queues. Must be called on core 0
+ * Sets up the TX, RX and monitor rings and the monitor queue. Must be called on core 0
  * before launching core 1 to ensure proper multi-core synchronization.
  */
 void websocket_queue_init(void)
 {
     // Initialize queues on core 0 before launching core 1
-    queue_init(&ws_tx_queue, sizeof(uint8_t), WS_TX_QUEUE_DEPTH);
-    queue_init(&ws_rx_queue, sizeof(uint8_t), WS_RX_QUEUE_DEPTH);
+    spsc_ring_init(&ws_tx_ring, ws_tx_storage, WS_TX_RING_SIZE);
+    spsc_ring_init(&ws_rx_ring, ws_rx_storage, WS_RX_RING_SIZE);
+    spsc_ring_init(&ws_monitor_ring, ws_monitor_storage, WS_MONITOR_RING_SIZE);
     queue_init(&monitor_queue, sizeof(uint8_t), MONITOR_QUEUE_DEPTH);
 }
 
@@ -94,9 +74,17 @@ bool websocket_console_init_server(void)
 {
     ws_callbacks_t callbacks = {
         .on_receive = websocket_console_handle_input,
-        .on_output = websocket_console_supply_output,
+        .on_channel_receive = websocket_console_handle_channel_input,
+        .on_output_peek = websocket_console_peek_output,
+        .on_output_head = websocket_console_output_head,
+        .on_output_release = websocket_console_release_output,
+        .on_snapshot = websocket_console_snapshot,
+        .on_subscription = websocket_console_on_subscription,
+        .on_resync = websocket_console_on_resync,
         .on_client_connected = websocket_console_on_client_connected,
         .on_client_disconnected = websocket_console_on_client_disconnected,
+        .output_size = WS_TX_RING_SIZE,
+        .monitor_output_size = WS_MONITOR_RING_SIZE,
         .user_data = NULL,
     };
     ws_init(&callbacks);
@@ -105,22 +93,56 @@ bool websocket_console_init_server(void)
 }
 
 /**
- * @brief Enqueues a byte for transmission to WebSocket clients.
+ * @brief Enqueues bytes for transmission to WebSocket clients.
  *
- * Adds a byte to the TX buffer for sending to connected WebSocket clients.
- * If no clients are connected, clears the buffer instead to prevent accumulation.
+ * Copies the bytes into the TX ring in one or two runs, waiting for core 1
+ * to release space if it is full (a client under the WS_OUTPUT_BLOCK policy
+ * holding it up). Core 1 feeds every byte to its screen model even while no
+ * client is connected, so output is only dropped until the server is running.
+ * Core 0 only.
+ *
+ * @param data Bytes to transmit to WebSocket clients
+ * @param length Number of bytes
+ */
+void websocket_console_enqueue_bytes(const uint8_t* data, size_t length)
+{
+    while (length > 0 && ws_is_running())
+    {
+        size_t queued = spsc_ring_enqueue_bytes(&ws_tx_ring, data, length);
+        data += queued;
+        length -= queued;
+        if (length > 0)
+        {
+            tight_loop_contents();
+        }
+    }
+}
+
+/**
+ * @brief Enqueues a byte for transmission to WebSocket clients.
  *
  * @param value Byte to transmit to WebSocket clients
  */
 void websocket_console_enqueue_output(uint8_t value)
 {
-    if (!ws_has_active_clients())
+    websocket_console_enqueue_bytes(&value, 1);
+}
+
+/**
+ * @brief Copies CPU monitor output to the monitor channel.
+ *
+ * The same bytes also go to the console with websocket_console_enqueue_bytes().
+ * Bytes that do not fit are dropped rather than waited for. Core 0 only.
+ *
+ * @param data Monitor output
+ * @param length Number of bytes
+ */
+void websocket_console_enqueue_monitor(const uint8_t* data, size_t length)
+{
+    if (ws_is_running())
     {
-        websocket_console_clear_tx_buffer();
-        return;
+        spsc_ring_enqueue_bytes(&ws_monitor_ring, data, length);
     }
-
-    queue_add_blocking(&ws_tx_queue, &value);
 }
 
 /**
@@ -133,7 +155,36 @@ void websocket_console_enqueue_output(uint8_t value)
  */
 bool websocket_console_try_dequeue_input(uint8_t* value)
 {
-    return queue_try_remove(&ws_rx_queue, value);
+    const uint8_t* data;
+
+    if (spsc_ring_peek(&ws_rx_ring, &data) == 0)
+    {
+        return false;
+    }
+
+    *value = *data;
+    spsc_ring_commit(&ws_rx_ring, 1);
+    return true;
+}
+
+/**
+ * @brief Checks for WebSocket input without consuming it.
+ *
+ * @return true if at least one byte is waiting in the RX ring
+ */
+bool websocket_console_input_pending(void)
+{
+    return !spsc_ring_is_empty(&ws_rx_ring);
+}
+
+/**
+ * @brief Returns when console input was last queued.
+ *
+ * @return uint32_t time_us_32() timestamp of the most recent input byte
+ */
+uint32_t websocket_console_last_input_us(void)
+{
+    return last_input_us;
 }
 
 bool websocket_console_try_dequeue_monitor_input(uint8_t* value)
@@ -141,12 +192,61 @@ bool websocket_console_try_dequeue_monitor_input(uint8_t* value)
     return queue_try_remove(&monitor_queue, value);
 }
 
+// Queue received bytes for core 0 as the given CPU mode takes them: the
+// console while running, the CPU monitor while stopped. Converts \n to \r.
+static void queue_input(const uint8_t* payload, size_t payload_len, CPU_OPERATING_MODE cpu_mode)
+{
+    for (size_t i = 0; i < payload_len; ++i)
+    {
+        uint8_t ch = payload[i];
+        if (ch == '\n')
+        {
+            ch = '\r';
+        }
+
+        switch (cpu_mode)
+        {
+            case CPU_RUNNING:
+                // Only core 0 may drop from the ring, so a full ring loses
+                // the newest byte rather than the oldest
+                last_input_us = time_us_32();
+                spsc_ring_enqueue_bytes(&ws_rx_ring, &ch, 1);
+                break;
+
+            case CPU_STOPPED:
+                if (!queue_try_add(&monitor_queue, &ch))
+                {
+                    uint8_t discard = 0;
+                    if (queue_try_remove(&monitor_queue, &discard))
+                    {
+                        queue_try_add(&monitor_queue, &ch);
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Doorbell: end core 0's console idle wait
+    __sev();
+}
+
+// Store the low bytes of value, little-endian
+static void put_le(uint8_t* out, uint64_t value, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
 /**
  * @brief Handles incoming WebSocket input data.
  *
  * Processes bytes received from WebSocket clients with CPU monitor support.
  * - Detects CTRL-M (ASCII 28) to toggle CPU mode
- * - In CPU_RUNNING mode: queues input directly to RX queue
+ * - In CPU_RUNNING mode: queues input directly to the RX ring and signals core 0
  * - In CPU_STOPPED mode: accumulates input in command buffer until '\r'
  * Converts newline characters (\n) to carriage returns (\r).
  *
@@ -172,47 +272,123 @@ bool websocket_console_handle_input(const uint8_t* payload, size_t payload_len,
         return true;
     }
 
-    CPU_OPERATING_MODE cpu_mode = cpu_state_get_mode();
+    queue_input(payload, payload_len, cpu_state_get_mode());
+    return true;
+}
 
-    for (size_t i = 0; i < payload_len; ++i)
-    {
-        uint8_t ch = payload[i];
-        if (ch == '\n')
-        {
-            ch = '\r';
-        }
+/**
+ * @brief Handles a message from a WebSocket client in channel mode.
+ *
+ * Console input is routed by CPU mode as for a plain terminal, but byte 28
+ * is an ordinary character: the mode is set with a WS_CONTROL_MODE request.
+ * Monitor input always goes to the CPU monitor, which reads it while the CPU
+ * is stopped. Anything else is ignored.
+ *
+ * @param channel WS_CHANNEL_* the message was sent on
+ * @param payload Message after the channel byte
+ * @param payload_len Number of bytes in the payload
+ * @param user_data User-defined context (unused)
+ * @return true to keep the connection open
+ */
+bool websocket_console_handle_channel_input(uint8_t channel, const uint8_t* payload, size_t payload_len,
+                                            void* user_data)
+{
+    (void)user_data;
 
-        switch (cpu_mode)
-        {
-            case CPU_RUNNING:
-                if (!queue_try_add(&ws_rx_queue, &ch))
+    switch (channel)
+    {
+        case WS_CHANNEL_CONSOLE:
+            queue_input(payload, payload_len, cpu_state_get_mode());
+            break;
+
+        case WS_CHANNEL_MONITOR:
+            queue_input(payload, payload_len, CPU_STOPPED);
+            break;
+
+        case WS_CHANNEL_CONTROL:
+            if (payload_len >= 2 && payload[0] == WS_CONTROL_MODE)
+            {
+                bool run = payload[1] != 0;
+                if (run != (cpu_state_get_mode() == CPU_RUNNING))
                 {
-                    uint8_t discard = 0;
-                    if (queue_try_remove(&ws_rx_queue, &discard))
-                    {
-                        queue_try_add(&ws_rx_queue, &ch);
-                    }
+                    cpu_state_toggle_mode();
                 }
-                break;
+            }
+            break;
 
-            case CPU_STOPPED:
-                if (!queue_try_add(&monitor_queue, &ch))
-                {
-                    uint8_t discard = 0;
-                    if (queue_try_remove(&monitor_queue, &discard))
-                    {
-                        queue_try_add(&monitor_queue, &ch);
-                    }
-                }
-                break;
-            default:
-                break;
-        }
+        default:
+            break;
     }
-
     return true;
 }
 
+/**
+ * @brief Fills in a LEDS or STATS channel payload.
+ *
+ * LEDS frames are sampled and encoded on core 0 (FrontPanels/panel_sampler.c)
+ * and handed over here one at a time. STATS counters are read on core 1 as
+ * they stand.
+ *
+ * @param channel WS_CHANNEL_LEDS or WS_CHANNEL_STATS
+ * @param buffer Payload to fill in (ws_protocol.h layout)
+ * @param max_len Bytes available at buffer
+ * @param user_data User-defined context (unused)
+ * @return size_t Payload length, 0 when no LEDS frame is waiting or for an unknown channel
+ */
+size_t websocket_console_snapshot(uint8_t channel, uint8_t* buffer, size_t max_len, void* user_data)
+{
+    (void)user_data;
+
+    if (channel == WS_CHANNEL_LEDS)
+    {
+        return panel_sampler_take_frame(buffer, max_len);
+    }
+
+    if (channel == WS_CHANNEL_STATS && max_len >= WS_STATS_PAYLOAD_LEN)
+    {
+        cpu_idle_stats_t idle;
+        cpu_state_get_idle_stats(&idle);
+
+        buffer[0] = (uint8_t)cpu_state_get_mode();
+        buffer[1] = (uint8_t)cpu_state_get_clock();
+        put_le(&buffer[2], cpu_state_get_measured_khz(), 4);
+        put_le(&buffer[6], cpu.cycles, 8);
+        put_le(&buffer[14], idle.idle_us, 8);
+        put_le(&buffer[22], idle.wakes, 4);
+        put_le(&buffer[26], idle.last_wake_latency_us, 4);
+        return WS_STATS_PAYLOAD_LEN;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Runs the front panel sampler only while a client watches the LEDs.
+ *
+ * @param channels WS_CHANNEL_BIT mask of the channels any client is subscribed to
+ * @param user_data User-defined context (unused)
+ */
+void websocket_console_on_subscription(uint8_t channels, void* user_data)
+{
+    (void)user_data;
+    panel_sampler_enable((channels & WS_CHANNEL_BIT(WS_CHANNEL_LEDS)) != 0);
+}
+
+/**
+ * @brief Asks the front panel sampler for a key frame.
+ *
+ * @param channel WS_CHANNEL_LEDS
+ * @param user_data User-defined context (unused)
+ */
+void websocket_console_on_resync(uint8_t channel, void* user_data)
+{
+    (void)user_data;
+    if (channel == WS_CHANNEL_LEDS)
+    {
+        panel_sampler_request_key_frame();
+    }
+}
+
 /**
  * @brief Callback invoked when a WebSocket client connects.
  *
@@ -229,48 +405,65 @@ void websocket_console_on_client_connected(void* user_data)
 /**
  * @brief Callback invoked when a WebSocket client disconnects.
  *
- * Clears both TX and RX queues to reset console state when
- * the client connection is lost.
+ * Nothing to reset: the server stops holding output for the client, and
+ * input already in the RX ring is left for core 0, the ring's only consumer.
  *
  * @param user_data User-defined context (unused)
  */
 void websocket_console_on_client_disconnected(void* user_data)
 {
     (void)user_data;
-    websocket_console_clear_queues();
+}
+
+// The ring behind an output channel: the TX ring, or the monitor ring
+static spsc_ring_t* output_ring(uint8_t channel)
+{
+    return channel == WS_CHANNEL_MONITOR ? &ws_monitor_ring : &ws_tx_ring;
 }
 
 /**
- * @brief Clears both TX and RX queues.
+ * @brief Exposes output to the WebSocket server without copying.
+ *
+ * Called by the WebSocket server on core 1 to frame the contiguous run of
+ * the TX or monitor ring that starts at one client's stream position. The
+ * bytes stay queued until websocket_console_release_output() frees them.
  *
- * Empties the transmit buffer and removes all pending bytes
- * from the receive queue.
+ * @param channel WS_CHANNEL_CONSOLE or WS_CHANNEL_MONITOR
+ * @param position Stream position to read from, not older than the last release
+ * @param data Set to the byte at position
+ * @param user_data User-defined context (unused)
+ * @return size_t Number of contiguous bytes at data
  */
-static void websocket_console_clear_queues(void)
+size_t websocket_console_peek_output(uint8_t channel, uint32_t position, const uint8_t** data, void* user_data)
 {
-    websocket_console_clear_tx_buffer();
-
-    uint8_t discard = 0;
-    while (queue_try_remove(&ws_rx_queue, &discard))
-    {
-    }
+    (void)user_data;
+    return spsc_ring_peek_at(output_ring(channel), position, data);
 }
 
 /**
- * @brief Supplies output data to be sent to WebSocket clients.
+ * @brief Returns the stream position the next output byte will take.
  *
- * Called by the WebSocket server to retrieve bytes from the TX buffer
- * for transmission to connected clients.
+ * @param channel WS_CHANNEL_CONSOLE or WS_CHANNEL_MONITOR
+ * @param user_data User-defined context (unused)
+ * @return uint32_t Bytes ever written to the channel's ring
+ */
+uint32_t websocket_console_output_head(uint8_t channel, void* user_data)
+{
+    (void)user_data;
+    return spsc_ring_head(output_ring(channel));
+}
+
+/**
+ * @brief Releases output every WebSocket client has sent.
  *
- * @param buffer Destination buffer for output data
- * @param max_len Maximum number of bytes to retrieve
+ * @param channel WS_CHANNEL_CONSOLE or WS_CHANNEL_MONITOR
+ * @param position Stream position of the oldest byte still needed
  * @param user_data User-defined context (unused)
- * @return size_t Number of bytes placed in the buffer
  */
-size_t websocket_console_supply_output(uint8_t* buffer, size_t max_len, void* user_data)
+void websocket_console_release_output(uint8_t channel, uint32_t position, void* user_data)
 {
     (void)user_data;
-    return websocket_console_tx_pop(buffer, max_len);
+    spsc_ring_release_to(output_ring(channel), position);
 }
 
 #else // No WiFi capability
@@ -285,6 +478,18 @@ bool websocket_console_init_server(void)
     return false;
 }
 
+/**
+ * @brief Stub for enqueuing output when WiFi is not available.
+ *
+ * @param data Unused bytes
+ * @param length Unused length
+ */
+void websocket_console_enqueue_bytes(const uint8_t* data, size_t length)
+{
+    (void)data;
+    (void)length;
+}
+
 /**
  * @brief Stub for enqueuing output when WiFi is not available.
  *
@@ -295,6 +500,18 @@ void websocket_console_enqueue_output(uint8_t value)
     (void)value;
 }
 
+/**
+ * @brief Stub for enqueuing monitor output when WiFi is not available.
+ *
+ * @param data Unused bytes
+ * @param length Unused length
+ */
+void websocket_console_enqueue_monitor(const uint8_t* data, size_t length)
+{
+    (void)data;
+    (void)length;
+}
+
 /**
  * @brief Stub for dequeuing input when WiFi is not available.
  *
@@ -307,6 +524,26 @@ bool websocket_console_try_dequeue_input(uint8_t* value)
     return false;
 }
 
+/**
+ * @brief Stub for checking input when WiFi is not available.
+ *
+ * @return false Always returns false (no input available)
+ */
+bool websocket_console_input_pending(void)
+{
+    return false;
+}
+
+/**
+ * @brief Stub for the input timestamp when WiFi is not available.
+ *
+ * @return 0 Always (no input ever queued)
+ */
+uint32_t websocket_console_last_input_us(void)
+{
+    return 0;
+}
+
 /**
  * @brief Stub for dequeuing monitor input when WiFi is not available.
  *
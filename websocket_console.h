@@ -8,13 +8,25 @@
 // Call this once from main(); it returns immediately while core1 runs in the background.
 void websocket_console_start(void);
 
-// Enqueue a byte from the emulator (core 0) to be sent to WebSocket clients.
-// 4KB TX queue is large enough for both normal terminal and CPU monitor bulk output.
+// Enqueue bytes from the emulator (core 0) to be sent to WebSocket clients.
+// The 4KB lock-free TX ring is large enough for both normal terminal and CPU
+// monitor bulk output; core 0 is its only producer.
+void websocket_console_enqueue_bytes(const uint8_t* data, size_t length);
 void websocket_console_enqueue_output(uint8_t value);
 
+// Copy CPU monitor output to the WebSocket monitor channel (called from core 0).
+// Best effort: what the 1KB ring has no room for is dropped.
+void websocket_console_enqueue_monitor(const uint8_t* data, size_t length);
+
 // Try to dequeue a byte received from WebSocket clients (called from core 0).
 bool websocket_console_try_dequeue_input(uint8_t* value);
 
+// True when console input is waiting to be dequeued (called from core 0).
+bool websocket_console_input_pending(void);
+
+// time_us_32() when console input was last queued, for wake latency figures.
+uint32_t websocket_console_last_input_us(void);
+
 // Try to dequeue a byte received from the CPU monitor input queue (called from core 0).
 bool websocket_console_try_dequeue_monitor_input(uint8_t* value);
 
@@ -25,19 +37,14 @@ bool websocket_console_is_running(void);
 void ws_poll_incoming(void);
 void ws_poll_outgoing(void);
 
-// Poll the WebSocket server for incoming and outgoing messages (internal use)
-static inline void ws_poll(volatile bool* pending_ws_input, volatile bool* pending_ws_output)
+// Poll the WebSocket server (internal use). Call straight after
+// cyw43_arch_poll(), whose lwIP receive callbacks queue incoming messages:
+// they are handed to core 0 on the same pass. Output is checked on every pass
+// and ws_poll_outgoing() decides whether to send it now or coalesce it.
+static inline void ws_poll(void)
 {
-    if (*pending_ws_input)
-    {
-        *pending_ws_input = false;
-        ws_poll_incoming();
-    }
-    if (*pending_ws_output)
-    {
-        *pending_ws_output = false;
-        ws_poll_outgoing();
-    }
+    ws_poll_incoming();
+    ws_poll_outgoing();
 }
 
 // Initialize WebSocket queues (internal use)
@@ -54,6 +61,13 @@ void process_virtual_input(const char* command, size_t len);
 
 // WebSocket callback functions (internal use)
 bool websocket_console_handle_input(const uint8_t* payload, size_t payload_len, void* user_data);
-size_t websocket_console_supply_output(uint8_t* buffer, size_t max_len, void* user_data);
+bool websocket_console_handle_channel_input(uint8_t channel, const uint8_t* payload, size_t payload_len,
+                                            void* user_data);
+size_t websocket_console_peek_output(uint8_t channel, uint32_t position, const uint8_t** data, void* user_data);
+uint32_t websocket_console_output_head(uint8_t channel, void* user_data);
+void websocket_console_release_output(uint8_t channel, uint32_t position, void* user_data);
+size_t websocket_console_snapshot(uint8_t channel, uint8_t* buffer, size_t max_len, void* user_data);
+void websocket_console_on_subscription(uint8_t channels, void* user_data);
+void websocket_console_on_resync(uint8_t channel, void* user_data);
 void websocket_console_on_client_connected(void* user_data);
 void websocket_console_on_client_disconnected(void* user_data);
@@ -1,8 +1,12 @@
 #include "ws.h"
 
+#include "lwipopts.h"
 #include "pico/time.h"
 #include "pico_ws_server/web_socket_server.h"
+#include "vt_screen.h"
+#include "ws_protocol.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <memory>
@@ -16,7 +20,23 @@ static constexpr uint32_t WS_MAX_CLIENTS = 2;
 // WS_MAX_CLIENTS to avoid RSTs during the WebSocket handshake when a browser
 // holds an HTTP keep-alive connection open.
 static constexpr uint32_t WS_SERVER_MAX_CONNECTIONS = 8;
-static constexpr size_t WS_FRAME_PAYLOAD = 256;
+// Output frames start at WS_FRAME_MIN bytes and double while every client's
+// TCP send buffer keeps taking them, up to half of TCP_SND_BUF so one frame can
+// be in flight while the next is queued. A refused send halves the limit.
+static constexpr size_t WS_FRAME_MIN = 256;
+static constexpr size_t WS_FRAME_MAX = TCP_SND_BUF / 2;
+// Output is sent at once when nothing went out for WS_FLUSH_IDLE_US (a key
+// echo); under load it is held until a full frame is waiting or the oldest
+// byte has waited WS_FLUSH_COALESCE_US
+static constexpr uint32_t WS_FLUSH_IDLE_US = 2000;
+static constexpr uint32_t WS_FLUSH_COALESCE_US = 4000;
+// A screen sync (repaint or diff) is built in one buffer and sent as one frame;
+// a failed attempt is retried after WS_FLUSH_IDLE_US
+static constexpr size_t WS_SYNC_BUFFER_SIZE = 4096;
+// Sent instead when a repaint does not fit: cancel any sequence, reset and clear
+static constexpr char WS_CLEAR_SCREEN[] = "\x18\x1b[0m\x1b[r\x1b[H\x1b[2J";
+// Snapshots are small; a refused one is skipped and the next one supersedes it
+static constexpr size_t WS_SNAPSHOT_MAX = 64;
 static constexpr uint32_t WS_PING_INTERVAL_MS = 10000; // 10s
 static constexpr uint8_t WS_MAX_MISSED_PONGS = 3;      // 30s total timeout
 
@@ -25,6 +45,13 @@ struct ws_context_t
     ws_callbacks_t callbacks;
 };
 
+enum ws_sync_t : uint8_t
+{
+    WS_SYNC_NONE,
+    WS_SYNC_DIFF,    // Send what changed since its shadow screen
+    WS_SYNC_REPAINT, // Clear and draw the whole screen
+};
+
 struct ws_connection_state_t
 {
     uint32_t conn_id;
@@ -33,6 +60,26 @@ struct ws_connection_state_t
     uint8_t missed_pongs;
     bool active;
     bool closing;
+
+    // Output: each client sends from its own stream position, so a slow one
+    // falls behind without costing the others any bytes
+    uint32_t cursor; // Next stream position to send
+    size_t frame_limit;
+    uint64_t last_frame_us;    // When its last frame went out
+    uint64_t pending_since_us; // When output was first seen waiting; 0 when none
+    bool stalled;              // Holding up a full buffer
+    ws_sync_t sync;            // Screen to send before any more output
+    uint64_t sync_attempt_us;
+    bool shadow_valid;         // False once it has missed output without a sync
+    vt_screen_t shadow;        // What its terminal shows: the screens and output it was sent
+
+    // Channel mode (ws_protocol.h); until the hello it is a plain terminal
+    bool mux;
+    uint8_t channels;        // Subscribed channels
+    bool reply_pending;      // Hello reply still to send
+    uint32_t monitor_cursor; // Next monitor stream position to send
+    bool leds_key_wait;      // LEDS frames are deltas: skip them until a key frame
+    ws_client_stats_t stats;
 };
 
 static ws_context_t g_ws_context = {};
@@ -42,6 +89,23 @@ static size_t g_ws_active_clients = 0;
 static std::unique_ptr<WebSocketServer> g_ws_server;
 static ws_connection_state_t g_ws_connections[WS_MAX_CLIENTS] = {};
 
+static uint64_t g_ws_input_us = 0; // When input last arrived; 0 once its echo went out
+static ws_output_stats_t g_ws_stats = {};
+static volatile ws_output_policy_t g_ws_policy = WS_OUTPUT_RESYNC;
+static uint32_t g_ws_lag_limit = 0;         // Three quarters of the output buffer
+static uint32_t g_ws_monitor_lag_limit = 0; // Three quarters of the monitor buffer
+
+// The console screen, fed with every byte of output as it is written
+static vt_screen_t g_ws_screen;
+static uint32_t g_ws_screen_position = 0; // Stream position it has been fed up to
+// Frames for channel mode clients start with the channel byte, so output is
+// copied in after it; screen syncs and snapshots are built one byte in
+static uint8_t g_ws_sync_buffer[1 + WS_SYNC_BUFFER_SIZE];
+static uint8_t g_ws_frame[1 + WS_FRAME_MAX];
+static uint8_t g_ws_snapshot_frame[1 + WS_SNAPSHOT_MAX];
+static uint64_t g_ws_stats_due_us = 0;
+static uint8_t g_ws_subscribed = 0; // Channels some client is subscribed to, as last reported
+
 static ws_connection_state_t* find_connection(uint32_t conn_id)
 {
     for (size_t i = 0; i < WS_MAX_CLIENTS; ++i)
@@ -66,6 +130,25 @@ static ws_connection_state_t* allocate_connection(uint32_t conn_id)
             g_ws_connections[i].pending_pings = 0;
             g_ws_connections[i].missed_pongs = 0;
             g_ws_connections[i].next_ping_deadline = make_timeout_time_ms(WS_PING_INTERVAL_MS);
+
+            // Join with a repaint of the screen, then follow the stream from
+            // the point the screen has been fed to
+            g_ws_connections[i].cursor = g_ws_screen_position;
+            g_ws_connections[i].frame_limit = WS_FRAME_MIN;
+            g_ws_connections[i].last_frame_us = 0;
+            g_ws_connections[i].pending_since_us = 0;
+            g_ws_connections[i].stalled = false;
+            g_ws_connections[i].sync = WS_SYNC_REPAINT;
+            g_ws_connections[i].sync_attempt_us = 0;
+            g_ws_connections[i].shadow_valid = false;
+            g_ws_connections[i].mux = false;
+            g_ws_connections[i].channels = WS_CHANNEL_BIT(WS_CHANNEL_CONSOLE);
+            g_ws_connections[i].reply_pending = false;
+            g_ws_connections[i].leds_key_wait = true;
+            g_ws_connections[i].monitor_cursor =
+                g_ws_context.callbacks.on_output_head(WS_CHANNEL_MONITOR, g_ws_context.callbacks.user_data);
+            g_ws_connections[i].stats = {};
+            g_ws_connections[i].stats.conn_id = conn_id;
             return &g_ws_connections[i];
         }
     }
@@ -191,6 +274,76 @@ void handle_close(WebSocketServer& server, uint32_t conn_id)
     }
 }
 
+static bool is_hello(const uint8_t* payload, size_t len)
+{
+    return len >= 2 + WS_HELLO_MAGIC_LEN && payload[0] == WS_CHANNEL_CONTROL && payload[1] == WS_CONTROL_HELLO &&
+           std::memcmp(&payload[2], WS_HELLO_MAGIC, WS_HELLO_MAGIC_LEN) == 0;
+}
+
+static void subscribe(ws_connection_state_t* conn, uint8_t channels)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+    uint8_t added = channels & ~conn->channels;
+
+    // Monitor output is followed from now and LEDS from the next key frame;
+    // a newly subscribed console is repainted by ws_poll_outgoing(), which
+    // keeps an unsubscribed one at head
+    if (added & WS_CHANNEL_BIT(WS_CHANNEL_MONITOR))
+    {
+        conn->monitor_cursor = callbacks.on_output_head(WS_CHANNEL_MONITOR, callbacks.user_data);
+    }
+    if (added & WS_CHANNEL_BIT(WS_CHANNEL_LEDS))
+    {
+        conn->leds_key_wait = true;
+        if (callbacks.on_resync)
+        {
+            callbacks.on_resync(WS_CHANNEL_LEDS, callbacks.user_data);
+        }
+    }
+    conn->channels = channels & WS_CHANNELS_SUPPORTED;
+    conn->reply_pending = true;
+}
+
+// A message from a client in channel mode, or the hello that switches it over
+static bool handle_channel_message(ws_connection_state_t* conn, const uint8_t* payload, size_t len)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+
+    if (len == 0)
+    {
+        return true;
+    }
+
+    if (is_hello(payload, len))
+    {
+        // Whatever it was sent before the reply is ignored, so the console
+        // starts again with a repaint
+        if (!conn->mux)
+        {
+            conn->mux = true;
+            conn->channels = 0;
+            conn->sync = WS_SYNC_REPAINT;
+            conn->shadow_valid = false;
+        }
+        size_t mask_at = 2 + WS_HELLO_MAGIC_LEN + 1;
+        subscribe(conn, len > mask_at ? payload[mask_at] : WS_CHANNEL_BIT(WS_CHANNEL_CONSOLE));
+        return true;
+    }
+
+    if (payload[0] == WS_CHANNEL_CONTROL && len >= 3 && payload[1] == WS_CONTROL_SUBSCRIBE)
+    {
+        subscribe(conn, payload[2]);
+        return true;
+    }
+
+    // Input and the remaining control requests belong to the console
+    if (!callbacks.on_channel_receive)
+    {
+        return true;
+    }
+    return callbacks.on_channel_receive(payload[0], payload + 1, len - 1, callbacks.user_data);
+}
+
 void handle_message(WebSocketServer& server, uint32_t conn_id, const void* data, size_t len)
 {
     ws_context_t* ctx = static_cast<ws_context_t*>(server.getCallbackExtra());
@@ -199,15 +352,26 @@ void handle_message(WebSocketServer& server, uint32_t conn_id, const void* data,
         return;
     }
 
+    // Echo latency runs from here to the next frame sent
+    if (g_ws_input_us == 0)
+    {
+        g_ws_input_us = time_us_64();
+    }
+
+    const uint8_t* payload = static_cast<const uint8_t*>(data);
+    ws_connection_state_t* conn = find_connection(conn_id);
     bool keep_open = true;
-    if (ctx->callbacks.on_receive)
+    if (conn && (conn->mux || is_hello(payload, len)))
+    {
+        keep_open = handle_channel_message(conn, payload, len);
+    }
+    else if (ctx->callbacks.on_receive)
     {
-        keep_open = ctx->callbacks.on_receive(static_cast<const uint8_t*>(data), len, ctx->callbacks.user_data);
+        keep_open = ctx->callbacks.on_receive(payload, len, ctx->callbacks.user_data);
     }
 
     if (!keep_open)
     {
-        ws_connection_state_t* conn = find_connection(conn_id);
         if (conn)
         {
             conn->closing = true;
@@ -240,6 +404,387 @@ void handle_pong(WebSocketServer& server, uint32_t conn_id, const void* data, si
     printf("WebSocket received PONG from %u\n", conn_id);
 #endif
 }
+
+// Send a payload held at frame + 1, preceded by its channel byte for a client
+// in channel mode
+static bool send_frame(ws_connection_state_t* conn, uint8_t channel, uint8_t* frame, size_t length)
+{
+    if (!conn->mux)
+    {
+        return g_ws_server->sendMessage(conn->conn_id, frame + 1, length);
+    }
+    frame[0] = channel;
+    return g_ws_server->sendMessage(conn->conn_id, frame, length + 1);
+}
+
+// Send a run of an output buffer, copying it after the channel byte only for
+// a client in channel mode
+static bool send_output(ws_connection_state_t* conn, uint8_t channel, const uint8_t* payload, size_t length)
+{
+    if (!conn->mux)
+    {
+        return g_ws_server->sendMessage(conn->conn_id, payload, length);
+    }
+    std::memcpy(&g_ws_frame[1], payload, length);
+    return send_frame(conn, channel, g_ws_frame, length);
+}
+
+// Feed the screen the output written since the last poll
+static void feed_screen(uint32_t head)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+
+    while (g_ws_screen_position != head)
+    {
+        const uint8_t* data = nullptr;
+        size_t length = callbacks.on_output_peek(WS_CHANNEL_CONSOLE, g_ws_screen_position, &data, callbacks.user_data);
+        length = std::min(length, static_cast<size_t>(head - g_ws_screen_position));
+        vt_screen_feed(&g_ws_screen, data, length);
+        g_ws_screen_position += static_cast<uint32_t>(length);
+    }
+}
+
+// Bring a client's terminal up to the screen, which has been fed up to head:
+// a diff against its shadow screen, or a repaint. Until one is sent the
+// client holds no output. Returns true when a frame went out.
+static bool send_client_sync(ws_connection_state_t* conn, uint32_t head, uint64_t now)
+{
+    conn->cursor = head;
+    if (now - conn->sync_attempt_us < WS_FLUSH_IDLE_US)
+    {
+        return false;
+    }
+    conn->sync_attempt_us = now;
+
+    uint8_t* out = &g_ws_sync_buffer[1];
+    size_t length = 0;
+    bool built = conn->sync == WS_SYNC_DIFF &&
+                 vt_screen_diff(&conn->shadow, &g_ws_screen, out, WS_SYNC_BUFFER_SIZE, &length);
+    if (!built)
+    {
+        built = vt_screen_repaint(&g_ws_screen, out, WS_SYNC_BUFFER_SIZE, &length);
+    }
+    if (!built)
+    {
+        length = sizeof(WS_CLEAR_SCREEN) - 1;
+        std::memcpy(out, WS_CLEAR_SCREEN, length);
+    }
+
+    if (length > 0 && !send_frame(conn, WS_CHANNEL_CONSOLE, g_ws_sync_buffer, length))
+    {
+        ++conn->stats.send_failures;
+        return false;
+    }
+
+    // A cleared screen is what the client shows now, not the model
+    if (built)
+    {
+        conn->shadow = g_ws_screen;
+    }
+    else
+    {
+        vt_screen_reset(&conn->shadow);
+    }
+    conn->shadow_valid = true;
+    conn->sync = WS_SYNC_NONE;
+    conn->last_frame_us = now;
+    ++conn->stats.syncs;
+    ++g_ws_stats.frames;
+    g_ws_stats.bytes += length;
+    return length > 0;
+}
+
+// Send one client its next frame if the flush rules allow; head is the stream
+// position output has been written up to. Returns true when a frame went out.
+static bool send_client_output(ws_connection_state_t* conn, uint32_t head, uint64_t now)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+    uint32_t lag = head - conn->cursor;
+
+    if (lag > conn->stats.max_lag)
+    {
+        conn->stats.max_lag = lag;
+    }
+
+    // Too far behind: under block its bytes are kept and the emulator waits
+    // for it once the buffer fills; otherwise it skips to the newest output,
+    // and under resync is then sent what changed on the screen meanwhile
+    if (lag > g_ws_lag_limit && g_ws_policy != WS_OUTPUT_BLOCK && conn->sync == WS_SYNC_NONE)
+    {
+#ifdef ALTAIR_DEBUG
+        printf("WebSocket client %u fell %u bytes behind, skipping forward\n", conn->conn_id, lag);
+#endif
+        conn->stats.dropped += lag;
+        ++conn->stats.resyncs;
+        conn->cursor = head;
+        conn->pending_since_us = 0;
+        if (g_ws_policy == WS_OUTPUT_RESYNC)
+        {
+            conn->sync = conn->shadow_valid ? WS_SYNC_DIFF : WS_SYNC_REPAINT;
+        }
+        conn->shadow_valid = false;
+        lag = 0;
+    }
+
+    bool full = lag >= callbacks.output_size;
+    if (full && !conn->stalled)
+    {
+        ++conn->stats.stalls;
+    }
+    conn->stalled = full;
+
+    if (conn->sync != WS_SYNC_NONE)
+    {
+        return send_client_sync(conn, head, now);
+    }
+
+    if (lag == 0)
+    {
+        conn->pending_since_us = 0;
+        return false;
+    }
+
+    // Frame straight out of the shared buffer; a run that wraps goes out as
+    // a shorter frame and the rest follows on the next poll
+    const uint8_t* payload = nullptr;
+    size_t payload_len = callbacks.on_output_peek(WS_CHANNEL_CONSOLE, conn->cursor, &payload, callbacks.user_data);
+    payload_len = std::min(payload_len, static_cast<size_t>(lag));
+
+    if (conn->pending_since_us == 0)
+    {
+        conn->pending_since_us = now;
+    }
+
+    bool line_idle = now - conn->last_frame_us >= WS_FLUSH_IDLE_US;
+    bool frame_full = payload_len >= conn->frame_limit;
+    bool waited = now - conn->pending_since_us >= WS_FLUSH_COALESCE_US;
+    if (!line_idle && !frame_full && !waited)
+    {
+        return false;
+    }
+
+    payload_len = std::min(payload_len, conn->frame_limit);
+
+#ifdef ALTAIR_DEBUG
+    printf("WebSocket sending %zu bytes to %u\n", payload_len, conn->conn_id);
+#endif
+    if (!send_output(conn, WS_CHANNEL_CONSOLE, payload, payload_len))
+    {
+        // Its TCP send buffer is full: the bytes stay ahead of its cursor
+        // and go again in a smaller frame on a later pass
+        ++conn->stats.send_failures;
+        conn->frame_limit = std::max(conn->frame_limit / 2, WS_FRAME_MIN);
+        return false;
+    }
+
+    if (payload_len == conn->frame_limit)
+    {
+        conn->frame_limit = std::min(conn->frame_limit * 2, WS_FRAME_MAX);
+    }
+
+    if (conn->shadow_valid)
+    {
+        vt_screen_feed(&conn->shadow, payload, payload_len);
+    }
+    conn->cursor += static_cast<uint32_t>(payload_len);
+    conn->last_frame_us = now;
+    conn->pending_since_us = 0;
+    ++g_ws_stats.frames;
+    g_ws_stats.bytes += payload_len;
+    return true;
+}
+
+// Send a channel mode client the monitor output it has not seen. It is sent
+// as it comes and never holds the emulator up: a client that falls too far
+// behind skips to the newest output.
+static void send_client_monitor(ws_connection_state_t* conn, uint32_t head)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+    uint32_t lag = head - conn->monitor_cursor;
+
+    if (!(conn->channels & WS_CHANNEL_BIT(WS_CHANNEL_MONITOR)))
+    {
+        conn->monitor_cursor = head;
+        return;
+    }
+
+    if (lag > g_ws_monitor_lag_limit)
+    {
+        ++conn->stats.monitor_drops;
+        conn->monitor_cursor = head;
+        return;
+    }
+
+    if (lag == 0)
+    {
+        return;
+    }
+
+    const uint8_t* payload = nullptr;
+    size_t payload_len = callbacks.on_output_peek(WS_CHANNEL_MONITOR, conn->monitor_cursor, &payload,
+                                                  callbacks.user_data);
+    payload_len = std::min({payload_len, static_cast<size_t>(lag), WS_FRAME_MAX});
+
+    if (!send_output(conn, WS_CHANNEL_MONITOR, payload, payload_len))
+    {
+        ++conn->stats.send_failures;
+        return;
+    }
+
+    conn->monitor_cursor += static_cast<uint32_t>(payload_len);
+    ++g_ws_stats.frames;
+    g_ws_stats.bytes += payload_len;
+}
+
+// Answer a hello or subscribe. Returns false while its send buffer is full.
+static bool send_client_reply(ws_connection_state_t* conn)
+{
+    uint8_t reply[WS_HELLO_REPLY_LEN + 1];
+    uint8_t* out = &reply[1];
+
+    *out++ = WS_CONTROL_HELLO;
+    std::memcpy(out, WS_HELLO_MAGIC, WS_HELLO_MAGIC_LEN);
+    out += WS_HELLO_MAGIC_LEN;
+    *out++ = WS_PROTOCOL_VERSION;
+    *out++ = WS_CHANNELS_SUPPORTED;
+    *out++ = conn->channels;
+
+    if (!send_frame(conn, WS_CHANNEL_CONTROL, reply, WS_HELLO_REPLY_LEN))
+    {
+        ++conn->stats.send_failures;
+        return false;
+    }
+    conn->reply_pending = false;
+    return true;
+}
+
+// A client whose reply will not go out is sent nothing, but must not hold the
+// buffers either: once it is as far behind as a reading client may fall, its
+// cursors skip to the newest output and the console is repainted after the
+// reply.
+static void skip_waiting_client(ws_connection_state_t* conn, uint32_t head, uint32_t monitor_head)
+{
+    uint32_t lag = head - conn->cursor;
+
+    if (lag > g_ws_lag_limit)
+    {
+        conn->stats.dropped += lag;
+        ++conn->stats.resyncs;
+        conn->cursor = head;
+        conn->pending_since_us = 0;
+        conn->sync = WS_SYNC_REPAINT;
+        conn->shadow_valid = false;
+    }
+    if (monitor_head - conn->monitor_cursor > g_ws_monitor_lag_limit)
+    {
+        ++conn->stats.monitor_drops;
+        conn->monitor_cursor = monitor_head;
+    }
+}
+
+// Send a snapshot payload built at g_ws_snapshot_frame + 1 to one client
+static bool send_snapshot(ws_connection_state_t* conn, uint8_t channel, size_t length)
+{
+    if (!send_frame(conn, channel, g_ws_snapshot_frame, length))
+    {
+        ++conn->stats.send_failures;
+        return false;
+    }
+    ++g_ws_stats.frames;
+    g_ws_stats.bytes += length;
+    return true;
+}
+
+static bool wants(const ws_connection_state_t* conn, uint8_t channel)
+{
+    return conn->active && !conn->closing && conn->mux && !conn->reply_pending &&
+           (conn->channels & WS_CHANNEL_BIT(channel));
+}
+
+// Pass each LEDS frame the sampler has ready to its subscribers. A client
+// that joins or misses one waits for the next key frame, which is asked for.
+static void send_leds_frames(void)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+    bool resync = false;
+
+    if (!(g_ws_subscribed & WS_CHANNEL_BIT(WS_CHANNEL_LEDS)))
+    {
+        return;
+    }
+
+    size_t length;
+    while ((length = callbacks.on_snapshot(WS_CHANNEL_LEDS, &g_ws_snapshot_frame[1], WS_SNAPSHOT_MAX,
+                                           callbacks.user_data)) > 0)
+    {
+        bool key = g_ws_snapshot_frame[1] & WS_LEDS_KEY;
+
+        for (size_t i = 0; i < WS_MAX_CLIENTS; ++i)
+        {
+            ws_connection_state_t* conn = &g_ws_connections[i];
+            if (!wants(conn, WS_CHANNEL_LEDS) || (conn->leds_key_wait && !key))
+            {
+                continue;
+            }
+
+            conn->leds_key_wait = !send_snapshot(conn, WS_CHANNEL_LEDS, length);
+            resync |= conn->leds_key_wait;
+        }
+    }
+
+    if (resync && callbacks.on_resync)
+    {
+        callbacks.on_resync(WS_CHANNEL_LEDS, callbacks.user_data);
+    }
+}
+
+// Broadcast the STATS snapshot to its subscribers once it is due; a refused
+// one is skipped and the next one supersedes it
+static void send_stats(uint64_t now)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+
+    if (!(g_ws_subscribed & WS_CHANNEL_BIT(WS_CHANNEL_STATS)) || now < g_ws_stats_due_us)
+    {
+        return;
+    }
+    g_ws_stats_due_us = now + WS_STATS_INTERVAL_MS * 1000;
+
+    size_t length =
+        callbacks.on_snapshot(WS_CHANNEL_STATS, &g_ws_snapshot_frame[1], WS_SNAPSHOT_MAX, callbacks.user_data);
+    for (size_t i = 0; i < WS_MAX_CLIENTS && length > 0; ++i)
+    {
+        if (wants(&g_ws_connections[i], WS_CHANNEL_STATS))
+        {
+            send_snapshot(&g_ws_connections[i], WS_CHANNEL_STATS, length);
+        }
+    }
+}
+
+// Report a change in the channels anyone is subscribed to
+static void update_subscriptions(void)
+{
+    const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+    uint8_t channels = 0;
+
+    for (size_t i = 0; i < WS_MAX_CLIENTS; ++i)
+    {
+        const ws_connection_state_t* conn = &g_ws_connections[i];
+        if (conn->active && !conn->closing && conn->mux)
+        {
+            channels |= conn->channels;
+        }
+    }
+
+    if (channels != g_ws_subscribed)
+    {
+        g_ws_subscribed = channels;
+        if (callbacks.on_subscription)
+        {
+            callbacks.on_subscription(channels, callbacks.user_data);
+        }
+    }
+}
 } // namespace
 
 extern "C"
@@ -255,6 +800,10 @@ extern "C"
         }
 
         g_ws_context.callbacks = *callbacks;
+        g_ws_lag_limit = callbacks->output_size / 4 * 3;
+        g_ws_monitor_lag_limit = callbacks->monitor_output_size / 4 * 3;
+        vt_screen_reset(&g_ws_screen);
+        g_ws_screen_position = callbacks->on_output_head(WS_CHANNEL_CONSOLE, callbacks->user_data);
         g_ws_initialized = true;
     }
 
@@ -332,28 +881,78 @@ extern "C"
         send_ping_if_due();
     }
 
-    void ws_poll_outgoing(void)
+    void ws_get_output_stats(ws_output_stats_t* stats)
     {
-        if (!g_ws_running || !g_ws_server)
+        *stats = g_ws_stats;
+        stats->elapsed_us = time_us_64() - g_ws_stats.since_us;
+    }
+
+    size_t ws_get_client_stats(ws_client_stats_t* stats, size_t max)
+    {
+        const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+        uint32_t head =
+            callbacks.on_output_head ? callbacks.on_output_head(WS_CHANNEL_CONSOLE, callbacks.user_data) : 0;
+        size_t count = 0;
+
+        for (size_t i = 0; i < WS_MAX_CLIENTS && count < max; ++i)
         {
-            return;
+            const ws_connection_state_t* conn = &g_ws_connections[i];
+            if (!conn->active)
+            {
+                continue;
+            }
+
+            stats[count] = conn->stats;
+            stats[count].channel_mode = conn->mux;
+            stats[count].channels = conn->channels;
+            stats[count].lag = head - conn->cursor;
+            stats[count].frame_limit = static_cast<uint32_t>(conn->frame_limit);
+            ++count;
         }
+        return count;
+    }
 
-        if (g_ws_active_clients == 0 || !g_ws_context.callbacks.on_output)
+    void ws_clear_output_stats(void)
+    {
+        g_ws_stats = {};
+        g_ws_stats.since_us = time_us_64();
+
+        for (size_t i = 0; i < WS_MAX_CLIENTS; ++i)
         {
-            return;
+            ws_connection_state_t* conn = &g_ws_connections[i];
+            conn->stats = {};
+            conn->stats.conn_id = conn->conn_id;
         }
+    }
+
+    void ws_set_output_policy(ws_output_policy_t policy)
+    {
+        g_ws_policy = policy;
+    }
 
-        uint8_t payload[WS_FRAME_PAYLOAD];
+    ws_output_policy_t ws_get_output_policy(void)
+    {
+        return g_ws_policy;
+    }
 
-        size_t payload_len =
-            g_ws_context.callbacks.on_output(payload, sizeof(payload), g_ws_context.callbacks.user_data);
-        if (payload_len == 0)
+    void ws_poll_outgoing(void)
+    {
+        if (!g_ws_running || !g_ws_server || !g_ws_context.callbacks.on_output_peek)
         {
             return;
         }
 
-        // Send to each active client individually (best-effort: don't block on slow clients)
+        const ws_callbacks_t& callbacks = g_ws_context.callbacks;
+        uint32_t head = callbacks.on_output_head(WS_CHANNEL_CONSOLE, callbacks.user_data);
+        uint32_t monitor_head = callbacks.on_output_head(WS_CHANNEL_MONITOR, callbacks.user_data);
+        uint64_t now = time_us_64();
+        uint32_t release = head;
+        uint32_t monitor_release = monitor_head;
+        bool sent = false;
+
+        // Output is consumed by the screen whether or not anyone is watching
+        feed_screen(head);
+
         for (size_t i = 0; i < WS_MAX_CLIENTS; ++i)
         {
             ws_connection_state_t* conn = &g_ws_connections[i];
@@ -361,18 +960,60 @@ extern "C"
             {
                 continue;
             }
-#ifdef ALTAIR_DEBUG
-            printf("WebSocket sending %zu bytes to %u\n", payload_len, conn->conn_id);
-#endif
 
-            if (!g_ws_server->sendMessage(conn->conn_id, payload, payload_len))
+            // A channel mode client is sent nothing more until it has its
+            // reply; its cursors hold their place meanwhile, up to the lag limit
+            if (!conn->reply_pending || send_client_reply(conn))
             {
-#ifdef ALTAIR_DEBUG
-                // This specific client's TCP send buffer is full - they miss this frame
-                // (expected under load; real-time data, no backpressure)
-                printf("WebSocket send failed, dropping %zu bytes\n", payload_len);
-#endif
+                if (conn->channels & WS_CHANNEL_BIT(WS_CHANNEL_CONSOLE))
+                {
+                    sent |= send_client_output(conn, head, now);
+                }
+                else
+                {
+                    // Not watching: repainted once it subscribes again
+                    conn->cursor = head;
+                    conn->pending_since_us = 0;
+                    conn->sync = WS_SYNC_REPAINT;
+                    conn->shadow_valid = false;
+                }
+                send_client_monitor(conn, monitor_head);
+            }
+            else
+            {
+                skip_waiting_client(conn, head, monitor_head);
+            }
+
+            // Each buffer is released up to the client furthest behind
+            if (head - conn->cursor > head - release)
+            {
+                release = conn->cursor;
+            }
+            if (monitor_head - conn->monitor_cursor > monitor_head - monitor_release)
+            {
+                monitor_release = conn->monitor_cursor;
+            }
+        }
+
+        callbacks.on_output_release(WS_CHANNEL_CONSOLE, release, callbacks.user_data);
+        callbacks.on_output_release(WS_CHANNEL_MONITOR, monitor_release, callbacks.user_data);
+
+        update_subscriptions();
+        if (callbacks.on_snapshot)
+        {
+            send_leds_frames();
+            send_stats(now);
+        }
+
+        if (sent && g_ws_input_us != 0)
+        {
+            uint32_t latency_us = (uint32_t)(now - g_ws_input_us);
+            g_ws_stats.last_echo_us = latency_us;
+            if (latency_us > g_ws_stats.max_echo_us)
+            {
+                g_ws_stats.max_echo_us = latency_us;
             }
+            g_ws_input_us = 0;
         }
     }
 }
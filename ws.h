@@ -4,19 +4,84 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// Messages from a plain terminal client
 typedef bool (*ws_receive_cb_t)(const uint8_t* payload, size_t payload_len, void* user_data);
-typedef size_t (*ws_output_cb_t)(uint8_t* buffer, size_t max_len, void* user_data);
+// Messages from a channel mode client (ws_protocol.h), without the channel
+// byte; HELLO and SUBSCRIBE are handled by the server
+typedef bool (*ws_channel_receive_cb_t)(uint8_t channel, const uint8_t* payload, size_t payload_len,
+                                        void* user_data);
+// Console and monitor output (WS_CHANNEL_CONSOLE, WS_CHANNEL_MONITOR) are each
+// framed in place from one buffer shared by every client. Positions count
+// bytes ever written and each client sends from its own: peek returns the
+// contiguous run from a position, head is the position the next byte will
+// take, and release frees everything before a position once all clients have
+// sent it.
+typedef size_t (*ws_output_peek_cb_t)(uint8_t channel, uint32_t position, const uint8_t** data, void* user_data);
+typedef uint32_t (*ws_output_head_cb_t)(uint8_t channel, void* user_data);
+typedef void (*ws_output_release_cb_t)(uint8_t channel, uint32_t position, void* user_data);
+// Fill buffer with a LEDS or STATS payload; returns its length. STATS is asked
+// for once a second; LEDS on every poll, returning 0 until the next frame.
+typedef size_t (*ws_snapshot_cb_t)(uint8_t channel, uint8_t* buffer, size_t max_len, void* user_data);
+// The channels at least one client is subscribed to, whenever that changes
+typedef void (*ws_subscription_cb_t)(uint8_t channels, void* user_data);
+// A LEDS subscriber joined or missed a frame and needs a key frame
+typedef void (*ws_resync_cb_t)(uint8_t channel, void* user_data);
 typedef void (*ws_event_cb_t)(void* user_data);
 
 typedef struct
 {
     ws_receive_cb_t on_receive;
-    ws_output_cb_t on_output;
+    ws_channel_receive_cb_t on_channel_receive;
+    ws_output_peek_cb_t on_output_peek;
+    ws_output_head_cb_t on_output_head;
+    ws_output_release_cb_t on_output_release;
+    ws_snapshot_cb_t on_snapshot;
+    ws_subscription_cb_t on_subscription;
+    ws_resync_cb_t on_resync;
     ws_event_cb_t on_client_connected;
     ws_event_cb_t on_client_disconnected;
+    uint32_t output_size;         // Bytes the console output buffer holds
+    uint32_t monitor_output_size; // Bytes the monitor output buffer holds
     void* user_data;
 } ws_callbacks_t;
 
+// What happens to a client that falls behind by more than three quarters of
+// the output buffer
+typedef enum
+{
+    WS_OUTPUT_BLOCK,  // Keep its bytes; the emulator waits once the buffer is full
+    WS_OUTPUT_DROP,   // Skip it forward to the newest output
+    WS_OUTPUT_RESYNC, // Skip it forward and send what changed on its screen
+} ws_output_policy_t;
+
+// Output flushing counters (ws_poll_outgoing)
+typedef struct
+{
+    uint64_t since_us;      // Counting started (time_us_64)
+    uint64_t elapsed_us;    // Filled in by ws_get_output_stats()
+    uint64_t bytes;         // Payload bytes sent, all clients
+    uint32_t frames;        // Frames sent, all clients
+    uint32_t last_echo_us;  // Input arriving to the next frame going out
+    uint32_t max_echo_us;
+} ws_output_stats_t;
+
+// One client's place in the output stream
+typedef struct
+{
+    uint32_t conn_id;
+    bool channel_mode;      // Spoke the hello; otherwise a plain terminal
+    uint8_t channels;       // Subscribed channels (WS_CHANNEL_BIT)
+    uint32_t lag;           // Bytes written but not yet sent to it
+    uint32_t max_lag;
+    uint32_t frame_limit;   // Current adaptive frame size
+    uint32_t send_failures; // Frames its TCP send buffer refused
+    uint32_t stalls;        // Block: times it held up a full buffer
+    uint32_t resyncs;       // Drop and resync: times it was skipped forward
+    uint32_t monitor_drops; // Times it fell too far behind on the monitor channel
+    uint32_t syncs;         // Screens sent: a repaint on connect, diffs after a resync
+    uint64_t dropped;       // Bytes skipped
+} ws_client_stats_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -28,6 +93,12 @@ extern "C"
     void ws_poll_incoming(void);
     void ws_poll_outgoing(void);
     bool ws_has_active_clients(void);
+    void ws_get_output_stats(ws_output_stats_t* stats);
+    // Fills stats for up to max connected clients; returns how many
+    size_t ws_get_client_stats(ws_client_stats_t* stats, size_t max);
+    void ws_clear_output_stats(void);
+    void ws_set_output_policy(ws_output_policy_t policy);
+    ws_output_policy_t ws_get_output_policy(void);
 
 #ifdef __cplusplus
 }
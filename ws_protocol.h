@@ -0,0 +1,92 @@
+#pragma once
+
+// Multiplexed WebSocket protocol (port 8088)
+//
+// A client that connects and just types is a plain terminal: its messages are
+// console input, byte 28 toggles the CPU monitor and it is sent raw console
+// output. Terminal/index.html speaks the channels below, subscribing to the
+// console and LEDS to draw the front panel.
+//
+// A client that opens with a hello switches to channel mode. From then on
+// every binary message in either direction is one channel byte followed by
+// that channel's payload, and the server only sends the channels the client
+// has subscribed to:
+//
+//   CONTROL  Client: HELLO, SUBSCRIBE and MODE requests. Server: the hello
+//            reply, sent again after every SUBSCRIBE.
+//   CONSOLE  Client: console input. Server: console output, beginning with a
+//            repaint of the screen when the channel is subscribed.
+//   MONITOR  Client: CPU monitor input. Server: CPU monitor output alone (it
+//            still appears on the console as well, as on a plain terminal).
+//   LEDS     Server: front panel frames, up to 20 a second.
+//   STATS    Server: emulation counters every WS_STATS_INTERVAL_MS.
+//
+// Multi-byte fields are little-endian. Messages a client receives before the
+// hello reply are plain terminal output and should be ignored.
+
+#define WS_PROTOCOL_VERSION 2
+
+// Channels
+#define WS_CHANNEL_CONTROL 0
+#define WS_CHANNEL_CONSOLE 1
+#define WS_CHANNEL_MONITOR 2
+#define WS_CHANNEL_LEDS 3
+#define WS_CHANNEL_STATS 4
+#define WS_CHANNEL_COUNT 5
+
+#define WS_CHANNEL_BIT(channel) (1u << (channel))
+#define WS_CHANNELS_SUPPORTED                                                                                          \
+    (WS_CHANNEL_BIT(WS_CHANNEL_CONSOLE) | WS_CHANNEL_BIT(WS_CHANNEL_MONITOR) | WS_CHANNEL_BIT(WS_CHANNEL_LEDS) |      \
+     WS_CHANNEL_BIT(WS_CHANNEL_STATS))
+
+// Control requests, the first payload byte on WS_CHANNEL_CONTROL
+//
+// HELLO      "ALTAIR" version [channels]. Enters channel mode, subscribed to
+//            channels (the console alone if omitted). The reply is HELLO
+//            "ALTAIR" version supported-channels subscribed-channels.
+// SUBSCRIBE  channels. Replaces the subscription; answered with a hello reply.
+// MODE       0 stops the CPU and enters the monitor, 1 runs it.
+#define WS_CONTROL_HELLO 1
+#define WS_CONTROL_SUBSCRIBE 2
+#define WS_CONTROL_MODE 3
+
+#define WS_HELLO_MAGIC "ALTAIR"
+#define WS_HELLO_MAGIC_LEN 6
+#define WS_HELLO_REPLY_LEN (1 + WS_HELLO_MAGIC_LEN + 3) // Op, magic, version, supported, subscribed
+
+// LEDS payload: a frame of LED states, delta-encoded
+//
+//   0  u8   flags: WS_LEDS_KEY (every cell follows), WS_LEDS_PERSISTENCE
+//   1       bitmap of the cells that follow, bit n of byte n / 8 for cell n
+//   ...     the new value of each of those cells, in cell order
+//
+// A client keeps the last value of every cell and applies each frame to them;
+// it starts from a key frame, and a frame that changes nothing is not sent.
+// Without persistence there are WS_LEDS_LATCH_CELLS cells holding the bus as
+// last sampled:
+//
+//   0  address bus A0-A7     2  data bus D0-D7         4  WS_LEDS_INTE, WS_LEDS_WAIT
+//   1  address bus A8-A15    3  status byte (cpuStatus)
+//
+// With persistence there are WS_LEDS_PERSISTENCE_CELLS: the brightness 0-255
+// of each LED, the share of the frame's samples it was lit in, then the flags:
+//
+//   0-15  A0-A15   16-23  D0-D7   24-31  status bits 0-7   32  INTE   33  WS_LEDS_WAIT
+#define WS_LEDS_KEY 0x01
+#define WS_LEDS_PERSISTENCE 0x02
+#define WS_LEDS_LATCH_CELLS 5
+#define WS_LEDS_PERSISTENCE_CELLS 34
+#define WS_LEDS_INTE 0x01
+#define WS_LEDS_WAIT 0x02 // The monitor has stopped the CPU
+
+// STATS payload
+//
+//   0  u8   mode (CPU_OPERATING_MODE)
+//   1  u8   clock preset (CPU_CLOCK_PRESET)
+//   2  u32  measured clock in kHz
+//   6  u64  T-states since reset
+//  14  u64  microseconds spent idle waiting for console input
+//  22  u32  idle waits ended by console input
+//  26  u32  last wake latency in microseconds
+#define WS_STATS_INTERVAL_MS 1000
+#define WS_STATS_PAYLOAD_LEN 30